@@ -0,0 +1,374 @@
+// Minimal micro-benchmark harness for vec_bench
+//
+// Each benchmark times one operation in two modes:
+//   * latency: the operation runs in a dependency chain, each call's first input depending on the
+//     previous call's result (through a run-time zero the compiler cannot see through), so calls
+//     cannot overlap. Every result is forced to memory, so no part of it can be skipped. The cost
+//     of that feedback is measured once per input type with an identity operation and subtracted
+//     (reported as overhead_ns).
+//   * throughput: the operation runs over arrays of kArrayLength independent inputs, so the
+//     compiler and CPU may pipeline and vectorize across elements.
+// Times are per operation, in nanoseconds: the median over the repetitions, each of which runs
+// for at least the minimum time. With hardware counters enabled, one more run is counted (see
+// perf_counters.hpp) and reported per operation; in latency mode the counts include the feedback.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#include "perf_counters.hpp"
+
+namespace bench {
+
+using std::size_t;
+
+// Number of elements per throughput array (small enough to stay in L1/L2 for every type)
+inline constexpr size_t kArrayLength = 256;
+
+// Benchmark modes
+inline constexpr std::string_view kLatency = "latency";
+inline constexpr std::string_view kThroughput = "throughput";
+
+// Command-line options
+struct Options {
+    // Only run benchmarks whose full name (e.g. "vec/dot/float/3/latency") contains this
+    std::string filter;
+
+    // Minimum duration of each timed repetition
+    double min_time_ms = 10.0;
+
+    // Number of timed repetitions (the median is reported)
+    size_t repetitions = 3;
+
+    // Path of the JSON results file (none if empty)
+    std::string json_path;
+
+    // Count hardware events per operation (where available)
+    bool counters = false;
+};
+
+// Result of one benchmark
+struct Result {
+    std::string name;
+    std::string type;
+    size_t size;
+    std::string_view mode;
+    double ns;
+    double min_ns;
+    double overhead_ns;
+    std::uint64_t iterations;
+    CounterValues counters;
+};
+
+// Timing (and optionally hardware counts) of one benchmark body
+struct Measurement {
+    double ns;
+    double min_ns;
+    std::uint64_t iterations;
+    CounterValues counters;
+};
+
+/*** OPTIMIZATION BARRIERS ***/
+
+// Make the compiler assume value is read and modified here (it must be materialized in memory)
+template<typename T>
+inline void escape(T& value) {
+    asm volatile("" : "+m"(value) : : "memory");
+}
+
+// Make the compiler assume the memory behind ptr is read and modified here
+inline void escape_memory(const void* ptr) {
+    asm volatile("" : : "r"(ptr) : "memory");
+}
+
+/*** TYPE HELPERS ***/
+
+// Get the printable name of a scalar type
+template<typename Type>
+constexpr std::string_view type_name() {
+    if constexpr (std::is_same_v<Type, float>) {
+        return "float";
+    } else if constexpr (std::is_same_v<Type, double>) {
+        return "double";
+    } else {
+        return "long double";
+    }
+}
+
+// Get one scalar of an operation's result, to feed back into the next call's input
+template<typename Type, typename R>
+Type first_scalar(const R& r) {
+    if constexpr (std::is_arithmetic_v<R>) {
+        return static_cast<Type>(r);
+    } else if constexpr (requires { r(0, 0); }) {
+        return r(0, 0);
+    } else if constexpr (requires { r[0]; }) {
+        return r[0];
+    } else if constexpr (requires { r.inverse; }) {
+        return r.determinant; // InverseResult
+    } else {
+        return r.has_value() ? (*r)(0, 0) : Type{}; // std::optional<Mat>
+    }
+}
+
+// Add d to one scalar of an operation's input
+template<typename Type, typename In>
+void add_to_first(In& x, Type d) {
+    if constexpr (std::is_arithmetic_v<In>) {
+        x += d;
+    } else if constexpr (requires { x(0, 0); }) {
+        x(0, 0) += d;
+    } else {
+        x[0] += d;
+    }
+}
+
+/*** RUNNER ***/
+
+// Runs benchmarks and collects their results
+class Runner {
+public:
+    explicit Runner(Options options) : options_(std::move(options)) {
+        if (options_.counters) {
+            counters_ = std::make_unique<PerfCounters>();
+            if (!counters_->available()) {
+                std::fprintf(stderr, "Hardware counters unavailable, reporting times only: %s\n",
+                             counters_->error().c_str());
+                counters_.reset();
+            } else if (!counters_->error().empty()) {
+                std::fprintf(stderr, "Some hardware counters unavailable: %s\n",
+                             counters_->error().c_str());
+            }
+        }
+    }
+
+    // Time op(inputs...) in both latency and throughput modes
+    template<typename Type, typename Op, typename In, typename... Rest>
+    void run(std::string_view name, size_t size, Op op, In input, Rest... rest) {
+        latency<Type>(name, size, op, input, rest...);
+        throughput<Type>(name, size, op, input, rest...);
+    }
+
+    // Time op(inputs...) in a dependency chain through the first input
+    template<typename Type, typename Op, typename In, typename... Rest>
+    void latency(std::string_view name, size_t size, Op op, In input, Rest... rest) {
+        const std::string full = full_name<Type>(name, size, kLatency);
+        if (!selected(full)) {
+            return;
+        }
+        const double overhead = chain_overhead<Type>(input);
+        const Measurement m = measure([&](std::uint64_t count) {
+            Type zero{};
+            escape(zero);
+            In x = input;
+            (escape(rest), ...);
+            for (std::uint64_t i = 0; i < count; i++) {
+                auto r = op(x, rest...);
+                escape(r);
+                add_to_first(x, first_scalar<Type>(r) * zero);
+            }
+            escape(x);
+        });
+        record<Type>(name, size, kLatency, {m.ns - overhead, m.min_ns - overhead, m.iterations,
+                                            m.counters}, overhead);
+    }
+
+    // Time op(inputs...) over arrays of independent inputs
+    template<typename Type, typename Op, typename... In>
+    void throughput(std::string_view name, size_t size, Op op, In... inputs) {
+        const std::string full = full_name<Type>(name, size, kThroughput);
+        if (!selected(full)) {
+            return;
+        }
+        // Note: bool results are stored as bytes, since std::vector<bool> has no data()
+        using R = std::invoke_result_t<Op, In&...>;
+        using Stored = std::conditional_t<std::is_same_v<R, bool>, unsigned char, R>;
+        auto arrays = std::make_tuple(std::vector<In>(kArrayLength, inputs)...);
+        std::vector<Stored> out(kArrayLength, op(inputs...));
+        const Measurement m = measure([&](std::uint64_t count) {
+            for (std::uint64_t rep = 0; rep < count; rep += kArrayLength) {
+                std::apply([](auto&... a) { (escape_memory(a.data()), ...); }, arrays);
+                std::apply([&](auto&... a) {
+                    for (size_t i = 0; i < kArrayLength; i++) {
+                        out[i] = op(a[i]...);
+                    }
+                }, arrays);
+                escape_memory(out.data());
+            }
+        }, kArrayLength);
+        record<Type>(name, size, kThroughput, m, 0.0);
+    }
+
+    // Check if hardware counters are being measured
+    bool counting() const {
+        return counters_ != nullptr;
+    }
+
+    // Get the results so far
+    const std::vector<Result>& results() const {
+        return results_;
+    }
+
+private:
+    // Get the full name of a benchmark, e.g. "vec/dot/float/3/latency"
+    template<typename Type>
+    static std::string full_name(std::string_view name, size_t size, std::string_view mode) {
+        return std::string(name) + "/" + std::string(type_name<Type>()) + "/"
+               + std::to_string(size) + "/" + std::string(mode);
+    }
+
+    // Check if a benchmark passes the filter
+    bool selected(const std::string& full) const {
+        return full.find(options_.filter) != std::string::npos;
+    }
+
+    // Get the per-operation cost of the latency feedback path for input type In (measured once)
+    template<typename Type, typename In>
+    double chain_overhead(const In& input) {
+        const auto cached = overheads_.find(std::type_index(typeid(In)));
+        if (cached != overheads_.end()) {
+            return cached->second;
+        }
+        const auto identity = [](const In& x) { return x; };
+        const Measurement m = measure([&](std::uint64_t count) {
+            Type zero{};
+            escape(zero);
+            In x = input;
+            for (std::uint64_t i = 0; i < count; i++) {
+                auto r = identity(x);
+                escape(r);
+                add_to_first(x, first_scalar<Type>(r) * zero);
+            }
+            escape(x);
+        });
+        overheads_.emplace(std::type_index(typeid(In)), m.min_ns);
+        return m.min_ns;
+    }
+
+    // Time body(count) for a count lasting at least the minimum time, over every repetition
+    // Returns the median and minimum time per iteration, the iteration count and (if enabled) the
+    // hardware counts per iteration of one more run
+    template<typename Body>
+    Measurement measure(Body body, std::uint64_t step = 1) {
+        using Clock = std::chrono::steady_clock;
+        const auto time = [&](std::uint64_t count) {
+            const auto start = Clock::now();
+            body(count);
+            return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        };
+
+        // Grow the count until one run takes the minimum time
+        const double min_time_ns = options_.min_time_ms * 1e6;
+        std::uint64_t count = std::max<std::uint64_t>(step, 64);
+        double elapsed = time(count);
+        while (elapsed < min_time_ns) {
+            const double scale = (elapsed > 0) ? std::min(min_time_ns * 1.2 / elapsed, 10.0) : 10.0;
+            count = std::max(count + step, static_cast<std::uint64_t>(count * scale) / step * step);
+            elapsed = time(count);
+        }
+
+        std::vector<double> samples;
+        for (size_t i = 0; i < std::max<size_t>(options_.repetitions, 1); i++) {
+            samples.push_back(time(count) / static_cast<double>(count));
+        }
+        std::sort(samples.begin(), samples.end());
+
+        CounterValues counts;
+        if (counters_) {
+            counters_->start();
+            body(count);
+            counts = counters_->stop();
+            counts /= static_cast<double>(count);
+        }
+        return {samples[samples.size() / 2], samples.front(), count, counts};
+    }
+
+    // Record and print a result
+    template<typename Type>
+    void record(std::string_view name, size_t size, std::string_view mode, const Measurement& m,
+                double overhead_ns) {
+        results_.push_back({std::string(name), std::string(type_name<Type>()), size, mode,
+                            std::max(m.ns, 0.0), std::max(m.min_ns, 0.0), overhead_ns,
+                            m.iterations, m.counters});
+        const Result& r = results_.back();
+        std::printf("%-32s %-12s %zu  %-10s %10.3f ns", r.name.c_str(), r.type.c_str(), size,
+                    std::string(mode).c_str(), r.ns);
+        if (r.counters.any()) {
+            const auto print = [&](Counter counter, const char* unit) {
+                if (r.counters.has(counter)) {
+                    std::printf("  %9.3f %s", r.counters.get(counter), unit);
+                } else {
+                    std::printf("  %9s %s", "-", unit);
+                }
+            };
+            print(Counter::Cycles, "cyc");
+            print(Counter::Instructions, "ins");
+            std::printf("  %5.2f IPC", r.counters.ipc());
+            print(Counter::L1dMisses, "L1D");
+            print(Counter::LlcMisses, "LLC");
+            print(Counter::BranchMisses, "BR");
+        }
+        std::printf("\n");
+    }
+
+    Options options_;
+    std::vector<Result> results_;
+    std::map<std::type_index, double> overheads_;
+    std::unique_ptr<PerfCounters> counters_;
+};
+
+/*** OUTPUT ***/
+
+// Write results as JSON: {"context": {...}, "benchmarks": [{...}, ...]}
+// Each benchmark has a "counters" object when hardware counters were measured
+inline void write_json(std::FILE* file, const std::vector<Result>& results,
+                       const std::vector<std::pair<std::string, std::string>>& context) {
+    std::fprintf(file, "{\n  \"context\": {");
+    for (size_t i = 0; i < context.size(); i++) {
+        std::fprintf(file, "%s\n    \"%s\": \"%s\"", (i > 0) ? "," : "", context[i].first.c_str(),
+                     context[i].second.c_str());
+    }
+    std::fprintf(file, "\n  },\n  \"benchmarks\": [");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        std::fprintf(file,
+                     "%s\n    {\"name\": \"%s\", \"type\": \"%s\", \"size\": %zu, "
+                     "\"mode\": \"%s\", \"ns\": %.4f, \"min_ns\": %.4f, \"overhead_ns\": %.4f, "
+                     "\"iterations\": %llu",
+                     (i > 0) ? "," : "", r.name.c_str(), r.type.c_str(), r.size,
+                     std::string(r.mode).c_str(), r.ns, r.min_ns, r.overhead_ns,
+                     static_cast<unsigned long long>(r.iterations));
+        if (r.counters.any()) {
+            // Only the counters that were measured are written
+            std::fprintf(file, ", \"counters\": {");
+            const char* separator = "";
+            for (size_t c = 0; c < kNumCounters; c++) {
+                if (r.counters.valid[c]) {
+                    std::fprintf(file, "%s\"%s\": %.4f", separator,
+                                 std::string(kCounterNames[c]).c_str(), r.counters.values[c]);
+                    separator = ", ";
+                }
+            }
+            if (r.counters.ipc() > 0) {
+                std::fprintf(file, "%s\"ipc\": %.4f", separator, r.counters.ipc());
+            }
+            std::fprintf(file, "}");
+        }
+        std::fprintf(file, "}");
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+}
+
+} // namespace bench
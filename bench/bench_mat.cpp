@@ -0,0 +1,78 @@
+// Mat benchmarks for vec_bench
+
+#include <string_view>
+
+#include "vec_bench.hpp"
+
+/*** MATRIX BENCHMARKS ***/
+
+// Register benchmarks for every Mat operator, friend function and computational member
+template<typename Type, size_t M>
+void bench_mat(bench::Runner& runner) {
+    using MatT = Mat<Type, M>;
+    using VecT = Vec<Type, M>;
+    const MatT a = make_mat<Type, M>(0);
+    const MatT b = make_mat<Type, M>(1);
+    const MatT c = make_mat<Type, M>(2);
+    const VecT v = make_vec<Type, M>(0);
+    const VecT w = make_vec<Type, M>(1);
+    const auto s = static_cast<Type>(0.75);
+    const auto run = [&](std::string_view name, auto op, auto... inputs) {
+        runner.run<Type>(name, M, op, inputs...);
+    };
+
+    // Member functions
+    run("mat/determinant", [](const MatT& m) { return m.determinant(); }, a);
+    run("mat/inverse", [](const MatT& m) { return m.inverse(); }, a);
+    run("mat/inverse_with_determinant", [](const MatT& m) { return m.inverse_with_determinant(); },
+        a);
+    run("mat/try_inverse", [](const MatT& m) { return m.try_inverse(); }, a);
+    run("mat/transpose", [](const MatT& m) { return m.transpose(); }, a);
+    run("mat/transpose_relayout", [](const MatT& m) { return MatT(m.transpose_relayout()); }, a);
+    run("mat/fill", [](MatT m, Type f) { m.fill(f); return m; }, a, s);
+    run("mat/clear", [](MatT m) { m.clear(); return m; }, a);
+
+    // Member operators
+    run("mat/add_assign", [](MatT m, const MatT& n) { return m += n; }, a, b);
+    run("mat/sub_assign", [](MatT m, const MatT& n) { return m -= n; }, a, b);
+    run("mat/mul_assign_scalar", [](MatT m, Type f) { return m *= f; }, a, s);
+    run("mat/mul_assign", [](MatT m, const MatT& n) { return m *= n; }, a, b);
+    run("mat/div_assign", [](MatT m, Type f) { return m /= f; }, a, s);
+
+    // Friend operators
+    run("mat/negate", [](const MatT& m) { return -m; }, a);
+    run("mat/equal", [](const MatT& m, const MatT& n) { return m == n; }, a, b);
+    run("mat/not_equal", [](const MatT& m, const MatT& n) { return m != n; }, a, b);
+    run("mat/add", [](const MatT& m, const MatT& n) { return m + n; }, a, b);
+    run("mat/sub", [](const MatT& m, const MatT& n) { return m - n; }, a, b);
+    run("mat/mul_scalar", [](const MatT& m, Type f) { return m * f; }, a, s);
+    run("mat/scalar_mul", [](const MatT& m, Type f) { return f * m; }, a, s);
+    run("mat/div_scalar", [](const MatT& m, Type f) { return m / f; }, a, s);
+    run("mat/vec_mul", [](const VecT& x, const MatT& m) { return x * m; }, v, a);
+    run("mat/mul_vec", [](const MatT& m, const VecT& x) { return m * x; }, a, v);
+    run("mat/mul", [](const MatT& m, const MatT& n) { return m * n; }, a, b);
+
+    // Friend functions
+    run("mat/approx_eq", [](const MatT& m, const MatT& n) { return approx_eq(m, n); }, a, b);
+    run("mat/fma", [](const MatT& m, const MatT& n, const MatT& o) { return fma(m, n, o); },
+        a, b, c);
+    run("mat/fma_vec_mat",
+        [](const VecT& x, const MatT& m, const VecT& y) { return fma(x, m, y); }, v, a, w);
+    run("mat/fma_mat_vec",
+        [](const MatT& m, const VecT& x, const VecT& y) { return fma(m, x, y); }, a, v, w);
+    run("mat/madd", [](const MatT& m, Type f, const MatT& n) { return madd(m, f, n); }, a, s, b);
+    run("mat/lerp", [](const MatT& m, const MatT& n, Type t) { return lerp(m, n, t); }, a, b, s);
+}
+
+// Register the benchmarks for every type and size
+void run_mat_benchmarks(bench::Runner& runner) {
+    bench_mat<float, 2>(runner);
+    bench_mat<float, 3>(runner);
+    bench_mat<float, 4>(runner);
+    bench_mat<double, 2>(runner);
+    bench_mat<double, 3>(runner);
+    bench_mat<double, 4>(runner);
+    bench_mat<long double, 2>(runner);
+    bench_mat<long double, 3>(runner);
+    bench_mat<long double, 4>(runner);
+}
@@ -0,0 +1,71 @@
+// AffineTransform benchmarks for vec_bench
+
+#include <string_view>
+
+#include "vec_bench.hpp"
+
+/*** TRANSFORM BENCHMARKS ***/
+
+// Register benchmarks for every AffineTransform operator and member function
+// Note: the size is the transform's dimension (2 or 3), not its matrix size
+template<typename Type, size_t M>
+void bench_transform(bench::Runner& runner) {
+    using TransformT = AffineTransform<Type, M>;
+    using MatT = Mat<Type, M>;
+    using VecT = Vec<Type, M>;
+    using PointT = Vec<Type, M + 1>;
+    const TransformT a = make_transform<Type, M>(0);
+    const TransformT b = make_transform<Type, M>(1);
+    const MatT linear = b.get_linear_transform();
+    const VecT translation = make_vec<Type, M>(2);
+    PointT point(make_vec<Type, M>(3));
+    point[M] = 1;
+    const auto angle = static_cast<Type>(0.4);
+    const auto run = [&](std::string_view name, auto op, auto... inputs) {
+        runner.run<Type>(name, M, op, inputs...);
+    };
+
+    // Static member functions
+    if constexpr (M == 2) {
+        run("transform/rotate", [](Type r) { return TransformT::rotate(r); }, angle);
+    } else {
+        run("transform/rotate_x", [](Type r) { return TransformT::rotate_x(r); }, angle);
+        run("transform/rotate_y", [](Type r) { return TransformT::rotate_y(r); }, angle);
+        run("transform/rotate_z", [](Type r) { return TransformT::rotate_z(r); }, angle);
+    }
+
+    // Member functions
+    run("transform/construct", [](const MatT& m, const VecT& t) { return TransformT(m, t); },
+        linear, translation);
+    run("transform/get_linear_transform", [](const TransformT& t) {
+        return t.get_linear_transform();
+    }, a);
+    run("transform/set_linear_transform", [](TransformT t, const MatT& m) {
+        t.set_linear_transform(m);
+        return t;
+    }, a, linear);
+    run("transform/get_translation", [](const TransformT& t) { return t.get_translation(); }, a);
+    run("transform/set_translation", [](TransformT t, const VecT& x) {
+        t.set_translation(x);
+        return t;
+    }, a, translation);
+    run("transform/inverse", [](const TransformT& t) { return t.inverse(); }, a);
+    run("transform/try_inverse", [](const TransformT& t) { return t.try_inverse(); }, a);
+    run("transform/rigid_inverse", [](const TransformT& t) { return t.rigid_inverse(); }, a);
+
+    // Operators
+    run("transform/compose", [](const TransformT& t, const TransformT& u) { return t * u; }, a, b);
+    run("transform/compose_assign", [](TransformT t, const TransformT& u) { return t *= u; },
+        a, b);
+    run("transform/apply", [](const PointT& p, const TransformT& t) { return p * t; }, point, a);
+}
+
+// Register the benchmarks for every type and size
+void run_transform_benchmarks(bench::Runner& runner) {
+    bench_transform<float, 2>(runner);
+    bench_transform<float, 3>(runner);
+    bench_transform<double, 2>(runner);
+    bench_transform<double, 3>(runner);
+    bench_transform<long double, 2>(runner);
+    bench_transform<long double, 3>(runner);
+}
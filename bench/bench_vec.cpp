@@ -0,0 +1,91 @@
+// Vec benchmarks for vec_bench
+
+#include <string_view>
+
+#include "vec_bench.hpp"
+
+/*** VECTOR BENCHMARKS ***/
+
+// Register benchmarks for every Vec operator, friend function and computational member
+template<typename Type, size_t M>
+void bench_vec(bench::Runner& runner) {
+    using VecT = Vec<Type, M>;
+    const VecT a = make_vec<Type, M>(0);
+    const VecT b = make_vec<Type, M>(1);
+    const VecT c = make_vec<Type, M>(2);
+    const VecT unit = make_vec<Type, M>(3).normalize();
+    const auto s = static_cast<Type>(0.75);
+    const auto run = [&](std::string_view name, auto op, auto... inputs) {
+        runner.run<Type>(name, M, op, inputs...);
+    };
+
+    // Member functions
+    run("vec/manhattan", [](const VecT& v) { return v.manhattan(); }, a);
+    run("vec/euclidean", [](const VecT& v) { return v.euclidean(); }, a);
+    run("vec/euclidean2", [](const VecT& v) { return v.euclidean2(); }, a);
+    run("vec/euclidean_inv", [](const VecT& v) { return v.euclidean_inv(); }, a);
+    run("vec/normalize", [](const VecT& v) { return v.normalize(); }, a);
+    run("vec/normalize_fast", [](const VecT& v) { return v.normalize_fast(); }, a);
+    run("vec/fill", [](VecT v, Type f) { v.fill(f); return v; }, a, s);
+    run("vec/clear", [](VecT v) { v.clear(); return v; }, a);
+
+    // Member operators
+    run("vec/add_assign", [](VecT v, const VecT& w) { return v += w; }, a, b);
+    run("vec/sub_assign", [](VecT v, const VecT& w) { return v -= w; }, a, b);
+    run("vec/mul_assign", [](VecT v, Type f) { return v *= f; }, a, s);
+    run("vec/div_assign", [](VecT v, Type f) { return v /= f; }, a, s);
+
+    // Friend operators
+    run("vec/negate", [](const VecT& v) { return -v; }, a);
+    run("vec/equal", [](const VecT& v, const VecT& w) { return v == w; }, a, b);
+    run("vec/not_equal", [](const VecT& v, const VecT& w) { return v != w; }, a, b);
+    run("vec/add", [](const VecT& v, const VecT& w) { return v + w; }, a, b);
+    run("vec/sub", [](const VecT& v, const VecT& w) { return v - w; }, a, b);
+    run("vec/mul_scalar", [](const VecT& v, Type f) { return v * f; }, a, s);
+    run("vec/scalar_mul", [](const VecT& v, Type f) { return f * v; }, a, s);
+    run("vec/div_scalar", [](const VecT& v, Type f) { return v / f; }, a, s);
+
+    // Friend functions
+    run("vec/approx_eq", [](const VecT& v, const VecT& w) { return approx_eq(v, w); }, a, b);
+    run("vec/dot", [](const VecT& v, const VecT& w) { return dot(v, w); }, a, b);
+    run("vec/manhattan_between", [](const VecT& v, const VecT& w) { return manhattan(v, w); },
+        a, b);
+    run("vec/euclidean_between", [](const VecT& v, const VecT& w) { return euclidean(v, w); },
+        a, b);
+    run("vec/euclidean2_between", [](const VecT& v, const VecT& w) { return euclidean2(v, w); },
+        a, b);
+    run("vec/project_onto", [](const VecT& v, const VecT& w) { return project_onto(v, w); }, a, b);
+    run("vec/project_onto_unit",
+        [](const VecT& v, const VecT& w) { return project_onto_unit(v, w); }, a, unit);
+    run("vec/reject_from", [](const VecT& v, const VecT& w) { return reject_from(v, w); }, a, b);
+    run("vec/reject_from_unit",
+        [](const VecT& v, const VecT& w) { return reject_from_unit(v, w); }, a, unit);
+    run("vec/fma", [](const VecT& v, const VecT& w, const VecT& x) { return fma(v, w, x); },
+        a, b, c);
+    run("vec/madd", [](const VecT& v, Type f, const VecT& w) { return madd(v, f, w); }, a, s, b);
+    run("vec/lerp", [](const VecT& v, const VecT& w, Type t) { return lerp(v, w, t); }, a, b, s);
+    run("vec/mix", [](const VecT& v, const VecT& w, const VecT& t) { return mix(v, w, t); },
+        a, b, unit);
+    if constexpr (M == 3) {
+        run("vec/cross", [](const VecT& v, const VecT& w) { return cross(v, w); }, a, b);
+        run("vec/vector_triple",
+            [](const VecT& v, const VecT& w, const VecT& x) { return vector_triple(v, w, x); },
+            a, b, c);
+        run("vec/scalar_triple",
+            [](const VecT& v, const VecT& w, const VecT& x) { return scalar_triple(v, w, x); },
+            a, b, c);
+    }
+}
+
+// Register the benchmarks for every type and size
+void run_vec_benchmarks(bench::Runner& runner) {
+    bench_vec<float, 2>(runner);
+    bench_vec<float, 3>(runner);
+    bench_vec<float, 4>(runner);
+    bench_vec<double, 2>(runner);
+    bench_vec<double, 3>(runner);
+    bench_vec<double, 4>(runner);
+    bench_vec<long double, 2>(runner);
+    bench_vec<long double, 3>(runner);
+    bench_vec<long double, 4>(runner);
+}
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Compare two vec_bench JSON result files and flag regressions.
+
+Usage: compare.py BASELINE.json CURRENT.json [--threshold 0.10] [--min-delta 0.5] [--metric ns]
+
+Benchmarks are matched on (name, type, size, mode). A benchmark regresses when its metric (time
+in ns by default, or a hardware counter such as cycles or instructions when both files have it)
+grows by more than the threshold (relative) and by more than --min-delta (absolute, to ignore
+noise on sub-nanosecond operations). Exits with status 1 if any benchmark regressed, 0 otherwise.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    """Load a results file as a dict keyed by (name, type, size, mode)."""
+    with open(path, encoding="utf-8") as file:
+        data = json.load(file)
+    results = {}
+    for bench in data["benchmarks"]:
+        key = (bench["name"], bench["type"], bench["size"], bench["mode"])
+        results[key] = bench
+    return data.get("context", {}), results
+
+
+def metric(bench, name):
+    """Get a benchmark's metric (a top-level field or a hardware counter), or None if missing."""
+    if name in bench:
+        return bench[name]
+    return bench.get("counters", {}).get(name)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="baseline vec_bench JSON file")
+    parser.add_argument("current", help="current vec_bench JSON file")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative slowdown that counts as a regression (default: 0.10)")
+    parser.add_argument("--min-delta", type=float, default=0.5,
+                        help="absolute change below which changes are ignored (default: 0.5)")
+    parser.add_argument("--metric", default="ns",
+                        help="metric to compare: ns, min_ns or a counter name (default: ns)")
+    parser.add_argument("--all", action="store_true",
+                        help="print every benchmark, not only changes")
+    args = parser.parse_args()
+
+    base_context, baseline = load(args.baseline)
+    curr_context, current = load(args.current)
+    for key in sorted(set(base_context) | set(curr_context)):
+        if base_context.get(key) != curr_context.get(key):
+            print(f"note: {key} differs: {base_context.get(key)!r} -> {curr_context.get(key)!r}")
+
+    regressions = []
+    improvements = []
+    skipped = 0
+    for key in sorted(set(baseline) & set(current)):
+        old = metric(baseline[key], args.metric)
+        new = metric(current[key], args.metric)
+        if old is None or new is None:
+            skipped += 1
+            continue
+        change = (new - old) / old if old > 0 else 0.0
+        label = "/".join(str(part) for part in key)
+        line = f"{label:<60} {old:10.3f} -> {new:10.3f} {args.metric} ({change:+7.1%})"
+        if change > args.threshold and new - old > args.min_delta:
+            regressions.append(line)
+        elif change < -args.threshold and old - new > args.min_delta:
+            improvements.append(line)
+        elif args.all:
+            print(line)
+
+    for line in improvements:
+        print(f"improved   {line}")
+    for line in regressions:
+        print(f"REGRESSED  {line}")
+
+    missing = sorted(set(baseline) - set(current))
+    added = sorted(set(current) - set(baseline))
+    if missing:
+        print(f"{len(missing)} baseline benchmarks missing from current results")
+    if added:
+        print(f"{len(added)} new benchmarks not in baseline")
+    if skipped:
+        print(f"{skipped} benchmarks without {args.metric} in both files")
+    print(f"{len(regressions)} regressions, {len(improvements)} improvements "
+          f"(threshold {args.threshold:.0%}, min {args.min_delta} {args.metric})")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
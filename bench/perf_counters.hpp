@@ -0,0 +1,198 @@
+// Hardware performance counters for vec_bench (Linux perf_event_open)
+//
+// Counts user-space cycles, instructions, L1 data cache read misses, last-level cache misses and
+// branch misses around a benchmark run. Counters are often unavailable (non-Linux systems,
+// containers whose seccomp profile blocks perf_event_open, VMs without a virtual PMU, or
+// kernel.perf_event_paranoid > 2); each counter that cannot be opened or scheduled is reported as
+// missing rather than failing the run.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+using std::size_t;
+
+// Hardware counters, in the order of kCounterNames
+enum class Counter : size_t {
+    Cycles,
+    Instructions,
+    L1dMisses,
+    LlcMisses,
+    BranchMisses,
+};
+
+// Number of hardware counters
+inline constexpr size_t kNumCounters = 5;
+
+// Counter names, as printed in JSON results
+inline constexpr std::array<std::string_view, kNumCounters> kCounterNames{
+    "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"};
+
+// Counter values (per operation once divided by the iteration count)
+struct CounterValues {
+    std::array<double, kNumCounters> values{};
+    std::array<bool, kNumCounters> valid{};
+
+    // Check if a counter was measured
+    bool has(Counter counter) const {
+        return valid[static_cast<size_t>(counter)];
+    }
+
+    // Get a counter's value (0 if it was not measured)
+    double get(Counter counter) const {
+        return values[static_cast<size_t>(counter)];
+    }
+
+    // Check if any counter was measured
+    bool any() const {
+        for (const bool v : valid) {
+            if (v) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Get instructions per cycle, or 0 if either counter is missing
+    double ipc() const {
+        if (!has(Counter::Cycles) || !has(Counter::Instructions) || (get(Counter::Cycles) <= 0)) {
+            return 0.0;
+        }
+        return get(Counter::Instructions) / get(Counter::Cycles);
+    }
+
+    // Divide every counter by n (e.g. the iteration count)
+    CounterValues& operator/=(double n) {
+        for (double& v : values) {
+            v /= n;
+        }
+        return *this;
+    }
+};
+
+// Group of hardware counters for the calling thread, enabled and disabled together
+class PerfCounters {
+public:
+    // Open every counter; check available() for the outcome
+    PerfCounters() {
+#if defined(__linux__)
+        constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, kNumCounters> kEvents{{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                         | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        }};
+        for (size_t i = 0; i < kNumCounters; i++) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = kEvents[i].first;
+            attr.config = kEvents[i].second;
+            attr.disabled = (leader() < 0) ? 1 : 0; // members follow the leader
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader(), 0));
+            if ((fds_[i] < 0) && error_.empty()) {
+                error_ = std::string(kCounterNames[i]) + ": " + std::strerror(errno);
+            }
+        }
+        if (leader() < 0) {
+            error_ = "perf_event_open failed (" + error_ + ")";
+        }
+#else
+        error_ = "hardware counters require Linux perf_event_open";
+#endif
+    }
+
+    // Close every counter
+    ~PerfCounters() {
+#if defined(__linux__)
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // Check if at least one counter could be opened
+    bool available() const {
+        return leader() >= 0;
+    }
+
+    // Get the reason the first unavailable counter could not be opened (empty if all opened)
+    const std::string& error() const {
+        return error_;
+    }
+
+    // Reset and start counting
+    void start() {
+#if defined(__linux__)
+        if (available()) {
+            ioctl(leader(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leader(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    // Stop counting and get the counts since start()
+    // Note: counts are scaled up if the kernel multiplexed the group; a counter that never ran
+    // (e.g. the PMU has too few registers for the whole group) is reported as missing
+    CounterValues stop() {
+        CounterValues out;
+#if defined(__linux__)
+        if (!available()) {
+            return out;
+        }
+        ioctl(leader(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        for (size_t i = 0; i < kNumCounters; i++) {
+            std::uint64_t data[3] = {}; // value, time enabled, time running
+            if ((fds_[i] < 0) || (read(fds_[i], data, sizeof(data)) != sizeof(data))
+                    || (data[2] == 0)) {
+                continue;
+            }
+            const double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+            out.values[i] = static_cast<double>(data[0]) * scale;
+            out.valid[i] = true;
+        }
+#endif
+        return out;
+    }
+
+private:
+    // Get the file descriptor of the group leader (the first counter that opened), or -1
+    int leader() const {
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                return fd;
+            }
+        }
+        return -1;
+    }
+
+    std::array<int, kNumCounters> fds_{-1, -1, -1, -1, -1};
+    std::string error_;
+};
+
+} // namespace bench
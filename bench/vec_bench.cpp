@@ -0,0 +1,87 @@
+// Micro-benchmarks for every operator and friend function of Vec, Mat and AffineTransform
+//
+// Usage: vec_bench [--filter SUBSTRING] [--min-time-ms MS] [--repetitions N] [--json PATH]
+//                  [--counters]
+//
+// Each benchmark is named "<group>/<operation>/<type>/<size>/<mode>" (e.g. "mat/mul_vec/float/4/
+// throughput"); see bench.hpp for what the latency and throughput modes measure. Compare two JSON
+// result files with bench/compare.py.
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "vec_bench.hpp"
+
+#ifndef VEC_BENCH_OPT_LEVEL
+#define VEC_BENCH_OPT_LEVEL "unknown"
+#endif
+
+/*** MAIN ***/
+
+// Print usage and exit with the given status
+[[noreturn]] void usage(const char* program, int status) {
+    std::fprintf((status == 0) ? stdout : stderr,
+                 "Usage: %s [--filter SUBSTRING] [--min-time-ms MS] [--repetitions N]"
+                 " [--json PATH] [--counters]\n",
+                 program);
+    std::exit(status);
+}
+
+int main(int argc, char** argv) {
+    bench::Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        if ((arg == "-h") || (arg == "--help")) {
+            usage(argv[0], 0);
+        }
+        if (arg == "--counters") {
+            options.counters = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            usage(argv[0], 1);
+        }
+        const char* value = argv[++i];
+        if (arg == "--filter") {
+            options.filter = value;
+        } else if (arg == "--min-time-ms") {
+            options.min_time_ms = std::atof(value);
+        } else if (arg == "--repetitions") {
+            options.repetitions = static_cast<size_t>(std::atoi(value));
+        } else if (arg == "--json") {
+            options.json_path = value;
+        } else {
+            usage(argv[0], 1);
+        }
+    }
+
+    bench::Runner runner(options);
+    run_vec_benchmarks(runner);
+    run_mat_benchmarks(runner);
+    run_transform_benchmarks(runner);
+
+    if (!options.json_path.empty()) {
+        std::FILE* file = std::fopen(options.json_path.c_str(), "w");
+        if (file == nullptr) {
+            std::fprintf(stderr, "Failed to open %s\n", options.json_path.c_str());
+            return 1;
+        }
+#if defined(VEC_ENABLE_SIMD)
+        const std::string simd = "on";
+#else
+        const std::string simd = "off";
+#endif
+        bench::write_json(file, runner.results(), {
+            {"compiler", __VERSION__},
+            {"opt_level", VEC_BENCH_OPT_LEVEL},
+            {"simd", simd},
+            {"min_time_ms", std::to_string(options.min_time_ms)},
+            {"repetitions", std::to_string(options.repetitions)},
+            {"hardware_counters", runner.counting() ? "on" : "off"},
+        });
+        std::fclose(file);
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+// Benchmark inputs and groups shared by the vec_bench translation units
+//
+// The benchmarks are split across translation units (one per group) so they compile in parallel.
+
+#pragma once
+
+#include "bench.hpp"
+#include "mat.hpp"
+#include "transform.hpp"
+#include "vec.hpp"
+
+using vec::AffineTransform;
+using vec::Mat;
+using vec::Vec;
+
+/*** INPUTS ***/
+
+// Get a vector with well-scaled, distinct, non-zero elements
+template<typename Type, size_t M>
+inline Vec<Type, M> make_vec(int seed) {
+    Vec<Type, M> out;
+    for (size_t i = 0; i < M; i++) {
+        out[i] = static_cast<Type>(0.75 + 0.25 * static_cast<double>((seed + 3 * i) % 7));
+    }
+    return out;
+}
+
+// Get a well-conditioned matrix (diagonally dominant, so invertible with a modest determinant)
+template<typename Type, size_t M>
+inline Mat<Type, M> make_mat(int seed) {
+    Mat<Type, M> out;
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < M; j++) {
+            out(i, j) = static_cast<Type>((i == j) ? 2.0 : 0.125 * ((seed + i + 2 * j) % 5) - 0.25);
+        }
+    }
+    return out;
+}
+
+// Get a rigid transform (rotation plus translation)
+template<typename Type, size_t M>
+inline AffineTransform<Type, M> make_transform(int seed) {
+    const auto angle = static_cast<Type>(0.3 + 0.1 * seed);
+    if constexpr (M == 2) {
+        return AffineTransform<Type, 2>(AffineTransform<Type, 2>::rotate(angle),
+                                        make_vec<Type, 2>(seed));
+    } else {
+        using TransformT = AffineTransform<Type, 3>;
+        return TransformT(TransformT::rotate_x(angle) * TransformT::rotate_z(angle * 2),
+                          make_vec<Type, 3>(seed));
+    }
+}
+/*** BENCHMARK GROUPS ***/
+
+// Register the Vec benchmarks for every type and size (see bench_vec.cpp)
+void run_vec_benchmarks(bench::Runner& runner);
+
+// Register the Mat benchmarks for every type and size (see bench_mat.cpp)
+void run_mat_benchmarks(bench::Runner& runner);
+
+// Register the AffineTransform benchmarks for every type and size (see bench_transform.cpp)
+void run_transform_benchmarks(bench::Runner& runner);
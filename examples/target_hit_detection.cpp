@@ -115,7 +115,7 @@ constexpr bool check_target_hit(const Shot& shot, const CircleTarget& target) {
 
     // Intersect point exists; check distance from target center against radius
     // Note: checking square of distance against square of radius for efficiency
-    const Vec3f intersect = shot.position + (t * shot.direction);
+    const Vec3f intersect = madd(shot.direction, t, shot.position);
     return euclidean2(intersect, target.position) < (target.radius * target.radius);
 }
 
@@ -0,0 +1,143 @@
+// Bulk transformation of points and directions by an AffineTransform
+//
+// Transforming a point p by an affine transform T = [L 0; t 1] (row-vector convention) is
+// p' = p * L + t. The kernels here use that structure directly: they read the MxM linear part and
+// translation row of T and never touch the constant last column, never build a padded (M+1)-D
+// vector, and never perform a homogeneous divide. Directions use the linear part only.
+//
+// Inputs are split into chunks that run on a ThreadPool (the shared pool by default), and each
+// chunk runs a SIMD kernel over structure-of-arrays streams (VecArray) or a per-vector kernel over
+// contiguous Vec ranges. The output may alias the input for in-place transformation.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+#include <type_traits>
+
+#include "dispatch.hpp"
+#include "simd.hpp"
+#include "thread_pool.hpp"
+#include "transform.hpp"
+#include "vec_array.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Number of vectors per parallel chunk
+inline constexpr size_t kBatchTransformGrain = size_t{1} << 14;
+
+namespace detail {
+
+// Apply x' = x * L (+ t) to vectors [first, last) of structure-of-arrays streams
+template<bool kTranslate, typename Type, size_t M, Layout L>
+void transform_streams(const AffineTransform<Type, M, L>& transform,
+                       const std::array<const Type*, M>& in, const std::array<Type*, M>& out,
+                       size_t first, size_t last) {
+    dispatch::for_each_lane<Type>(first, last, [&]<typename Lane>(size_t i) {
+        std::array<Lane, M> src;
+        for (size_t k = 0; k < M; k++) {
+            src[k] = simd::load<Lane>(in[k] + i);
+        }
+        for (size_t j = 0; j < M; j++) {
+            Lane acc = src[0] * Lane(transform(0, j));
+            for (size_t k = 1; k < M; k++) {
+                acc = acc + src[k] * Lane(transform(k, j));
+            }
+            if constexpr (kTranslate) {
+                acc = acc + Lane(transform(M, j));
+            }
+            simd::store(out[j] + i, acc);
+        }
+    });
+}
+
+// Apply x' = x * L (+ t) to vectors [first, last) of a contiguous Vec range
+template<bool kTranslate, typename Type, size_t M>
+void transform_vecs(const std::array<Vec<Type, M>, M + 1>& rows,
+                    std::span<const Vec<Type, M>> in, std::span<Vec<Type, M>> out,
+                    size_t first, size_t last) {
+    for (size_t i = first; i < last; i++) {
+        const Vec<Type, M> v = in[i];
+        Vec<Type, M> acc = rows[0] * v[0];
+        for (size_t k = 1; k < M; k++) {
+            acc += rows[k] * v[k];
+        }
+        if constexpr (kTranslate) {
+            acc += rows[M];
+        }
+        out[i] = acc;
+    }
+}
+
+// Split a structure-of-arrays transformation across the pool
+template<bool kTranslate, typename Type, size_t M, Layout L>
+void transform_array(const AffineTransform<Type, M, L>& transform,
+                     const VecArray<Type, M>& in, VecArray<Type, M>& out, ThreadPool& pool) {
+    out.resize(in.size());
+    std::array<const Type*, M> in_streams;
+    std::array<Type*, M> out_streams;
+    for (size_t k = 0; k < M; k++) {
+        in_streams[k] = in.component(k).data();
+        out_streams[k] = out.component(k).data();
+    }
+    pool.parallel_for(in.size(), kBatchTransformGrain, [&](size_t first, size_t last) {
+        transform_streams<kTranslate>(transform, in_streams, out_streams, first, last);
+    });
+}
+
+// Split a contiguous Vec range transformation across the pool
+template<bool kTranslate, typename Type, size_t M, Layout L>
+void transform_range(const AffineTransform<Type, M, L>& transform,
+                     std::span<const Vec<Type, M>> in, std::span<Vec<Type, M>> out, ThreadPool& pool) {
+    assert(in.size() == out.size());
+    std::array<Vec<Type, M>, M + 1> rows;
+    for (size_t k = 0; k <= M; k++) {
+        for (size_t j = 0; j < M; j++) {
+            rows[k][j] = transform(k, j);
+        }
+    }
+    pool.parallel_for(in.size(), kBatchTransformGrain, [&](size_t first, size_t last) {
+        transform_vecs<kTranslate>(rows, in, out, first, last);
+    });
+}
+
+} // namespace detail
+
+// Transform M-dimensional points (translation applied) stored as contiguous Vec values
+template<typename Type, size_t M, Layout L>
+void transform_points(const AffineTransform<Type, M, L>& transform,
+                      std::type_identity_t<std::span<const Vec<Type, M>>> in,
+                      std::type_identity_t<std::span<Vec<Type, M>>> out,
+                      ThreadPool& pool = ThreadPool::shared()) {
+    detail::transform_range<true>(transform, in, out, pool);
+}
+
+// Transform M-dimensional directions (translation ignored) stored as contiguous Vec values
+template<typename Type, size_t M, Layout L>
+void transform_directions(const AffineTransform<Type, M, L>& transform,
+                          std::type_identity_t<std::span<const Vec<Type, M>>> in,
+                          std::type_identity_t<std::span<Vec<Type, M>>> out,
+                          ThreadPool& pool = ThreadPool::shared()) {
+    detail::transform_range<false>(transform, in, out, pool);
+}
+
+// Transform M-dimensional points (translation applied) stored as structure-of-arrays
+template<typename Type, size_t M, Layout L>
+void transform_points(const AffineTransform<Type, M, L>& transform,
+                      const VecArray<Type, M>& in, VecArray<Type, M>& out,
+                      ThreadPool& pool = ThreadPool::shared()) {
+    detail::transform_array<true>(transform, in, out, pool);
+}
+
+// Transform M-dimensional directions (translation ignored) stored as structure-of-arrays
+template<typename Type, size_t M, Layout L>
+void transform_directions(const AffineTransform<Type, M, L>& transform,
+                          const VecArray<Type, M>& in, VecArray<Type, M>& out,
+                          ThreadPool& pool = ThreadPool::shared()) {
+    detail::transform_array<false>(transform, in, out, pool);
+}
+
+} // namespace vec
@@ -0,0 +1,585 @@
+// Versioned little-endian binary container for arrays of Vec, Mat and AffineTransform records
+//
+// A file holds one array of records of a single type, after a fixed 64-byte header:
+//
+//     Offset  Size  Field
+//     0       4     magic "VECB"
+//     4       2     format version (kFormatVersion)
+//     6       1     record kind (RecordKind)
+//     7       1     scalar size in bytes (4: float, 8: double)
+//     8       1     dimension M
+//     9       1     storage (Storage)
+//     10      2     reserved (0)
+//     12      4     scalars per record
+//     16      8     record count
+//     24      8     plane stride in records (planar storage only, otherwise 0)
+//     32      32    reserved (0)
+//
+// All fields and scalars are little-endian, and the payload starts right after the header. A record
+// is stored as its scalars in reading order: the M elements of a Vec, the M rows of a Mat (in
+// either Layout), or the M rows of an AffineTransform's linear part followed by its translation
+// (the constant homogeneous column is not stored). Interleaved storage places the scalars of each
+// record together; planar storage places scalar e of every record in plane e, plane_stride records
+// long, which gives structure-of-arrays streams (e.g. the x, y and z of a point cloud).
+//
+// Reader maps the file into memory and exposes the payload without copying, as spans of scalars, a
+// VecView of interleaved vectors, or planar component streams; individual records are decoded on
+// access. Writer streams records to disk in chunks, so arrays larger than memory can be written.
+// I/O and format errors throw std::runtime_error.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VEC_IO_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define VEC_IO_MMAP 0
+#endif
+
+#include "record_traits.hpp"
+#include "vec_array.hpp"
+#include "vec_view.hpp"
+
+using std::size_t;
+
+namespace vec::io {
+
+// File signature
+inline constexpr std::array<char, 4> kMagic{'V', 'E', 'C', 'B'};
+
+// Current format version (readers accept this version and older)
+inline constexpr std::uint16_t kFormatVersion = 1;
+
+// Size of the file header in bytes (the payload starts here)
+inline constexpr size_t kHeaderSize = 64;
+
+// Default number of records buffered by Writer before each write to disk
+inline constexpr size_t kChunkRecords = size_t{1} << 16;
+
+// Arrangement of record scalars in the payload
+enum class Storage : std::uint8_t {
+    Interleaved = 0,
+    Planar = 1,
+};
+
+// Decoded file header
+struct FileInfo {
+    std::uint16_t version = kFormatVersion;
+    RecordKind kind = RecordKind::Vec;
+    std::uint8_t scalar_size = 0;
+    std::uint8_t dim = 0;
+    Storage storage = Storage::Interleaved;
+    std::uint32_t record_elems = 0;
+    std::uint64_t count = 0;
+    std::uint64_t plane_stride = 0;
+};
+
+// Concepts
+template<typename Record>
+concept IsBinaryRecord = IsRecord<Record>
+                         && (std::is_same_v<typename RecordTraits<Record>::Scalar, float>
+                             || std::is_same_v<typename RecordTraits<Record>::Scalar, double>);
+
+namespace detail {
+
+// Write unsigned integer v to out in little-endian byte order
+template<typename UInt>
+void put_le(std::byte* out, UInt v) {
+    for (size_t b = 0; b < sizeof(UInt); b++) {
+        out[b] = static_cast<std::byte>((v >> (8 * b)) & 0xFF);
+    }
+}
+
+// Read unsigned integer in little-endian byte order from in
+template<typename UInt>
+UInt get_le(const std::byte* in) {
+    UInt out = 0;
+    for (size_t b = 0; b < sizeof(UInt); b++) {
+        out |= static_cast<UInt>(std::to_integer<UInt>(in[b]) << (8 * b));
+    }
+    return out;
+}
+
+// Get the header describing records of type Record
+template<typename Record>
+FileInfo record_info(Storage storage, std::uint64_t count, std::uint64_t plane_stride) {
+    using Traits = RecordTraits<Record>;
+    FileInfo out;
+    out.kind = Traits::kKind;
+    out.scalar_size = static_cast<std::uint8_t>(sizeof(typename Traits::Scalar));
+    out.dim = static_cast<std::uint8_t>(Traits::kDim);
+    out.storage = storage;
+    out.record_elems = static_cast<std::uint32_t>(Traits::kElems);
+    out.count = count;
+    out.plane_stride = (storage == Storage::Planar) ? plane_stride : 0;
+    return out;
+}
+
+// Encode file header
+inline std::array<std::byte, kHeaderSize> encode_header(const FileInfo& info) {
+    std::array<std::byte, kHeaderSize> out{};
+    for (size_t i = 0; i < kMagic.size(); i++) {
+        out[i] = static_cast<std::byte>(kMagic[i]);
+    }
+    put_le<std::uint16_t>(&out[4], info.version);
+    out[6] = static_cast<std::byte>(info.kind);
+    out[7] = static_cast<std::byte>(info.scalar_size);
+    out[8] = static_cast<std::byte>(info.dim);
+    out[9] = static_cast<std::byte>(info.storage);
+    put_le<std::uint32_t>(&out[12], info.record_elems);
+    put_le<std::uint64_t>(&out[16], info.count);
+    put_le<std::uint64_t>(&out[24], info.plane_stride);
+    return out;
+}
+
+// Decode file header
+inline FileInfo decode_header(std::span<const std::byte> bytes) {
+    if (bytes.size() < kHeaderSize) {
+        throw std::runtime_error("vec::io: file too small for header");
+    }
+    for (size_t i = 0; i < kMagic.size(); i++) {
+        if (bytes[i] != static_cast<std::byte>(kMagic[i])) {
+            throw std::runtime_error("vec::io: bad file signature");
+        }
+    }
+    FileInfo out;
+    out.version = get_le<std::uint16_t>(&bytes[4]);
+    out.kind = static_cast<RecordKind>(bytes[6]);
+    out.scalar_size = std::to_integer<std::uint8_t>(bytes[7]);
+    out.dim = std::to_integer<std::uint8_t>(bytes[8]);
+    out.storage = static_cast<Storage>(bytes[9]);
+    out.record_elems = get_le<std::uint32_t>(&bytes[12]);
+    out.count = get_le<std::uint64_t>(&bytes[16]);
+    out.plane_stride = get_le<std::uint64_t>(&bytes[24]);
+    return out;
+}
+
+} // namespace detail
+
+/******************************************************************************
+ * MAPPED FILE
+ ******************************************************************************/
+
+// Read-only view of a whole file's bytes, memory-mapped where the platform supports it (otherwise
+// read into memory)
+class MappedFile {
+public:
+    // Map the file at path
+    explicit MappedFile(const std::filesystem::path& path) {
+#if VEC_IO_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("vec::io: cannot open " + path.string());
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("vec::io: cannot stat " + path.string());
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("vec::io: cannot map " + path.string());
+            }
+            // Note: large payloads are typically consumed front to back
+            ::madvise(mapping, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const std::byte*>(mapping);
+        }
+        // Note: the mapping stays valid after the descriptor is closed
+        ::close(fd);
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("vec::io: cannot open " + path.string());
+        }
+        size_ = static_cast<size_t>(file.tellg());
+        buffer_ = std::make_unique<std::byte[]>(size_);
+        file.seekg(0);
+        const auto size = static_cast<std::streamsize>(size_);
+        if (!file.read(reinterpret_cast<char*>(buffer_.get()), size)) {
+            throw std::runtime_error("vec::io: cannot read " + path.string());
+        }
+        data_ = buffer_.get();
+#endif
+    }
+
+    // Unmap the file
+    ~MappedFile() {
+#if VEC_IO_MMAP
+        if (data_ != nullptr) {
+            ::munmap(const_cast<std::byte*>(data_), size_);
+        }
+#endif
+    }
+
+    // Move mapping from other
+    MappedFile(MappedFile&& other) noexcept
+            : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+#if !VEC_IO_MMAP
+            , buffer_(std::move(other.buffer_))
+#endif
+    {}
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    // Get the file's bytes
+    std::span<const std::byte> bytes() const {
+        return {data_, size_};
+    }
+
+private:
+    // First byte of the file
+    const std::byte* data_ = nullptr;
+
+    // Size of the file in bytes
+    size_t size_ = 0;
+
+#if !VEC_IO_MMAP
+    // File contents (when memory mapping is unavailable)
+    std::unique_ptr<std::byte[]> buffer_;
+#endif
+};
+
+/******************************************************************************
+ * READER
+ ******************************************************************************/
+
+// Zero-copy reader for a file of Record values
+template<typename Record>
+requires IsBinaryRecord<Record>
+class Reader {
+    static_assert(std::endian::native == std::endian::little,
+                  "vec::io maps little-endian payloads directly and needs a little-endian host");
+
+    // Type aliases for convenience
+    using Traits = RecordTraits<Record>;
+    using Scalar = typename Traits::Scalar;
+
+    static constexpr size_t kElems = Traits::kElems;
+    static constexpr bool kIsVec = (Traits::kKind == RecordKind::Vec);
+
+public:
+    // Open and validate the file at path
+    explicit Reader(const std::filesystem::path& path) : file_(path) {
+        const auto bytes = file_.bytes();
+        info_ = detail::decode_header(bytes);
+        if (info_.version == 0 || info_.version > kFormatVersion) {
+            throw std::runtime_error("vec::io: unsupported format version "
+                                     + std::to_string(info_.version));
+        }
+        const FileInfo expected = detail::record_info<Record>(info_.storage, 0, 0);
+        if ((info_.kind != expected.kind) || (info_.scalar_size != expected.scalar_size)
+            || (info_.dim != expected.dim) || (info_.record_elems != expected.record_elems)) {
+            throw std::runtime_error("vec::io: file records do not match the requested type");
+        }
+
+        // Check that the payload holds every record (arranged to avoid overflow on corrupt counts)
+        const std::uint64_t payload = (bytes.size() - kHeaderSize) / sizeof(Scalar);
+        bool complete = false;
+        if (info_.storage == Storage::Interleaved) {
+            complete = (info_.count <= payload / kElems);
+        } else if (info_.storage == Storage::Planar) {
+            complete = (info_.plane_stride >= info_.count)
+                       && (info_.plane_stride <= payload)
+                       && ((kElems - 1) * info_.plane_stride + info_.count <= payload);
+        } else {
+            throw std::runtime_error("vec::io: unknown storage");
+        }
+        if (!complete) {
+            throw std::runtime_error("vec::io: file is truncated");
+        }
+        data_ = reinterpret_cast<const Scalar*>(bytes.data() + kHeaderSize);
+    }
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the decoded file header
+    const FileInfo& info() const {
+        return info_;
+    }
+
+    // Get the number of records
+    size_t size() const {
+        return static_cast<size_t>(info_.count);
+    }
+
+    // Get the arrangement of record scalars
+    Storage storage() const {
+        return info_.storage;
+    }
+
+    // Get record i (with bounds check)
+    Record at(size_t i) const {
+        if (i >= size()) {
+            throw std::out_of_range("Reader::at");
+        }
+        return (*this)[i];
+    }
+
+    // Get the scalars of all records, in order (interleaved storage)
+    std::span<const Scalar> elements() const {
+        assert(info_.storage == Storage::Interleaved);
+        return {data_, size() * kElems};
+    }
+
+    // Get the stream of scalar e of every record (planar storage)
+    std::span<const Scalar> component(size_t e) const {
+        assert((info_.storage == Storage::Planar) && (e < kElems));
+        return {data_ + e * static_cast<size_t>(info_.plane_stride), size()};
+    }
+
+    // Get the vectors in place (interleaved storage)
+    ConstVecView<Record> view() const requires kIsVec {
+        assert(info_.storage == Storage::Interleaved);
+        return ConstVecView<Record>(data_, size());
+    }
+
+    // Decode records [first, first + out.size()) into out
+    void read(std::span<Record> out, size_t first = 0) const {
+        assert(first + out.size() <= size());
+        for (size_t i = 0; i < out.size(); i++) {
+            out[i] = (*this)[first + i];
+        }
+    }
+
+    // Copy all vectors into a structure-of-arrays container
+    void read(VecArray<Scalar, Traits::kDim>& out) const requires kIsVec {
+        out.resize(size());
+        for (size_t k = 0; k < Traits::kDim; k++) {
+            const auto stream = out.component(k);
+            if (info_.storage == Storage::Planar) {
+                std::copy(component(k).begin(), component(k).end(), stream.begin());
+            } else {
+                for (size_t i = 0; i < stream.size(); i++) {
+                    stream[i] = data_[i * kElems + k];
+                }
+            }
+        }
+    }
+
+    /**************************************************************************
+     * MEMBER OPERATORS
+     **************************************************************************/
+
+    // Get record i (no bounds check)
+    Record operator[](size_t i) const {
+        if (info_.storage == Storage::Planar) {
+            return Traits::decode(data_ + i, static_cast<size_t>(info_.plane_stride));
+        }
+        return Traits::decode(data_ + i * kElems, 1);
+    }
+
+private:
+    // File contents
+    MappedFile file_;
+
+    // Decoded header
+    FileInfo info_;
+
+    // First payload scalar
+    const Scalar* data_ = nullptr;
+};
+
+/******************************************************************************
+ * WRITER
+ ******************************************************************************/
+
+// Chunked streaming writer for a file of Record values
+// Planar storage needs the number of records up front (capacity), since each plane is written at
+// its final offset; fewer records may be written, leaving the rest of each plane unused.
+template<typename Record>
+requires IsBinaryRecord<Record>
+class Writer {
+    static_assert(std::endian::native == std::endian::little,
+                  "vec::io writes payloads in native byte order and needs a little-endian host");
+
+    // Type aliases for convenience
+    using Traits = RecordTraits<Record>;
+    using Scalar = typename Traits::Scalar;
+
+    static constexpr size_t kElems = Traits::kElems;
+    static constexpr bool kIsVec = (Traits::kKind == RecordKind::Vec);
+
+public:
+    // Create (or truncate) the file at path
+    explicit Writer(const std::filesystem::path& path, Storage storage = Storage::Interleaved,
+                    size_t capacity = 0, size_t chunk_records = kChunkRecords)
+            : file_(path, std::ios::binary | std::ios::trunc), storage_(storage),
+              capacity_(capacity), chunk_records_(std::max<size_t>(chunk_records, 1)),
+              buffer_(chunk_records_ * kElems) {
+        if (!file_) {
+            throw std::runtime_error("vec::io: cannot create " + path.string());
+        }
+        if ((storage_ == Storage::Planar) && (capacity_ == 0)) {
+            throw std::invalid_argument("vec::io: planar storage needs a capacity");
+        }
+        write_header();
+    }
+
+    // Flush and close the file, ignoring errors (call close() to observe them)
+    ~Writer() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the number of records written so far
+    size_t size() const {
+        return written_ + pending_;
+    }
+
+    // Append a record
+    void write(const Record& record) {
+        assert(file_.is_open());
+        if ((storage_ == Storage::Planar) && (size() == capacity_)) {
+            throw std::length_error("vec::io: planar file capacity exceeded");
+        }
+        if (storage_ == Storage::Planar) {
+            Traits::encode(record, buffer_.data() + pending_, chunk_records_);
+        } else {
+            Traits::encode(record, buffer_.data() + pending_ * kElems, 1);
+        }
+        if (++pending_ == chunk_records_) {
+            write_chunk();
+        }
+    }
+
+    // Append a contiguous range of records
+    void write(std::span<const Record> records) {
+        for (const auto& record : records) {
+            write(record);
+        }
+    }
+
+    // Append all vectors of a structure-of-arrays container
+    void write(const VecArray<Scalar, Traits::kDim>& vecs) requires kIsVec {
+        for (size_t i = 0; i < vecs.size(); i++) {
+            write(vecs.gather(i));
+        }
+    }
+
+    // Write buffered records and the current record count to disk
+    void flush() {
+        write_chunk();
+        write_header();
+        file_.flush();
+        check("flush");
+    }
+
+    // Write buffered records and the final header, then close the file
+    void close() {
+        if (!file_.is_open()) {
+            return;
+        }
+        flush();
+        file_.close();
+        check("close");
+    }
+
+private:
+    // Write the header for the records written so far
+    void write_header() {
+        const auto header = detail::encode_header(
+                detail::record_info<Record>(storage_, written_, capacity_));
+        file_.seekp(0);
+        file_.write(reinterpret_cast<const char*>(header.data()), header.size());
+        check("write header");
+    }
+
+    // Write buffered records to their final offsets
+    void write_chunk() {
+        if (pending_ == 0) {
+            return;
+        }
+        if (storage_ == Storage::Planar) {
+            for (size_t e = 0; e < kElems; e++) {
+                const size_t offset = kHeaderSize + (e * capacity_ + written_) * sizeof(Scalar);
+                file_.seekp(static_cast<std::streamoff>(offset));
+                file_.write(reinterpret_cast<const char*>(buffer_.data() + e * chunk_records_),
+                            static_cast<std::streamsize>(pending_ * sizeof(Scalar)));
+            }
+        } else {
+            const size_t offset = kHeaderSize + written_ * kElems * sizeof(Scalar);
+            file_.seekp(static_cast<std::streamoff>(offset));
+            file_.write(reinterpret_cast<const char*>(buffer_.data()),
+                        static_cast<std::streamsize>(pending_ * kElems * sizeof(Scalar)));
+        }
+        check("write records");
+        written_ += pending_;
+        pending_ = 0;
+    }
+
+    // Throw if the last file operation failed
+    void check(const char* operation) const {
+        if (file_.fail()) {
+            throw std::runtime_error(std::string("vec::io: ") + operation + " failed");
+        }
+    }
+
+    // Output file
+    std::ofstream file_;
+
+    // Arrangement of record scalars
+    Storage storage_;
+
+    // Records per plane (planar storage)
+    size_t capacity_;
+
+    // Records buffered per write
+    size_t chunk_records_;
+
+    // Buffered record scalars (interleaved, or one chunk-length plane per scalar)
+    std::vector<Scalar> buffer_;
+
+    // Number of records on disk
+    size_t written_ = 0;
+
+    // Number of buffered records
+    size_t pending_ = 0;
+};
+
+// Write an array of records to a new file in one call
+template<typename Record>
+requires IsBinaryRecord<Record>
+void write_file(const std::filesystem::path& path,
+                std::type_identity_t<std::span<const Record>> records,
+                Storage storage = Storage::Interleaved) {
+    Writer<Record> writer(path, storage, std::max<size_t>(records.size(), 1));
+    writer.write(records);
+    writer.close();
+}
+
+} // namespace vec::io
@@ -0,0 +1,340 @@
+// Runtime CPU feature dispatch for batch kernels
+//
+// Batch kernels over arrays (VecArray, batch_transform.hpp, mat_batch.hpp, skinning.hpp) are
+// written once against a generic lane type (see simd.hpp). dispatch::for_each_lane() instantiates
+// such a kernel once per instruction set below, each copy compiled with the matching target
+// attribute, and calls the widest copy the CPU supports: SSE2 (4 float or 2 double lanes), AVX2
+// (8 or 4) or AVX-512 (16 or 8), or a plain scalar loop. The CPU is queried once, on first use, so
+// a binary built for the baseline x86-64 target still uses AVX2 or AVX-512 registers where
+// available.
+//
+// Set the environment variable VEC_FORCE_ISA to scalar, sse2, avx2 or avx512 to override the choice
+// (e.g. to exercise every path on one machine); an instruction set the CPU lacks falls back to the
+// widest one it supports. set_isa() changes the choice at run time.
+//
+// Every lane performs the same operations in the same order as the scalar loop, so all instruction
+// sets produce identical results. Multiplies and adds are not fused into FMA (which AVX-512 always
+// provides) unless the whole build targets FMA; in that case the compiler may fuse the scalar and
+// vector copies differently, so results can differ by rounding between instruction sets (build with
+// -ffp-contract=off to keep them identical). Dispatch covers float and double on x86 with GCC or
+// Clang; other element types and targets use simd::for_each_lane().
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "simd.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define VEC_DISPATCH_X86 1
+#endif
+
+using std::size_t;
+
+namespace vec::dispatch {
+
+// Instruction sets, narrowest first
+enum class Isa : size_t {
+    Scalar,
+    Sse2,
+    Avx2,
+    Avx512,
+};
+
+// Number of instruction sets
+inline constexpr size_t kNumIsas = 4;
+
+// Instruction set names, as accepted by VEC_FORCE_ISA
+inline constexpr std::array<std::string_view, kNumIsas> kIsaNames{
+    "scalar", "sse2", "avx2", "avx512"};
+
+// Whether every instruction set gives bitwise-identical results (see the note above)
+#if defined(__FMA__)
+inline constexpr bool kIdenticalResults = false;
+#else
+inline constexpr bool kIdenticalResults = true;
+#endif
+
+// Whether element type Type is dispatched (otherwise simd::for_each_lane() is used)
+template<typename Type>
+#if defined(VEC_DISPATCH_X86)
+inline constexpr bool kEnabled = std::is_same_v<Type, float> || std::is_same_v<Type, double>;
+#else
+inline constexpr bool kEnabled = false;
+#endif
+
+// Get the name of an instruction set
+constexpr std::string_view isa_name(Isa isa) {
+    return kIsaNames[static_cast<size_t>(isa)];
+}
+
+// Get the instruction set with the given name, if any
+constexpr std::optional<Isa> parse_isa(std::string_view name) {
+    for (size_t i = 0; i < kNumIsas; i++) {
+        if (kIsaNames[i] == name) {
+            return static_cast<Isa>(i);
+        }
+    }
+    return std::nullopt;
+}
+
+// Query the widest instruction set supported by the CPU (and enabled by the OS)
+inline Isa detect_isa() {
+#if defined(VEC_DISPATCH_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return Isa::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return Isa::Avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return Isa::Sse2;
+    }
+#endif
+    return Isa::Scalar;
+}
+
+namespace detail {
+
+// Get the widest supported instruction set, queried on first use
+inline Isa supported_isa() {
+    static const Isa isa = detect_isa();
+    return isa;
+}
+
+// Get the initial instruction set: the widest supported, or VEC_FORCE_ISA if that is narrower
+inline Isa initial_isa() {
+    const char* forced = std::getenv("VEC_FORCE_ISA");
+    const std::optional<Isa> isa = (forced != nullptr) ? parse_isa(forced) : std::nullopt;
+    return isa ? std::min(*isa, supported_isa()) : supported_isa();
+}
+
+// Get the selected instruction set
+inline std::atomic<Isa>& active() {
+    static std::atomic<Isa> isa{initial_isa()};
+    return isa;
+}
+
+} // namespace detail
+
+// Check if the CPU supports an instruction set
+inline bool is_supported(Isa isa) {
+    return isa <= detail::supported_isa();
+}
+
+// Get the instruction set that batch kernels currently use
+inline Isa active_isa() {
+    return detail::active().load(std::memory_order_relaxed);
+}
+
+// Select the instruction set for subsequent batch kernels (for all threads)
+// Returns false, leaving the selection unchanged, if the CPU does not support it
+inline bool set_isa(Isa isa) {
+    if (!is_supported(isa)) {
+        return false;
+    }
+    detail::active().store(isa, std::memory_order_relaxed);
+    return true;
+}
+
+#if defined(VEC_DISPATCH_X86)
+
+/******************************************************************************
+ * WIDE LANES
+ ******************************************************************************/
+
+namespace detail {
+
+// Square roots of one 128-bit register of values
+[[gnu::target("sse2")]] inline void sqrt128(const float* in, float* out) {
+    _mm_storeu_ps(out, _mm_sqrt_ps(_mm_loadu_ps(in)));
+}
+
+[[gnu::target("sse2")]] inline void sqrt128(const double* in, double* out) {
+    _mm_storeu_pd(out, _mm_sqrt_pd(_mm_loadu_pd(in)));
+}
+
+// Square roots of one 256-bit register of values
+[[gnu::target("avx")]] inline void sqrt256(const float* in, float* out) {
+    _mm256_storeu_ps(out, _mm256_sqrt_ps(_mm256_loadu_ps(in)));
+}
+
+[[gnu::target("avx")]] inline void sqrt256(const double* in, double* out) {
+    _mm256_storeu_pd(out, _mm256_sqrt_pd(_mm256_loadu_pd(in)));
+}
+
+// Square roots of one 512-bit register of values
+// Note: the zero-masking forms avoid a spurious -Wmaybe-uninitialized in GCC's _mm512_sqrt_p*()
+[[gnu::target("avx512f")]] inline void sqrt512(const float* in, float* out) {
+    _mm512_storeu_ps(out, _mm512_maskz_sqrt_ps(0xFFFF, _mm512_loadu_ps(in)));
+}
+
+[[gnu::target("avx512f")]] inline void sqrt512(const double* in, double* out) {
+    _mm512_storeu_pd(out, _mm512_maskz_sqrt_pd(0xFF, _mm512_loadu_pd(in)));
+}
+
+} // namespace detail
+
+// W values of Type held in one register of the dispatched instruction set
+// Arithmetic uses vector extensions, which compile to that instruction set inside the dispatched
+// copies of a kernel (and to narrower operations elsewhere, e.g. in unoptimized builds)
+template<typename Type, size_t W>
+struct Wide {
+    typedef Type Reg __attribute__((vector_size(sizeof(Type) * W)));
+    static constexpr size_t kWidth = W;
+
+    Reg reg;
+
+    Wide() = default;
+    // Broadcast s to every lane (adding s to zero instead would turn -0 into +0)
+    explicit Wide(Type s) {
+        for (size_t i = 0; i < W; i++) {
+            reg[i] = s;
+        }
+    }
+
+    static Wide load(const Type* p) {
+        Wide out;
+        std::memcpy(&out.reg, p, sizeof(Reg));
+        return out;
+    }
+
+    void store(Type* p) const { std::memcpy(p, &reg, sizeof(Reg)); }
+
+    friend Wide operator+(const Wide& a, const Wide& b) { return from_reg(a.reg + b.reg); }
+    friend Wide operator-(const Wide& a, const Wide& b) { return from_reg(a.reg - b.reg); }
+    friend Wide operator*(const Wide& a, const Wide& b) { return from_reg(a.reg * b.reg); }
+    friend Wide operator/(const Wide& a, const Wide& b) { return from_reg(a.reg / b.reg); }
+    friend Wide operator-(const Wide& a) { return from_reg(-a.reg); }
+
+    // Square root of every lane
+    friend Wide sqrt(const Wide& a) {
+        Wide out;
+        const Type* in = reinterpret_cast<const Type*>(&a.reg);
+        Type* dst = reinterpret_cast<Type*>(&out.reg);
+        if constexpr (sizeof(Reg) == 16) {
+            detail::sqrt128(in, dst);
+        } else if constexpr (sizeof(Reg) == 32) {
+            detail::sqrt256(in, dst);
+        } else {
+            detail::sqrt512(in, dst);
+        }
+        return out;
+    }
+
+    // Wrap a register (a constructor would not be distinguishable from Wide(Type) in a template)
+    static Wide from_reg(const Reg& r) {
+        Wide out;
+        out.reg = r;
+        return out;
+    }
+};
+
+/******************************************************************************
+ * DISPATCHED LOOPS
+ ******************************************************************************/
+
+// Target attributes of the dispatched copies of a kernel
+// Kernels are inlined into them (flatten) so that the whole loop body uses the instruction set.
+// GCC contracts a * b + c into FMA when AVX-512 is enabled; that is disabled unless the build
+// already targets FMA, so the dispatched copies round like the rest of the program.
+#if defined(__FMA__) || defined(__clang__)
+#define VEC_DISPATCH_TARGET(isa) [[gnu::target(isa), gnu::flatten]]
+#else
+#define VEC_DISPATCH_TARGET(isa) \
+    [[gnu::target(isa), gnu::optimize("fp-contract=off"), gnu::flatten]]
+#endif
+
+namespace detail {
+
+// Invoke kernel.template operator()<Lane>(i) over [first, last), then per element for the tail
+template<typename Lane, typename Type, typename Kernel>
+[[gnu::always_inline]] inline void run_lanes(size_t first, size_t last, Kernel& kernel) {
+    size_t i = first;
+    if constexpr (!std::is_same_v<Lane, Type>) {
+        for (; i + Lane::kWidth <= last; i += Lane::kWidth) {
+            kernel.template operator()<Lane>(i);
+        }
+    }
+    for (; i < last; i++) {
+        kernel.template operator()<Type>(i);
+    }
+}
+
+// Scalar copy of a kernel
+template<typename Type, typename Kernel>
+void run_scalar(size_t first, size_t last, Kernel& kernel) {
+    run_lanes<Type, Type>(first, last, kernel);
+}
+
+// SSE2 copy of a kernel
+template<typename Type, typename Kernel>
+VEC_DISPATCH_TARGET("sse2") void run_sse2(size_t first, size_t last, Kernel& kernel) {
+    run_lanes<Wide<Type, 16 / sizeof(Type)>, Type>(first, last, kernel);
+}
+
+// AVX2 copy of a kernel
+template<typename Type, typename Kernel>
+VEC_DISPATCH_TARGET("avx2") void run_avx2(size_t first, size_t last, Kernel& kernel) {
+    run_lanes<Wide<Type, 32 / sizeof(Type)>, Type>(first, last, kernel);
+}
+
+// AVX-512 copy of a kernel
+template<typename Type, typename Kernel>
+VEC_DISPATCH_TARGET("avx512f") void run_avx512(size_t first, size_t last, Kernel& kernel) {
+    run_lanes<Wide<Type, 64 / sizeof(Type)>, Type>(first, last, kernel);
+}
+
+} // namespace detail
+
+#undef VEC_DISPATCH_TARGET
+
+#endif // VEC_DISPATCH_X86
+
+// Invoke kernel.template operator()<Lane>(i) over [first, last) with the active instruction set
+template<typename Type, typename Kernel>
+inline void for_each_lane(size_t first, size_t last, Kernel&& kernel) {
+#if defined(VEC_DISPATCH_X86)
+    if constexpr (kEnabled<Type>) {
+        // One copy of the kernel per instruction set, indexed by Isa
+        using KernelT = std::remove_reference_t<Kernel>;
+        using Fn = void (*)(size_t, size_t, KernelT&);
+        static constexpr std::array<Fn, kNumIsas> kTable{
+            &detail::run_scalar<Type, KernelT>, &detail::run_sse2<Type, KernelT>,
+            &detail::run_avx2<Type, KernelT>, &detail::run_avx512<Type, KernelT>};
+        kTable[static_cast<size_t>(active_isa())](first, last, kernel);
+    } else {
+        simd::for_each_lane<Type>(first, last, std::forward<Kernel>(kernel));
+    }
+#else
+    simd::for_each_lane<Type>(first, last, std::forward<Kernel>(kernel));
+#endif
+}
+
+// Invoke kernel.template operator()<Lane>(i) over [0, count) with the active instruction set
+template<typename Type, typename Kernel>
+inline void for_each_lane(size_t count, Kernel&& kernel) {
+    for_each_lane<Type>(0, count, std::forward<Kernel>(kernel));
+}
+
+} // namespace vec::dispatch
+
+#if defined(VEC_DISPATCH_X86)
+namespace vec::simd {
+
+template<typename Type, size_t W>
+inline constexpr size_t kLaneWidth<dispatch::Wide<Type, W>> = W;
+
+} // namespace vec::simd
+#endif
@@ -0,0 +1,216 @@
+// Dual quaternion class template definition (rigid transforms in 3D)
+
+#pragma once
+
+#include <iostream>
+
+#include "quat.hpp"
+#include "transform.hpp"
+#include "vec.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Forward declaration
+template<typename Type>
+class DualQuat;
+
+// Aliases for supported types
+using DualQuatf = DualQuat<float>;
+using DualQuatd = DualQuat<double>;
+using DualQuatld = DualQuat<long double>;
+
+// Dual quaternion class template
+// A unit dual quaternion r + e * d represents the rigid transform p' = r.rotate(p) + t, where r is
+// the rotation and the dual part is d = 0.5 * (t, 0) * r. Like Quat, the product a * b applies b
+// first, then a. Conversion to and from AffineTransform<Type, 3> preserves the mapping of points,
+// i.e. transform_point(p) == p * to_affine() (row-vector convention).
+template<typename Type>
+class DualQuat {
+    // Template parameter assertions
+    static_assert(std::is_floating_point_v<Type>, "Type must be floating-point");
+
+    // Type aliases for convenience
+    using DualQuatT = DualQuat<Type>;
+    using QuatT = Quat<Type>;
+    using Vec3T = Vec<Type, 3>;
+
+public:
+    // Construct identity dual quaternion (no rotation, no translation)
+    constexpr DualQuat() : real_(), dual_(0, 0, 0, 0) {}
+
+    // Construct dual quaternion from real and dual parts
+    constexpr DualQuat(const QuatT& real, const QuatT& dual) : real_(real), dual_(dual) {}
+
+    /**************************************************************************
+     * STATIC MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the identity dual quaternion
+    constexpr static DualQuatT identity() {
+        return DualQuatT();
+    }
+
+    // Construct dual quaternion rotating by unit quaternion rotation, then translating
+    constexpr static DualQuatT from_rotation_translation(const QuatT& rotation,
+                                                         const Vec3T& translation) {
+        return {rotation, QuatT(translation, static_cast<Type>(0)) * rotation * static_cast<Type>(0.5)};
+    }
+
+    // Construct dual quaternion for translation only
+    constexpr static DualQuatT from_translation(const Vec3T& translation) {
+        return from_rotation_translation(QuatT::identity(), translation);
+    }
+
+    // Construct dual quaternion from an affine transform with a rotation-only linear part
+    template<Layout L>
+    constexpr static DualQuatT from_affine(const AffineTransform<Type, 3, L>& transform) {
+        return from_rotation_translation(QuatT::from_affine(transform), transform.get_translation());
+    }
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the real part (rotation)
+    constexpr const QuatT& real() const {
+        return real_;
+    }
+
+    // Get the dual part (translation scaled and rotated by the real part)
+    constexpr const QuatT& dual() const {
+        return dual_;
+    }
+
+    // Get the rotation of a unit dual quaternion
+    constexpr const QuatT& rotation() const {
+        return real_;
+    }
+
+    // Get the translation of a unit dual quaternion
+    constexpr Vec3T translation() const {
+        // t = 2 * vector(d * conjugate(r)), expanded to skip the unused scalar part
+        const Vec3T rv = real_.vector();
+        const Vec3T dv = dual_.vector();
+        return (dv * real_.w() - rv * dual_.w() + cross(rv, dv)) * static_cast<Type>(2);
+    }
+
+    // Get normalization of dual quaternion (unit real part)
+    // Note: this is the normalization used by dual quaternion blending; it does not remove the
+    // component of the dual part parallel to the real part
+    [[nodiscard]] constexpr DualQuatT normalize() const {
+        const Type inv_norm = static_cast<Type>(1) / real_.norm();
+        return {real_ * inv_norm, dual_ * inv_norm};
+    }
+
+    // Get the quaternion conjugate of both parts (the inverse of a unit dual quaternion)
+    constexpr DualQuatT conjugate() const {
+        return {real_.conjugate(), dual_.conjugate()};
+    }
+
+    // Get the inverse of a unit dual quaternion
+    constexpr DualQuatT inverse() const {
+        return conjugate();
+    }
+
+    // Apply the rigid transform of a unit dual quaternion to a point
+    constexpr Vec3T transform_point(const Vec3T& p) const {
+        return real_.rotate(p) + translation();
+    }
+
+    // Apply the rotation of a unit dual quaternion to a direction (translation ignored)
+    constexpr Vec3T transform_direction(const Vec3T& v) const {
+        return real_.rotate(v);
+    }
+
+    // Get the affine transform mapping points the same way (p * to_affine() == transform_point(p))
+    template<Layout L = Layout::RowMajor>
+    constexpr AffineTransform<Type, 3, L> to_affine() const {
+        return AffineTransform<Type, 3, L>(real_.template to_mat3<L>().transpose(), translation());
+    }
+
+    /**************************************************************************
+     * MEMBER OPERATORS
+     **************************************************************************/
+
+    // Add dual quaternion to this dual quaternion
+    constexpr DualQuatT& operator+=(const DualQuatT& rhs) {
+        real_ += rhs.real_;
+        dual_ += rhs.dual_;
+        return *this;
+    }
+
+    // Multiply this dual quaternion by scalar
+    constexpr DualQuatT& operator*=(Type rhs) {
+        real_ *= rhs;
+        dual_ *= rhs;
+        return *this;
+    }
+
+    // Multiply this dual quaternion by another dual quaternion
+    constexpr DualQuatT& operator*=(const DualQuatT& rhs) {
+        *this = (*this) * rhs;
+        return *this;
+    }
+
+    /**************************************************************************
+     * FRIEND OPERATORS
+     **************************************************************************/
+
+    // Check equality of two dual quaternions
+    friend constexpr bool operator==(const DualQuatT& lhs, const DualQuatT& rhs) {
+        return approx_eq(lhs, rhs);
+    }
+
+    // Check inequality of two dual quaternions
+    friend constexpr bool operator!=(const DualQuatT& lhs, const DualQuatT& rhs) {
+        return !approx_eq(lhs, rhs);
+    }
+
+    // Add two dual quaternions
+    friend constexpr DualQuatT operator+(const DualQuatT& lhs, const DualQuatT& rhs) {
+        return {lhs.real_ + rhs.real_, lhs.dual_ + rhs.dual_};
+    }
+
+    // Multiply dual quaternion by scalar
+    friend constexpr DualQuatT operator*(const DualQuatT& lhs, Type rhs) {
+        return {lhs.real_ * rhs, lhs.dual_ * rhs};
+    }
+
+    // Multiply dual quaternion by scalar (reverse operand order)
+    friend constexpr DualQuatT operator*(Type lhs, const DualQuatT& rhs) {
+        return rhs * lhs;
+    }
+
+    // Get product of two dual quaternions (transform by rhs, then lhs)
+    friend constexpr DualQuatT operator*(const DualQuatT& lhs, const DualQuatT& rhs) {
+        return {lhs.real_ * rhs.real_, lhs.real_ * rhs.dual_ + lhs.dual_ * rhs.real_};
+    }
+
+    // Stream dual quaternion contents in human-readable form (real, dual)
+    friend std::ostream& operator<<(std::ostream& os, const DualQuatT& rhs) {
+        return os << "(" << rhs.real_ << ", " << rhs.dual_ << ")";
+    }
+
+    /**************************************************************************
+     * FRIEND FUNCTIONS
+     **************************************************************************/
+
+    // Check if two dual quaternions are approximately equal (elementwise)
+    friend constexpr bool approx_eq(const DualQuatT& a, const DualQuatT& b,
+                                    Type epsilon = utils::kFloatEqDefaultEpsilon<Type>,
+                                    Type abs_threshold = utils::kFloatEqDefaultAbsThreshold<Type>) {
+        return approx_eq(a.real_, b.real_, epsilon, abs_threshold)
+               && approx_eq(a.dual_, b.dual_, epsilon, abs_threshold);
+    }
+
+private:
+    // Real part (rotation)
+    QuatT real_;
+
+    // Dual part (0.5 * translation * rotation)
+    QuatT dual_;
+};
+
+} // namespace vec
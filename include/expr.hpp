@@ -0,0 +1,280 @@
+// Lazy expression templates for Vec and Mat elementwise arithmetic (opt-in)
+//
+// Wrapping an operand with lazy() turns the arithmetic it participates in into an expression tree
+// rather than a chain of temporaries. The tree is evaluated element by element in a single loop
+// when it is converted to a Vec or Mat (on initialization or assignment), or when eval() is called:
+//
+//     Vec3f p = lazy(s) + t * lazy(v);   // one pass, no intermediate Vec3f for t * v
+//
+// Supported operations are those that act elementwise: addition, subtraction, negation, and scalar
+// multiplication/division. Each element is computed with the same operations in the same order as
+// the eager operators in vec.hpp and mat.hpp, so results are identical. Plain Vec/Mat operands may
+// be mixed freely with expressions. Lvalue operands are referenced, rvalue operands are copied into
+// the expression, so an expression may outlive the full-expression that created it as long as its
+// named operands do.
+
+#pragma once
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "mat.hpp"
+
+namespace vec::expr {
+
+/******************************************************************************
+ * SHAPES
+ ******************************************************************************/
+
+// Shape of an M-dimensional vector expression (evaluates to Vec<Type, M>)
+template<typename Type, size_t M>
+struct VecShape {
+    using ValueType = Type;
+    using Result = Vec<Type, M>;
+
+    template<typename Expr>
+    static constexpr Result evaluate(const Expr& e) {
+        Result out;
+        for (size_t i = 0; i < M; i++) {
+            out[i] = e(i);
+        }
+        return out;
+    }
+};
+
+// Shape of an MxM matrix expression (evaluates to Mat<Type, M, L>)
+// Note: operands of different layouts have different shapes and cannot be mixed
+template<typename Type, size_t M, Layout L = Layout::RowMajor>
+struct MatShape {
+    using ValueType = Type;
+    using Result = Mat<Type, M, L>;
+
+    template<typename Expr>
+    static constexpr Result evaluate(const Expr& e) {
+        Result out;
+        // Note: inner loop walks the contiguous stored vectors of the result
+        for (size_t a = 0; a < M; a++) {
+            for (size_t b = 0; b < M; b++) {
+                const size_t i = (L == Layout::RowMajor) ? a : b;
+                const size_t j = (L == Layout::RowMajor) ? b : a;
+                out(i, j) = e(i, j);
+            }
+        }
+        return out;
+    }
+};
+
+/******************************************************************************
+ * EXPRESSION NODES
+ ******************************************************************************/
+
+// Tag base shared by all expression nodes
+struct ExprBase {};
+
+// Concepts
+template<typename Type>
+concept IsExpr = std::is_base_of_v<ExprBase, std::remove_cvref_t<Type>>;
+
+// CRTP base providing evaluation for expression nodes of the given shape
+template<typename Derived, typename Shape>
+class Expr : public ExprBase {
+public:
+    using ShapeT = Shape;
+    using ValueType = typename Shape::ValueType;
+    using Result = typename Shape::Result;
+
+    // Evaluate the full expression into a new vector/matrix
+    [[nodiscard]] constexpr Result eval() const {
+        return Shape::evaluate(static_cast<const Derived&>(*this));
+    }
+
+    // Evaluate the full expression on conversion (initialization or assignment)
+    constexpr operator Result() const {
+        return eval();
+    }
+};
+
+// Leaf node wrapping a vector or matrix (by reference for lvalues, by value for rvalues)
+template<typename Operand, typename Shape>
+class Terminal final : public Expr<Terminal<Operand, Shape>, Shape> {
+public:
+    constexpr explicit Terminal(Operand operand) : operand_(std::forward<Operand>(operand)) {}
+
+    // Get vector element i
+    constexpr auto operator()(size_t i) const {
+        return operand_[i];
+    }
+
+    // Get matrix element (i, j)
+    constexpr auto operator()(size_t i, size_t j) const {
+        return operand_(i, j);
+    }
+
+private:
+    Operand operand_;
+};
+
+// Elementwise binary operation on two expressions of the same shape
+template<typename Op, typename L, typename R>
+class Binary final : public Expr<Binary<Op, L, R>, typename L::ShapeT> {
+public:
+    constexpr Binary(L lhs, R rhs) : lhs_(lhs), rhs_(rhs) {}
+
+    template<typename ...Idx>
+    constexpr auto operator()(Idx... idx) const {
+        return Op{}(lhs_(idx...), rhs_(idx...));
+    }
+
+private:
+    L lhs_;
+    R rhs_;
+};
+
+// Elementwise operation between an expression and a scalar (expression on the left)
+template<typename Op, typename E>
+class Scalar final : public Expr<Scalar<Op, E>, typename E::ShapeT> {
+public:
+    constexpr Scalar(E expr, typename E::ValueType scalar) : expr_(expr), scalar_(scalar) {}
+
+    template<typename ...Idx>
+    constexpr auto operator()(Idx... idx) const {
+        return Op{}(expr_(idx...), scalar_);
+    }
+
+private:
+    E expr_;
+    typename E::ValueType scalar_;
+};
+
+// Elementwise negation of an expression
+template<typename E>
+class Negate final : public Expr<Negate<E>, typename E::ShapeT> {
+public:
+    constexpr explicit Negate(E expr) : expr_(expr) {}
+
+    template<typename ...Idx>
+    constexpr auto operator()(Idx... idx) const {
+        return -expr_(idx...);
+    }
+
+private:
+    E expr_;
+};
+
+/******************************************************************************
+ * ENTRY POINTS
+ ******************************************************************************/
+
+// Wrap M-dimensional vector as a lazy expression operand
+template<typename Type, size_t M>
+constexpr auto lazy(const Vec<Type, M>& v) {
+    return Terminal<const Vec<Type, M>&, VecShape<Type, M>>(v);
+}
+
+// Wrap temporary M-dimensional vector as a lazy expression operand (stored by value)
+template<typename Type, size_t M>
+constexpr auto lazy(Vec<Type, M>&& v) {
+    return Terminal<Vec<Type, M>, VecShape<Type, M>>(std::move(v));
+}
+
+// Wrap MxM matrix as a lazy expression operand
+template<typename Type, size_t M, Layout L>
+constexpr auto lazy(const Mat<Type, M, L>& m) {
+    return Terminal<const Mat<Type, M, L>&, MatShape<Type, M, L>>(m);
+}
+
+// Wrap temporary MxM matrix as a lazy expression operand (stored by value)
+template<typename Type, size_t M, Layout L>
+constexpr auto lazy(Mat<Type, M, L>&& m) {
+    return Terminal<Mat<Type, M, L>, MatShape<Type, M, L>>(std::move(m));
+}
+
+// Evaluate an expression into a new vector/matrix
+template<typename E>
+requires IsExpr<E>
+[[nodiscard]] constexpr auto eval(const E& e) {
+    return e.eval();
+}
+
+namespace detail {
+
+// Vector or matrix operand that can be wrapped by lazy()
+template<typename Operand>
+concept IsLazyOperand = requires (Operand&& operand) { lazy(std::forward<Operand>(operand)); };
+
+// Convert an operand (expression, vector, or matrix) into an expression node
+template<typename Operand>
+requires IsExpr<Operand> || IsLazyOperand<Operand>
+constexpr auto as_expr(Operand&& operand) {
+    if constexpr (IsExpr<Operand>) {
+        return std::remove_cvref_t<Operand>(std::forward<Operand>(operand));
+    } else {
+        return lazy(std::forward<Operand>(operand));
+    }
+}
+
+template<typename Operand>
+using ExprOf = decltype(as_expr(std::declval<Operand>()));
+
+// Operand pair for which at least one side is an expression and both sides have the same shape
+template<typename L, typename R>
+concept IsExprPair = (IsExpr<L> || IsExpr<R>)
+                     && requires { as_expr(std::declval<L>()); as_expr(std::declval<R>()); }
+                     && std::is_same_v<typename ExprOf<L>::ShapeT, typename ExprOf<R>::ShapeT>;
+
+} // namespace detail
+
+/******************************************************************************
+ * OPERATORS
+ ******************************************************************************/
+
+// Add two expressions (or an expression and a vector/matrix)
+template<typename L, typename R>
+requires detail::IsExprPair<L, R>
+constexpr auto operator+(L&& lhs, R&& rhs) {
+    using LE = detail::ExprOf<L>;
+    using RE = detail::ExprOf<R>;
+    return Binary<std::plus<>, LE, RE>(detail::as_expr(std::forward<L>(lhs)),
+                                       detail::as_expr(std::forward<R>(rhs)));
+}
+
+// Subtract two expressions (or an expression and a vector/matrix)
+template<typename L, typename R>
+requires detail::IsExprPair<L, R>
+constexpr auto operator-(L&& lhs, R&& rhs) {
+    using LE = detail::ExprOf<L>;
+    using RE = detail::ExprOf<R>;
+    return Binary<std::minus<>, LE, RE>(detail::as_expr(std::forward<L>(lhs)),
+                                        detail::as_expr(std::forward<R>(rhs)));
+}
+
+// Negate an expression
+template<typename E>
+requires IsExpr<E>
+constexpr auto operator-(E&& e) {
+    return Negate<std::remove_cvref_t<E>>(std::forward<E>(e));
+}
+
+// Multiply an expression by a scalar
+template<typename E>
+requires IsExpr<E>
+constexpr auto operator*(E&& e, std::type_identity_t<typename std::remove_cvref_t<E>::ValueType> s) {
+    return Scalar<std::multiplies<>, std::remove_cvref_t<E>>(std::forward<E>(e), s);
+}
+
+// Multiply an expression by a scalar (reverse operand order)
+template<typename E>
+requires IsExpr<E>
+constexpr auto operator*(std::type_identity_t<typename std::remove_cvref_t<E>::ValueType> s, E&& e) {
+    return Scalar<std::multiplies<>, std::remove_cvref_t<E>>(std::forward<E>(e), s);
+}
+
+// Divide an expression by a scalar
+template<typename E>
+requires IsExpr<E>
+constexpr auto operator/(E&& e, std::type_identity_t<typename std::remove_cvref_t<E>::ValueType> s) {
+    return Scalar<std::divides<>, std::remove_cvref_t<E>>(std::forward<E>(e), s);
+}
+
+} // namespace vec::expr
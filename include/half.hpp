@@ -0,0 +1,371 @@
+// Half-precision and bfloat16 storage scalars and compressed-storage vectors
+//
+// Half (IEEE 754 binary16: 11-bit significand, range +/-65504) and BFloat16 (8-bit significand,
+// float range) are 16-bit storage-only scalars: they hold a value's bits and convert to and from
+// float, but have no arithmetic of their own. PackedVec<Storage, M> stores M of them and converts
+// to and from Vec<float, M>, so large arrays of normals, colors or velocities take half the memory
+// (under VEC_ENABLE_SIMD, where Vec3f is padded to 16 bytes, 3D vectors take 6 bytes instead of
+// 16) while all computation stays in float:
+//
+//     std::vector<Vec3h> normals(count);  // 6 bytes per vector
+//     normals[i] = Vec3h(n.normalize());  // round on store
+//     const Vec3f n = normals[i].load();  // exact widening on load
+//
+// Conversions to 16 bits round to nearest, ties to even, overflow to infinity and quiet NaNs; the
+// widening conversions are exact (except that signaling half NaNs widen to quiet NaNs). pack() and
+// unpack() convert whole arrays, 8 values per instruction with F16C when the compiler targets it
+// (e.g. -mf16c or -march=haswell), with results bitwise-identical to the scalar conversions.
+// Compile-time evaluation is supported throughout.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "vec.hpp"
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#define VEC_HALF_F16C 1
+#endif
+
+using std::size_t;
+
+namespace vec {
+
+// Forward declarations
+class Half;
+class BFloat16;
+template<typename Storage, size_t M>
+class PackedVec;
+
+// Aliases for supported types and sizes
+using Vec2h = PackedVec<Half, 2>;
+using Vec3h = PackedVec<Half, 3>;
+using Vec4h = PackedVec<Half, 4>;
+
+using Vec2bf = PackedVec<BFloat16, 2>;
+using Vec3bf = PackedVec<BFloat16, 3>;
+using Vec4bf = PackedVec<BFloat16, 4>;
+
+// Concepts
+template<typename Storage>
+concept IsHalfStorage = std::is_same_v<Storage, Half> || std::is_same_v<Storage, BFloat16>;
+
+// Number of vectors converted per staging block when Vec<float, M> is padded (see pack())
+inline constexpr size_t kPackBlock = 256;
+
+namespace detail {
+
+// Convert float to binary16 bits, rounding to nearest even
+constexpr std::uint16_t float_to_half_bits(float value) {
+    const auto x = std::bit_cast<std::uint32_t>(value);
+    const auto sign = static_cast<std::uint16_t>((x >> 16) & 0x8000U);
+    const std::uint32_t abs = x & 0x7FFFFFFFU;
+    if (abs > 0x7F800000U) {
+        // NaN: keep the top payload bits and set the quiet bit
+        return static_cast<std::uint16_t>(sign | 0x7E00U | ((abs >> 13) & 0x3FFU));
+    }
+    if (abs >= 0x477FF000U) {
+        // At or beyond the midpoint between 65504 and 65536 (or infinite)
+        return static_cast<std::uint16_t>(sign | 0x7C00U);
+    }
+    if (abs < 0x38800000U) {
+        // Below the smallest normal half (2^-14): subnormal or zero
+        if (abs < 0x33000000U) {
+            return sign;
+        }
+        const std::uint32_t shift = 126 - (abs >> 23);
+        const std::uint32_t mantissa = (abs & 0x7FFFFFU) | 0x800000U;
+        std::uint32_t bits = mantissa >> shift;
+        const std::uint32_t rest = mantissa & ((1U << shift) - 1);
+        const std::uint32_t halfway = 1U << (shift - 1);
+        if ((rest > halfway) || ((rest == halfway) && ((bits & 1) != 0))) {
+            bits++;
+        }
+        return static_cast<std::uint16_t>(sign | bits);
+    }
+    // Normal: rebias the exponent, then round off 13 mantissa bits (a carry may bump the exponent)
+    const std::uint32_t rebiased = abs - 0x38000000U;
+    const std::uint32_t bits = (rebiased + 0xFFFU + ((rebiased >> 13) & 1)) >> 13;
+    return static_cast<std::uint16_t>(sign | bits);
+}
+
+// Convert binary16 bits to float (exact)
+constexpr float half_bits_to_float(std::uint16_t bits) {
+    const std::uint32_t sign = static_cast<std::uint32_t>(bits & 0x8000U) << 16;
+    const std::uint32_t exponent = (bits >> 10) & 0x1FU;
+    const std::uint32_t mantissa = bits & 0x3FFU;
+    if (exponent == 0x1F) {
+        // Infinity or NaN (quieted, as by F16C)
+        const std::uint32_t quiet = (mantissa != 0) ? 0x400000U : 0;
+        return std::bit_cast<float>(sign | 0x7F800000U | quiet | (mantissa << 13));
+    }
+    if (exponent == 0) {
+        // Zero or subnormal: mantissa * 2^-24
+        const float magnitude = static_cast<float>(mantissa) * 0x1p-24F;
+        return (sign != 0) ? -magnitude : magnitude;
+    }
+    return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+// Convert float to bfloat16 bits, rounding to nearest even
+constexpr std::uint16_t float_to_bfloat16_bits(float value) {
+    const auto x = std::bit_cast<std::uint32_t>(value);
+    if ((x & 0x7FFFFFFFU) > 0x7F800000U) {
+        // NaN: keep the top payload bits and set the quiet bit
+        return static_cast<std::uint16_t>((x >> 16) | 0x40U);
+    }
+    return static_cast<std::uint16_t>((x + 0x7FFFU + ((x >> 16) & 1)) >> 16);
+}
+
+// Convert bfloat16 bits to float (exact)
+constexpr float bfloat16_bits_to_float(std::uint16_t bits) {
+    return std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16);
+}
+
+} // namespace detail
+
+// IEEE 754 binary16 storage scalar
+class Half {
+public:
+    // Construct positive zero
+    constexpr Half() = default;
+
+    // Construct from float, rounding to nearest even
+    constexpr explicit Half(float value) {
+#if defined(VEC_HALF_F16C)
+        if (!std::is_constant_evaluated()) {
+            bits_ = _cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT);
+            return;
+        }
+#endif
+        bits_ = detail::float_to_half_bits(value);
+    }
+
+    // Construct from raw bits
+    static constexpr Half from_bits(std::uint16_t bits) {
+        Half out;
+        out.bits_ = bits;
+        return out;
+    }
+
+    // Get raw bits
+    constexpr std::uint16_t bits() const {
+        return bits_;
+    }
+
+    // Convert to float (exact)
+    constexpr operator float() const {
+#if defined(VEC_HALF_F16C)
+        if (!std::is_constant_evaluated()) {
+            return _cvtsh_ss(bits_);
+        }
+#endif
+        return detail::half_bits_to_float(bits_);
+    }
+
+private:
+    std::uint16_t bits_{};
+};
+
+// bfloat16 storage scalar (the upper half of a float)
+class BFloat16 {
+public:
+    // Construct positive zero
+    constexpr BFloat16() = default;
+
+    // Construct from float, rounding to nearest even
+    constexpr explicit BFloat16(float value) : bits_(detail::float_to_bfloat16_bits(value)) {}
+
+    // Construct from raw bits
+    static constexpr BFloat16 from_bits(std::uint16_t bits) {
+        BFloat16 out;
+        out.bits_ = bits;
+        return out;
+    }
+
+    // Get raw bits
+    constexpr std::uint16_t bits() const {
+        return bits_;
+    }
+
+    // Convert to float (exact)
+    constexpr operator float() const {
+        return detail::bfloat16_bits_to_float(bits_);
+    }
+
+private:
+    std::uint16_t bits_{};
+};
+
+// Compressed-storage vector class template: M 16-bit scalars, loaded as Vec<float, M> to compute
+template<typename Storage, size_t M>
+class PackedVec {
+    // Template parameter assertions
+    static_assert((M >= 2) && (M <= 4), "Vector size must be 2, 3, or 4");
+    static_assert(IsHalfStorage<Storage>, "Vector storage must be Half or BFloat16");
+
+    // Type aliases for convenience
+    using VecT = Vec<float, M>;
+
+public:
+    // Construct zero vector
+    constexpr PackedVec() = default;
+
+    // Construct from a float vector, rounding each element
+    constexpr explicit PackedVec(const VecT& v) {
+        store(v);
+    }
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get vector size (number of elements)
+    static constexpr size_t size() {
+        return M;
+    }
+
+    // Get pointer to the stored elements
+    constexpr Storage* data() {
+        return elems_.data();
+    }
+
+    // Get const pointer to the stored elements
+    constexpr const Storage* data() const {
+        return elems_.data();
+    }
+
+    // Get the stored element at index
+    constexpr Storage operator[](size_t index) const {
+        assert(index < M);
+        return elems_[index];
+    }
+
+    // Widen to a float vector (exact)
+    constexpr VecT load() const {
+        VecT out;
+        for (size_t i = 0; i < M; i++) {
+            out[i] = static_cast<float>(elems_[i]);
+        }
+        return out;
+    }
+
+    // Store a float vector, rounding each element
+    constexpr void store(const VecT& v) {
+        for (size_t i = 0; i < M; i++) {
+            elems_[i] = Storage(v[i]);
+        }
+    }
+
+    // Widen to a float vector (exact)
+    constexpr explicit operator VecT() const {
+        return load();
+    }
+
+private:
+    std::array<Storage, M> elems_{};
+};
+
+/*** BATCH CONVERSION ***/
+
+// Convert floats to 16-bit storage, rounding to nearest even (out.size() must be >= in.size())
+template<typename Storage>
+requires IsHalfStorage<Storage>
+void pack(std::span<const float> in, std::span<Storage> out) {
+    assert(out.size() >= in.size());
+    size_t i = 0;
+    if constexpr (std::is_same_v<Storage, Half>) {
+#if defined(VEC_HALF_F16C)
+        for (; i + 8 <= in.size(); i += 8) {
+            const __m256 values = _mm256_loadu_ps(&in[i]);
+            const __m128i bits = _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]), bits);
+        }
+#endif
+        for (; i < in.size(); i++) {
+            out[i] = Half(in[i]);
+        }
+    } else {
+        // Integer rounding the compiler can auto-vectorize
+        for (; i < in.size(); i++) {
+            out[i] = BFloat16(in[i]);
+        }
+    }
+}
+
+// Convert 16-bit storage to floats (exact; out.size() must be >= in.size())
+template<typename Storage>
+requires IsHalfStorage<Storage>
+void unpack(std::span<const Storage> in, std::span<float> out) {
+    assert(out.size() >= in.size());
+    size_t i = 0;
+    if constexpr (std::is_same_v<Storage, Half>) {
+#if defined(VEC_HALF_F16C)
+        for (; i + 8 <= in.size(); i += 8) {
+            const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&in[i]));
+            _mm256_storeu_ps(&out[i], _mm256_cvtph_ps(bits));
+        }
+#endif
+    }
+    for (; i < in.size(); i++) {
+        out[i] = static_cast<float>(in[i]);
+    }
+}
+
+// Convert float vectors to compressed-storage vectors (out.size() must be >= in.size())
+// Note: padded vectors (3D under VEC_ENABLE_SIMD) are staged through a dense buffer in blocks
+template<typename Storage, size_t M>
+void pack(std::span<const Vec<float, M>> in, std::span<PackedVec<Storage, M>> out) {
+    static_assert(sizeof(PackedVec<Storage, M>) == M * sizeof(Storage));
+    assert(out.size() >= in.size());
+    if (in.empty()) {
+        return;
+    }
+    const std::span<Storage> elems(reinterpret_cast<Storage*>(out.data()), in.size() * M);
+    if constexpr (sizeof(Vec<float, M>) == M * sizeof(float)) {
+        pack<Storage>({reinterpret_cast<const float*>(in.data()), in.size() * M}, elems);
+    } else {
+        std::array<float, kPackBlock * M> buffer;
+        for (size_t first = 0; first < in.size(); first += kPackBlock) {
+            const size_t count = std::min(kPackBlock, in.size() - first);
+            for (size_t i = 0; i < count; i++) {
+                std::copy_n(in[first + i].cbegin(), M, &buffer[i * M]);
+            }
+            pack<Storage>({buffer.data(), count * M}, elems.subspan(first * M, count * M));
+        }
+    }
+}
+
+// Convert compressed-storage vectors to float vectors (exact; out.size() must be >= in.size())
+// Note: padded vectors (3D under VEC_ENABLE_SIMD) are staged through a dense buffer in blocks
+template<typename Storage, size_t M>
+void unpack(std::span<const PackedVec<Storage, M>> in, std::span<Vec<float, M>> out) {
+    static_assert(sizeof(PackedVec<Storage, M>) == M * sizeof(Storage));
+    assert(out.size() >= in.size());
+    if (in.empty()) {
+        return;
+    }
+    const auto* const first_elem = reinterpret_cast<const Storage*>(in.data());
+    const std::span<const Storage> elems(first_elem, in.size() * M);
+    if constexpr (sizeof(Vec<float, M>) == M * sizeof(float)) {
+        unpack<Storage>(elems, {reinterpret_cast<float*>(out.data()), in.size() * M});
+    } else {
+        std::array<float, kPackBlock * M> buffer;
+        for (size_t first = 0; first < in.size(); first += kPackBlock) {
+            const size_t count = std::min(kPackBlock, in.size() - first);
+            unpack<Storage>(elems.subspan(first * M, count * M), {buffer.data(), count * M});
+            for (size_t i = 0; i < count; i++) {
+                std::copy_n(&buffer[i * M], M, out[first + i].begin());
+            }
+        }
+    }
+}
+
+} // namespace vec
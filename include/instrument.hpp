@@ -0,0 +1,189 @@
+// Operation counters and tracing hooks (opt-in)
+//
+// Define VEC_ENABLE_INSTRUMENTATION (or configure CMake with -DVEC_ENABLE_INSTRUMENTATION=ON) to
+// record every run-time call of the costlier Vec, Mat and AffineTransform operations (see Op):
+// each call increments a per-thread counter and is passed to the trace callback, if one is
+// installed. Also define VEC_INSTRUMENT_FLOPS to accumulate nominal flop counts.
+//
+// Named member functions (normalize(), determinant(), inverse(), ...) then take a defaulted
+// std::source_location parameter, so trace events report the calling line. Operators cannot take
+// one; their events have an empty location, and a callback can capture a stack trace instead.
+//
+// When VEC_ENABLE_INSTRUMENTATION is not defined, the hooks expand to nothing and no signature
+// changes, so generated code is identical to an uninstrumented build. The functions below remain
+// available (counters stay zero and the callback is never called). Compile-time evaluation is
+// never recorded.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+#include <type_traits>
+
+using std::size_t;
+
+namespace vec::instrument {
+
+// Whether operations are recorded
+#if defined(VEC_ENABLE_INSTRUMENTATION)
+inline constexpr bool kEnabled = true;
+#else
+inline constexpr bool kEnabled = false;
+#endif
+
+// Whether flops are accumulated
+#if defined(VEC_ENABLE_INSTRUMENTATION) && defined(VEC_INSTRUMENT_FLOPS)
+inline constexpr bool kFlopsEnabled = true;
+#else
+inline constexpr bool kFlopsEnabled = false;
+#endif
+
+// Recorded operations, in the order of kOpNames
+enum class Op : size_t {
+    Normalize,             // Vec::normalize()
+    NormalizeFast,         // Vec::normalize_fast()
+    Determinant,           // Mat::determinant()
+    Inverse,               // Mat::inverse(), inverse_with_determinant() and try_inverse()
+    MatMul,                // Mat * Mat
+    VecMatMul,             // Vec * Mat
+    MatVecMul,             // Mat * Vec
+    TransformInverse,      // AffineTransform::inverse() and try_inverse()
+    TransformRigidInverse, // AffineTransform::rigid_inverse()
+    TransformCompose,      // AffineTransform * AffineTransform
+};
+
+// Number of recorded operations
+inline constexpr size_t kNumOps = 10;
+
+// Operation names
+inline constexpr std::array<std::string_view, kNumOps> kOpNames{
+    "normalize", "normalize_fast", "determinant", "inverse", "mat_mul", "vec_mat_mul",
+    "mat_vec_mul", "transform_inverse", "transform_rigid_inverse", "transform_compose"};
+
+// Counts of recorded operations (per thread)
+struct Counters {
+    std::array<std::uint64_t, kNumOps> calls{};
+    std::uint64_t flops = 0;
+
+    // Get the number of calls of an operation
+    constexpr std::uint64_t count(Op op) const {
+        return calls[static_cast<size_t>(op)];
+    }
+};
+
+// A recorded operation, as passed to the trace callback
+struct TraceEvent {
+    Op op;
+    std::string_view type; // element type name ("float", "double" or "long double")
+    size_t size;           // vector/matrix dimension (transform dimension for transform ops)
+    std::uint64_t flops;   // nominal flops of this call (0 unless VEC_INSTRUMENT_FLOPS is defined)
+    std::source_location location; // calling line (empty for operators)
+};
+
+// Trace callback, called synchronously on the thread that performed the operation
+using TraceCallback = void (*)(const TraceEvent& event);
+
+namespace detail {
+
+// Get the calling thread's counters
+inline Counters& thread_counters() {
+    static thread_local Counters counters;
+    return counters;
+}
+
+// Get the installed trace callback
+inline std::atomic<TraceCallback>& trace_callback() {
+    static std::atomic<TraceCallback> callback{nullptr};
+    return callback;
+}
+
+// Get the name of an element type
+template<typename Type>
+constexpr std::string_view type_name() {
+    if constexpr (std::is_same_v<Type, float>) {
+        return "float";
+    } else if constexpr (std::is_same_v<Type, double>) {
+        return "double";
+    } else {
+        return "long double";
+    }
+}
+
+// Get the nominal flops (adds, multiplies, divides and square roots) of one call, as implemented
+// Note: transform operations count none of their own; the Mat operations they are built from are
+// recorded separately
+constexpr std::uint64_t flops(Op op, std::uint64_t m) {
+    switch (op) {
+    case Op::Normalize:
+        return 3 * m + 1;
+    case Op::NormalizeFast:
+        return 3 * m;
+    case Op::Determinant:
+        return (m == 2) ? 3 : (m == 3) ? 14 : 47;
+    case Op::Inverse:
+        return (m == 2) ? 8 : (m == 3) ? 42 : 140;
+    case Op::MatMul:
+        return m * m * (2 * m - 1);
+    case Op::VecMatMul:
+    case Op::MatVecMul:
+        return m * (2 * m - 1);
+    default:
+        return 0;
+    }
+}
+
+// Record one run-time call of an operation
+template<typename Type>
+inline void record(Op op, size_t size, const std::source_location& location) {
+    Counters& counters = thread_counters();
+    counters.calls[static_cast<size_t>(op)]++;
+    const std::uint64_t op_flops = kFlopsEnabled ? flops(op, size) : 0;
+    counters.flops += op_flops;
+    const TraceCallback callback = trace_callback().load(std::memory_order_acquire);
+    if (callback != nullptr) {
+        callback(TraceEvent{op, type_name<Type>(), size, op_flops, location});
+    }
+}
+
+} // namespace detail
+
+// Get the calling thread's counters
+inline const Counters& counters() {
+    return detail::thread_counters();
+}
+
+// Reset the calling thread's counters to zero
+inline void reset_counters() {
+    detail::thread_counters() = Counters{};
+}
+
+// Install a trace callback for all threads (nullptr to remove it), returning the previous one
+inline TraceCallback set_trace_callback(TraceCallback callback) {
+    return detail::trace_callback().exchange(callback, std::memory_order_acq_rel);
+}
+
+} // namespace vec::instrument
+
+// Hooks used by the instrumented headers
+// VEC_SOURCE_LOCATION declares the defaulted location parameter of a function taking no other
+// parameters, and VEC_SOURCE_LOCATION_NEXT one following other parameters. VEC_RECORD(op, Type,
+// M, location) records a run-time call.
+#if defined(VEC_ENABLE_INSTRUMENTATION)
+#define VEC_SOURCE_LOCATION std::source_location location = std::source_location::current()
+#define VEC_SOURCE_LOCATION_NEXT , VEC_SOURCE_LOCATION
+#define VEC_RECORD(op, Type, M, location)                                           \
+    do {                                                                            \
+        if (!std::is_constant_evaluated()) {                                        \
+            ::vec::instrument::detail::record<Type>(::vec::instrument::Op::op, M,   \
+                                                    location);                      \
+        }                                                                           \
+    } while (false)
+#else
+#define VEC_SOURCE_LOCATION
+#define VEC_SOURCE_LOCATION_NEXT
+#define VEC_RECORD(op, Type, M, location) ((void)0)
+#endif
@@ -5,16 +5,25 @@
 #include <algorithm>
 #include <array>
 #include <experimental/iterator>
+#include <optional>
 #include <type_traits>
 
+#include "instrument.hpp"
 #include "vec.hpp"
 
 using std::size_t;
 
 namespace vec {
 
+// Storage order of matrix elements
+// Row-major matrices store each row as a contiguous Vec; column-major matrices store each column
+enum class Layout {
+    RowMajor,
+    ColMajor,
+};
+
 // Forward declaration
-template<typename Type, size_t M>
+template<typename Type, size_t M, Layout L = Layout::RowMajor>
 class Mat;
 
 // Aliases for supported types and sizes
@@ -30,56 +39,142 @@ using Mat2ld = Mat<long double, 2>;
 using Mat3ld = Mat<long double, 3>;
 using Mat4ld = Mat<long double, 4>;
 
-// Matrix class template
 template<typename Type, size_t M>
+using ColMat = Mat<Type, M, Layout::ColMajor>;
+
+using ColMat2f = ColMat<float, 2>;
+using ColMat3f = ColMat<float, 3>;
+using ColMat4f = ColMat<float, 4>;
+
+using ColMat2d = ColMat<double, 2>;
+using ColMat3d = ColMat<double, 3>;
+using ColMat4d = ColMat<double, 4>;
+
+using ColMat2ld = ColMat<long double, 2>;
+using ColMat3ld = ColMat<long double, 3>;
+using ColMat4ld = ColMat<long double, 4>;
+
+namespace detail {
+
+// The 2x2 minors of rows 0-1 (s) and rows 2-3 (c) of a 4x4 matrix a, indexed by column pair:
+// s[0] = |a00 a01; a10 a11|, s[1] = cols (0,2), s[2] = (0,3), s[3] = (1,2), s[4] = (1,3), s[5] = (2,3)
+// c[0] = |a20 a21; a30 a31|, ..., c[5] = cols (2,3)
+// Generic over the element type so batch kernels can evaluate the same expressions on SIMD lanes
+template<typename T>
+struct Minors4 {
+    std::array<T, 6> s;
+    std::array<T, 6> c;
+
+    // Compute all minors from an accessor a(i, j)
+    template<typename Accessor>
+    static constexpr Minors4 compute(const Accessor& a) {
+        return {
+            {a(0,0) * a(1,1) - a(1,0) * a(0,1),
+             a(0,0) * a(1,2) - a(1,0) * a(0,2),
+             a(0,0) * a(1,3) - a(1,0) * a(0,3),
+             a(0,1) * a(1,2) - a(1,1) * a(0,2),
+             a(0,1) * a(1,3) - a(1,1) * a(0,3),
+             a(0,2) * a(1,3) - a(1,2) * a(0,3)},
+            {a(2,0) * a(3,1) - a(3,0) * a(2,1),
+             a(2,0) * a(3,2) - a(3,0) * a(2,2),
+             a(2,0) * a(3,3) - a(3,0) * a(2,3),
+             a(2,1) * a(3,2) - a(3,1) * a(2,2),
+             a(2,1) * a(3,3) - a(3,1) * a(2,3),
+             a(2,2) * a(3,3) - a(3,2) * a(2,3)},
+        };
+    }
+
+    // Get the determinant (Laplace expansion along the complementary minors)
+    constexpr T determinant() const {
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+};
+
+} // namespace detail
+
+// Inverse of an MxM matrix together with its determinant
+template<typename Type, size_t M, Layout L>
+struct InverseResult {
+    Mat<Type, M, L> inverse;
+    Type determinant;
+};
+
+// Matrix class template
+// Elements are always addressed as (row, column); the layout only selects how they are stored. The
+// element and row-vector constructors take rows in reading order regardless of layout.
+template<typename Type, size_t M, Layout L>
 class Mat {
     // Template parameter assertions
     static_assert((M >= 2) && (M <= 4), "Matrix size must be 2x2, 3x3, or 4x4");
     static_assert(std::is_floating_point_v<Type>, "Type must be floating-point");
 
     // Type aliases for convenience
-    using MatT = Mat<Type, M>;
+    using MatT = Mat<Type, M, L>;
     using VecT = Vec<Type, M>;
 
+    // Opposite storage order (used by transpose_relayout())
+    static constexpr Layout kTransposedLayout =
+            (L == Layout::RowMajor) ? Layout::ColMajor : Layout::RowMajor;
+    using TransposedMatT = Mat<Type, M, kTransposedLayout>;
+
+    // Whether each stored vector is a row
+    static constexpr bool kRowMajor = (L == Layout::RowMajor);
+
+    // Whether run-time 4x4 products use the SIMD kernels (see simd.hpp)
+    static constexpr bool kSimd = simd::kEnabled<Type, M> && Is4D<M>;
+
+    // Matrices of either layout access each other's storage for transpose_relayout()
+    template<typename, size_t, Layout>
+    friend class Mat;
+
 public:
     // Construct matrix with zero-init elements
     constexpr Mat() : rows_{} {}
 
     // Construct matrix from row vectors (2x2 specialization)
     constexpr Mat(const VecT& v0, const VecT& v1) requires Is2D<M>
-            : rows_{v0, v1} {}
+            : rows_{from_rows({v0, v1})} {}
 
     // Construct matrix from row vectors (3x3 specialization)
     constexpr Mat(const VecT& v0, const VecT& v1, const VecT& v2) requires Is3D<M>
-            : rows_{v0, v1, v2} {}
+            : rows_{from_rows({v0, v1, v2})} {}
 
     // Construct matrix from row vectors (4x4 specialization)
     constexpr Mat(const VecT& v0, const VecT& v1, const VecT& v2, const VecT& v3) requires Is4D<M>
-            : rows_{v0, v1, v2, v3} {}
+            : rows_{from_rows({v0, v1, v2, v3})} {}
 
     // Construct matrix from individual elements (2x2 specialization)
     constexpr Mat(Type e00, Type e01,
                   Type e10, Type e11) requires Is2D<M>
-            : rows_{VecT{e00, e01},
-                    VecT{e10, e11}} {}
+            : rows_{from_rows({VecT{e00, e01},
+                               VecT{e10, e11}})} {}
 
     // Construct matrix from individual elements (3x3 specialization)
     constexpr Mat(Type e00, Type e01, Type e02,
                   Type e10, Type e11, Type e12,
                   Type e20, Type e21, Type e22) requires Is3D<M>
-            : rows_{VecT{e00, e01, e02},
-                    VecT{e10, e11, e12},
-                    VecT{e20, e21, e22}} {}
+            : rows_{from_rows({VecT{e00, e01, e02},
+                               VecT{e10, e11, e12},
+                               VecT{e20, e21, e22}})} {}
 
     // Construct matrix from individual elements (4x4 specialization)
     constexpr Mat(Type e00, Type e01, Type e02, Type e03,
                   Type e10, Type e11, Type e12, Type e13,
                   Type e20, Type e21, Type e22, Type e23,
                   Type e30, Type e31, Type e32, Type e33) requires Is4D<M>
-            : rows_{VecT{e00, e01, e02, e03},
-                    VecT{e10, e11, e12, e13},
-                    VecT{e20, e21, e22, e23},
-                    VecT{e30, e31, e32, e33}} {}
+            : rows_{from_rows({VecT{e00, e01, e02, e03},
+                               VecT{e10, e11, e12, e13},
+                               VecT{e20, e21, e22, e23},
+                               VecT{e30, e31, e32, e33}})} {}
+
+    // Construct matrix from a matrix with the opposite storage order (same elements)
+    constexpr explicit Mat(const TransposedMatT& other) : rows_{} {
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                (*this)(i, j) = other(i, j);
+            }
+        }
+    }
 
     // Construct matrix from another matrix
     template <size_t N>
@@ -130,52 +225,80 @@ public:
 
     // Get reference to element at index (i, j) with bounds checks
     constexpr Type& at(size_t i, size_t j) {
-        return rows_.at(i).at(j);
+        return kRowMajor ? rows_.at(i).at(j) : rows_.at(j).at(i);
     }
 
     // Get read-only reference to element at index (i, j) with bounds checks
     constexpr const Type& at(size_t i, size_t j) const {
-        return rows_.at(i).at(j);
+        return kRowMajor ? rows_.at(i).at(j) : rows_.at(j).at(i);
     }
 
-    // Get reference to row vector at index i with bounds check
+    // Get reference to stored vector at index i (row or column, per layout) with bounds check
     constexpr VecT& at(size_t i) {
         return rows_.at(i);
     }
 
-    // Get read-only reference to row vector at index i with bounds check
+    // Get read-only reference to stored vector at index i (row or column, per layout) with bounds check
     constexpr const VecT& at(size_t i) const {
         return rows_.at(i);
     }
 
-    // Get begin iterator for underlying array of rows
+    // Get copy of row i
+    constexpr VecT row(size_t i) const {
+        if constexpr (kRowMajor) {
+            return rows_[i];
+        } else {
+            VecT out;
+            for (size_t j = 0; j < M; j++) {
+                out[j] = rows_[j][i];
+            }
+            return out;
+        }
+    }
+
+    // Get copy of column j
+    constexpr VecT col(size_t j) const {
+        if constexpr (!kRowMajor) {
+            return rows_[j];
+        } else {
+            VecT out;
+            for (size_t i = 0; i < M; i++) {
+                out[i] = rows_[i][j];
+            }
+            return out;
+        }
+    }
+
+    // Get begin iterator for underlying array of stored vectors (rows or columns, per layout)
     constexpr auto begin() {
         return rows_.begin();
     }
 
-    // Get const begin iterator for underlying array of rows
+    // Get const begin iterator for underlying array of stored vectors
     constexpr auto cbegin() const {
         return rows_.cbegin();
     }
 
-    // Get end iterator for underlying array of rows
+    // Get end iterator for underlying array of stored vectors
     constexpr auto end() {
         return rows_.end();
     }
 
-    // Get const end iterator for underlying array of rows
+    // Get const end iterator for underlying array of stored vectors
     constexpr auto cend() const {
         return rows_.cend();
     }
 
     // Get the matrix determinant (2x2 specialization)
-    constexpr Type determinant() const requires Is2D<M> {
+    constexpr Type determinant(VEC_SOURCE_LOCATION) const requires Is2D<M> {
+        VEC_RECORD(Determinant, Type, M, location);
         const MatT& m = *this;
         return m(0,0) * m(1,1) - m(0,1) * m(1,0);
     }
 
     // Get the matrix determinant (3x3 specialization)
-    constexpr Type determinant() const requires Is3D<M> {
+    constexpr Type determinant(VEC_SOURCE_LOCATION) const requires Is3D<M> {
+        VEC_RECORD(Determinant, Type, M, location);
         const MatT& m = *this;
         return m(0,0) * (m(1,1) * m(2,2) - m(1,2) * m(2,1))
              + m(0,1) * (m(1,2) * m(2,0) - m(1,0) * m(2,2))
@@ -183,86 +306,48 @@ public:
     }
 
     // Get the matrix determinant (4x4 specialization)
-    constexpr Type determinant() const requires Is4D<M> {
-        const MatT& m = *this;
-        return (m(0,3) * m(1,2) * m(2,1) * m(3,0)) - (m(0,2) * m(1,3) * m(2,1) * m(3,0)) -
-               (m(0,3) * m(1,1) * m(2,2) * m(3,0)) + (m(0,1) * m(1,3) * m(2,2) * m(3,0)) +
-               (m(0,2) * m(1,1) * m(2,3) * m(3,0)) - (m(0,1) * m(1,2) * m(2,3) * m(3,0)) -
-               (m(0,3) * m(1,2) * m(2,0) * m(3,1)) + (m(0,2) * m(1,3) * m(2,0) * m(3,1)) +
-               (m(0,3) * m(1,0) * m(2,2) * m(3,1)) - (m(0,0) * m(1,3) * m(2,2) * m(3,1)) -
-               (m(0,2) * m(1,0) * m(2,3) * m(3,1)) + (m(0,0) * m(1,2) * m(2,3) * m(3,1)) +
-               (m(0,3) * m(1,1) * m(2,0) * m(3,2)) - (m(0,1) * m(1,3) * m(2,0) * m(3,2)) -
-               (m(0,3) * m(1,0) * m(2,1) * m(3,2)) + (m(0,0) * m(1,3) * m(2,1) * m(3,2)) +
-               (m(0,1) * m(1,0) * m(2,3) * m(3,2)) - (m(0,0) * m(1,1) * m(2,3) * m(3,2)) -
-               (m(0,2) * m(1,1) * m(2,0) * m(3,3)) + (m(0,1) * m(1,2) * m(2,0) * m(3,3)) +
-               (m(0,2) * m(1,0) * m(2,1) * m(3,3)) - (m(0,0) * m(1,2) * m(2,1) * m(3,3)) -
-               (m(0,1) * m(1,0) * m(2,2) * m(3,3)) + (m(0,0) * m(1,1) * m(2,2) * m(3,3));
-    }
-
-    // Get the MxM inverse of this MxM matrix (2x2 specialization)
-    constexpr MatT inverse() const requires Is2D<M> {
-        // TODO: handle determinant() == 0
-        const MatT& m = *this;
-        return MatT{{m(1,1), -m(0,1)}, {-m(1,0), m(0,0)}} / determinant();
+    // Note: Laplace expansion over the 2x2 minors of rows 0-1 and rows 2-3 (30 multiplies)
+    constexpr Type determinant(VEC_SOURCE_LOCATION) const requires Is4D<M> {
+        VEC_RECORD(Determinant, Type, M, location);
+        return detail::Minors4<Type>::compute(*this).determinant();
+    }
+
+    // Get the MxM inverse of this MxM matrix
+    // Note: a singular matrix yields non-finite elements; use try_inverse() to detect this
+    constexpr MatT inverse(VEC_SOURCE_LOCATION) const {
+        VEC_RECORD(Inverse, Type, M, location);
+        InverseResult<Type, M, L> out;
+        invert<false>(out, static_cast<Type>(0));
+        return out.inverse;
+    }
+
+    // Get the MxM inverse of this MxM matrix along with the determinant (sharing all cofactor work)
+    constexpr InverseResult<Type, M, L> inverse_with_determinant(VEC_SOURCE_LOCATION) const {
+        VEC_RECORD(Inverse, Type, M, location);
+        InverseResult<Type, M, L> out;
+        invert<false>(out, static_cast<Type>(0));
+        return out;
     }
 
-    // Get the MxM inverse of this MxM matrix (3x3 specialization)
-    constexpr MatT inverse() const requires Is3D<M> {
-        const MatT &m = *this;
-
-        const VecT col0 = cross(m[1], m[2]);
-        const VecT col1 = cross(m[2], m[0]);
-        const VecT col2 = cross(m[0], m[1]);
-
-        // TODO: handle determinant() == 0
-        const Type inv_det = static_cast<Type>(1) / dot(col2, m[2]);
-        auto scale = [inv_det](auto elem) { return elem * inv_det; };
-
-        return MatT{{scale(col0.x()), scale(col1.x()), scale(col2.x())},
-                    {scale(col0.y()), scale(col1.y()), scale(col2.y())},
-                    {scale(col0.z()), scale(col1.z()), scale(col2.z())}
-        };
+    // Get the MxM inverse of this MxM matrix, or std::nullopt if |determinant| <= tolerance
+    // Note: the determinant is computed from the same cofactors as the inverse (no extra work)
+    constexpr std::optional<MatT> try_inverse(
+            Type tolerance = utils::kSingularDefaultTolerance<Type>
+            VEC_SOURCE_LOCATION_NEXT) const {
+        VEC_RECORD(Inverse, Type, M, location);
+        InverseResult<Type, M, L> out;
+        if (!invert<true>(out, tolerance)) {
+            return std::nullopt;
+        }
+        return out.inverse;
     }
 
-    // Get the MxM inverse of this MxM matrix (4x4 specialization)
-    constexpr MatT inverse() const requires Is4D<M> {
-        const MatT &m = *this;
-
-        using Vec3T = Vec<Type, 3>;
-        const auto a = Vec3T(m[0]); // 3D <- 4D
-        const auto b = Vec3T(m[1]); // 3D <- 4D
-        const auto c = Vec3T(m[2]); // 3D <- 4D
-        const auto d = Vec3T(m[3]); // 3D <- 4D
-
-        const float x = m(0, 3);
-        const float y = m(1, 3);
-        const float z = m(2, 3);
-        const float w = m(3, 3);
-
-        Vec3T s = cross(a, b);
-        Vec3T t = cross(c, d);
-        Vec3T u = (a * y) - (b * x);
-        Vec3T v = (c * w) - (d * z);
-
-        // TODO: handle determinant() == 0
-        const float inv_det = static_cast<Type>(1) / (dot(s, v) + dot(t, u));
-
-        s *= inv_det;
-        t *= inv_det;
-        u *= inv_det;
-        v *= inv_det;
-
-        const Vec3T col0 = cross(b, v) + (t * y);
-        const Vec3T col1 = cross(v, a) - (t * x);
-        const Vec3T col2 = cross(d, u) + (s * w);
-        const Vec3T col3 = cross(u, c) - (s * z);
-
-        return MatT{
-            {col0.x(), col1.x(), col2.x(), col3.x()},
-            {col0.y(), col1.y(), col2.y(), col3.y()},
-            {col0.z(), col1.z(), col2.z(), col3.z()},
-            {-dot(b, t), dot(a, t), -dot(d, s), dot(c, s)},
-        };
+    // Get a copy of the transpose of this matrix in the opposite storage order
+    // Note: the stored vectors are copied as-is (no element shuffling), unlike transpose()
+    constexpr TransposedMatT transpose_relayout() const {
+        TransposedMatT out;
+        out.rows_ = rows_;
+        return out;
     }
 
     // Get the MxM transpose of this MxM matrix
@@ -292,24 +377,24 @@ public:
      * MEMBER OPERATORS
      **************************************************************************/
 
-    // Get reference to row at index i without bounds checks
+    // Get reference to stored vector at index i (row or column, per layout) without bounds checks
     constexpr VecT& operator[](size_t i) {
         return rows_[i];
     }
 
-    // Get read-only reference to row at index i without bounds checks
+    // Get read-only reference to stored vector at index i without bounds checks
     constexpr const VecT& operator[](size_t i) const {
         return rows_[i];
     }
 
     // Get reference to element at index (i, j) without bounds checks
     constexpr Type& operator()(size_t i, size_t j) {
-        return rows_[i][j];
+        return kRowMajor ? rows_[i][j] : rows_[j][i];
     }
 
     // Get read-only reference to element at index (i, j) without bounds checks
     constexpr const Type& operator()(size_t i, size_t j) const {
-        return rows_[i][j];
+        return kRowMajor ? rows_[i][j] : rows_[j][i];
     }
 
     // Add MxM matrix to this MxM matrix
@@ -413,12 +498,67 @@ public:
     }
 
     // Multiply M-dimensional row vector by MxM matrix
+    // Note: column-major storage holds the transpose, so the kernels swap roles with Mat * Vec
     friend constexpr VecT operator*(const VecT& lhs, const MatT& rhs) {
+        VEC_RECORD(VecMatMul, Type, M, std::source_location{});
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                VecT out;
+                if constexpr (kRowMajor) {
+                    simd::vec4_mat4(&lhs[0], rhs.data(), &out[0]);
+                } else {
+                    simd::mat4_vec4(rhs.data(), &lhs[0], &out[0]);
+                }
+                return out;
+            }
+        }
         VecT out{};
-        for (size_t i = 0; i < M; i++) {
-            // Perform partial accumulation for each element in row
+        if constexpr (kRowMajor) {
+            for (size_t i = 0; i < M; i++) {
+                // Perform partial accumulation for each element in row
+                for (size_t j = 0; j < M; j++) {
+                    out[j] += lhs[i] * rhs(i, j);
+                }
+            }
+        } else {
             for (size_t j = 0; j < M; j++) {
-                out[j] += lhs[i] * rhs(i, j);
+                // Accumulate down each contiguous column
+                for (size_t i = 0; i < M; i++) {
+                    out[j] += lhs[i] * rhs(i, j);
+                }
+            }
+        }
+        return out;
+    }
+
+    // Multiply MxM matrix by M-dimensional column vector
+    friend constexpr VecT operator*(const MatT& lhs, const VecT& rhs) {
+        VEC_RECORD(MatVecMul, Type, M, std::source_location{});
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                VecT out;
+                if constexpr (kRowMajor) {
+                    simd::mat4_vec4(lhs.data(), &rhs[0], &out[0]);
+                } else {
+                    simd::vec4_mat4(&rhs[0], lhs.data(), &out[0]);
+                }
+                return out;
+            }
+        }
+        VecT out{};
+        if constexpr (kRowMajor) {
+            for (size_t i = 0; i < M; i++) {
+                // Accumulate along each contiguous row
+                for (size_t j = 0; j < M; j++) {
+                    out[i] += lhs(i, j) * rhs[j];
+                }
+            }
+        } else {
+            for (size_t j = 0; j < M; j++) {
+                // Perform partial accumulation for each element in column
+                for (size_t i = 0; i < M; i++) {
+                    out[i] += lhs(i, j) * rhs[j];
+                }
             }
         }
         return out;
@@ -426,13 +566,38 @@ public:
 
     // Get MxM product of two MxM matrices
     friend constexpr MatT operator*(const MatT& lhs, const MatT& rhs) {
+        VEC_RECORD(MatMul, Type, M, std::source_location{});
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                // Note: column-major storage holds the transpose, and (AB)^T = B^T A^T
+                MatT out;
+                if constexpr (kRowMajor) {
+                    simd::mat4_mul(lhs.data(), rhs.data(), out.data());
+                } else {
+                    simd::mat4_mul(rhs.data(), lhs.data(), out.data());
+                }
+                return out;
+            }
+        }
         MatT out{}; // zero-init due for direct accumulation
-        for (size_t i = 0; i < M; i++) {
-            // Note: k iteration moved to middle loop to improve locality
-            for (size_t k = 0; k < M; k++) {
-                // Perform partial accumulation for each element in row
-                for (size_t j = 0; j < M; j++) {
-                    out(i, j) += lhs(i, k) * rhs (k, j);
+        if constexpr (kRowMajor) {
+            for (size_t i = 0; i < M; i++) {
+                // Note: k iteration moved to middle loop to improve locality
+                for (size_t k = 0; k < M; k++) {
+                    // Perform partial accumulation for each element in row
+                    for (size_t j = 0; j < M; j++) {
+                        out(i, j) += lhs(i, k) * rhs (k, j);
+                    }
+                }
+            }
+        } else {
+            for (size_t j = 0; j < M; j++) {
+                // Note: k iteration in middle loop so the inner loop walks contiguous columns
+                for (size_t k = 0; k < M; k++) {
+                    // Perform partial accumulation for each element in column
+                    for (size_t i = 0; i < M; i++) {
+                        out(i, j) += lhs(i, k) * rhs (k, j);
+                    }
                 }
             }
         }
@@ -454,7 +619,9 @@ public:
         // TODO: Use iomanip to set print width for consistent column alignment
         auto joiner = std::experimental::make_ostream_joiner(os, "\n ");
         os << "\n[";
-        std::copy(rhs.rows_.cbegin(), rhs.rows_.cend(), joiner);
+        for (size_t i = 0; i < M; i++) {
+            joiner = rhs.row(i);
+        }
         os << "]";
         return os;
     }
@@ -475,8 +642,244 @@ public:
                           row_compare);         // comparison
     }
 
+    // Get a * b + c for MxM matrices, accumulating the product onto c with fused multiply-adds
+    friend constexpr MatT fma(const MatT& a, const MatT& b, const MatT& c) {
+        // The SIMD kernels only round once per step with FMA registers (see simd::kFusedMadd)
+        if constexpr (kSimd && simd::kFusedMadd) {
+            if (!std::is_constant_evaluated()) {
+                // Note: column-major storage holds the transpose, and (AB + C)^T = B^T A^T + C^T
+                MatT out;
+                if constexpr (kRowMajor) {
+                    simd::mat4_mul(a.data(), b.data(), out.data(), c.data());
+                } else {
+                    simd::mat4_mul(b.data(), a.data(), out.data(), c.data());
+                }
+                return out;
+            }
+        }
+        MatT out = c;
+        if constexpr (kRowMajor) {
+            for (size_t i = 0; i < M; i++) {
+                for (size_t k = 0; k < M; k++) {
+                    for (size_t j = 0; j < M; j++) {
+                        out(i, j) = utils::fma(a(i, k), b(k, j), out(i, j));
+                    }
+                }
+            }
+        } else {
+            for (size_t j = 0; j < M; j++) {
+                for (size_t k = 0; k < M; k++) {
+                    for (size_t i = 0; i < M; i++) {
+                        out(i, j) = utils::fma(a(i, k), b(k, j), out(i, j));
+                    }
+                }
+            }
+        }
+        return out;
+    }
+
+    // Get v * m + c for M-dimensional row vectors v and c (e.g. the affine map p * L + t)
+    friend constexpr VecT fma(const VecT& v, const MatT& m, const VecT& c) {
+        if constexpr (kSimd && simd::kFusedMadd) {
+            if (!std::is_constant_evaluated()) {
+                VecT out;
+                if constexpr (kRowMajor) {
+                    simd::vec4_mat4(&v[0], m.data(), &out[0], &c[0]);
+                } else {
+                    simd::mat4_vec4(m.data(), &v[0], &out[0], &c[0]);
+                }
+                return out;
+            }
+        }
+        VecT out = c;
+        if constexpr (kRowMajor) {
+            for (size_t i = 0; i < M; i++) {
+                for (size_t j = 0; j < M; j++) {
+                    out[j] = utils::fma(v[i], m(i, j), out[j]);
+                }
+            }
+        } else {
+            for (size_t j = 0; j < M; j++) {
+                for (size_t i = 0; i < M; i++) {
+                    out[j] = utils::fma(v[i], m(i, j), out[j]);
+                }
+            }
+        }
+        return out;
+    }
+
+    // Get m * v + c for M-dimensional column vectors v and c
+    friend constexpr VecT fma(const MatT& m, const VecT& v, const VecT& c) {
+        if constexpr (kSimd && simd::kFusedMadd) {
+            if (!std::is_constant_evaluated()) {
+                VecT out;
+                if constexpr (kRowMajor) {
+                    simd::mat4_vec4(m.data(), &v[0], &out[0], &c[0]);
+                } else {
+                    simd::vec4_mat4(&v[0], m.data(), &out[0], &c[0]);
+                }
+                return out;
+            }
+        }
+        VecT out = c;
+        if constexpr (kRowMajor) {
+            for (size_t i = 0; i < M; i++) {
+                for (size_t j = 0; j < M; j++) {
+                    out[i] = utils::fma(m(i, j), v[j], out[i]);
+                }
+            }
+        } else {
+            for (size_t j = 0; j < M; j++) {
+                for (size_t i = 0; i < M; i++) {
+                    out[i] = utils::fma(m(i, j), v[j], out[i]);
+                }
+            }
+        }
+        return out;
+    }
+
+    // Get a * s + b elementwise for MxM matrices a and b and scalar s
+    friend constexpr MatT madd(const MatT& a, Type s, const MatT& b) {
+        MatT out;
+        for (size_t i = 0; i < M; i++) {
+            out.rows_[i] = madd(a.rows_[i], s, b.rows_[i]);
+        }
+        return out;
+    }
+
+    // Linearly interpolate between MxM matrices a and b by t (elementwise, exact at t = 0 and 1)
+    friend constexpr MatT lerp(const MatT& a, const MatT& b, Type t) {
+        MatT out;
+        for (size_t i = 0; i < M; i++) {
+            out.rows_[i] = lerp(a.rows_[i], b.rows_[i], t);
+        }
+        return out;
+    }
+
 protected:
-    // Matrix rows
+    // Arrange row vectors (in reading order) into this layout's storage
+    static constexpr std::array<VecT, M> from_rows(const std::array<VecT, M>& rows) {
+        if constexpr (kRowMajor) {
+            return rows;
+        } else {
+            std::array<VecT, M> cols{};
+            for (size_t i = 0; i < M; i++) {
+                for (size_t j = 0; j < M; j++) {
+                    cols[j][i] = rows[i][j];
+                }
+            }
+            return cols;
+        }
+    }
+
+    // Compute inverse and determinant (2x2 specialization)
+    // If kCheck, stop before scaling and return false when |determinant| <= tolerance
+    template<bool kCheck>
+    constexpr bool invert(InverseResult<Type, M, L>& out, Type tolerance) const
+            requires Is2D<M> {
+        const MatT& m = *this;
+        out.determinant = m(0,0) * m(1,1) - m(0,1) * m(1,0);
+        if (kCheck && !(utils::abs(out.determinant) > tolerance)) {
+            return false;
+        }
+
+        const Type inv_det = static_cast<Type>(1) / out.determinant;
+        out.inverse = MatT{ m(1,1) * inv_det, -m(0,1) * inv_det,
+                           -m(1,0) * inv_det,  m(0,0) * inv_det};
+        return true;
+    }
+
+    // Compute inverse and determinant (3x3 specialization)
+    // If kCheck, stop before scaling and return false when |determinant| <= tolerance
+    template<bool kCheck>
+    constexpr bool invert(InverseResult<Type, M, L>& out, Type tolerance) const
+            requires Is3D<M> {
+        const MatT& m = *this;
+
+        // Note: cross products of rows are the columns of the adjugate in either layout
+        const VecT r0 = m.row(0);
+        const VecT r1 = m.row(1);
+        const VecT r2 = m.row(2);
+        const VecT col0 = cross(r1, r2);
+        const VecT col1 = cross(r2, r0);
+        const VecT col2 = cross(r0, r1);
+
+        out.determinant = dot(col2, r2);
+        if (kCheck && !(utils::abs(out.determinant) > tolerance)) {
+            return false;
+        }
+
+        const Type inv_det = static_cast<Type>(1) / out.determinant;
+        auto scale = [inv_det](auto elem) { return elem * inv_det; };
+
+        out.inverse = MatT{{scale(col0.x()), scale(col1.x()), scale(col2.x())},
+                           {scale(col0.y()), scale(col1.y()), scale(col2.y())},
+                           {scale(col0.z()), scale(col1.z()), scale(col2.z())}
+        };
+        return true;
+    }
+
+    // Compute inverse and determinant (4x4 specialization)
+    // If kCheck, stop before scaling and return false when |determinant| <= tolerance
+    template<bool kCheck>
+    constexpr bool invert(InverseResult<Type, M, L>& out, Type tolerance) const
+            requires Is4D<M> {
+        const MatT &m = *this;
+
+        using Vec3T = Vec<Type, 3>;
+        const auto a = Vec3T(m.row(0)); // 3D <- 4D
+        const auto b = Vec3T(m.row(1)); // 3D <- 4D
+        const auto c = Vec3T(m.row(2)); // 3D <- 4D
+        const auto d = Vec3T(m.row(3)); // 3D <- 4D
+
+        const Type x = m(0, 3);
+        const Type y = m(1, 3);
+        const Type z = m(2, 3);
+        const Type w = m(3, 3);
+
+        Vec3T s = cross(a, b);
+        Vec3T t = cross(c, d);
+        Vec3T u = (a * y) - (b * x);
+        Vec3T v = (c * w) - (d * z);
+
+        out.determinant = dot(s, v) + dot(t, u);
+        if (kCheck && !(utils::abs(out.determinant) > tolerance)) {
+            return false;
+        }
+
+        const Type inv_det = static_cast<Type>(1) / out.determinant;
+        s *= inv_det;
+        t *= inv_det;
+        u *= inv_det;
+        v *= inv_det;
+
+        const Vec3T col0 = cross(b, v) + (t * y);
+        const Vec3T col1 = cross(v, a) - (t * x);
+        const Vec3T col2 = cross(d, u) + (s * w);
+        const Vec3T col3 = cross(u, c) - (s * z);
+
+        out.inverse = MatT{
+            {col0.x(), col1.x(), col2.x(), col3.x()},
+            {col0.y(), col1.y(), col2.y(), col3.y()},
+            {col0.z(), col1.z(), col2.z(), col3.z()},
+            {-dot(b, t), dot(a, t), -dot(d, s), dot(c, s)},
+        };
+        return true;
+    }
+
+    // Get pointer to the first of the contiguous stored elements (SIMD kernels only)
+    Type* data() requires kSimd {
+        static_assert(sizeof(VecT) == M * sizeof(Type), "SIMD rows must be tightly packed");
+        return &rows_[0][0];
+    }
+
+    // Get read-only pointer to the first of the contiguous stored elements
+    const Type* data() const requires kSimd {
+        static_assert(sizeof(VecT) == M * sizeof(Type), "SIMD rows must be tightly packed");
+        return &rows_[0][0];
+    }
+
+    // Matrix rows (or columns, if column-major)
     std::array<VecT, M> rows_;
 };
 
@@ -0,0 +1,169 @@
+// Batch determinant and inverse kernels over arrays of 4x4 matrices
+//
+// Each kernel evaluates the shared 2x2-minor formulation (detail::Minors4 in mat.hpp) on SIMD lanes
+// holding the same element of several consecutive matrices, so one pass computes as many
+// determinants or inverses as the widest SIMD register holds (see dispatch.hpp).
+// Inputs are split into chunks that run on a ThreadPool (the shared pool by default). Outputs may
+// alias inputs.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "mat.hpp"
+#include "dispatch.hpp"
+#include "simd.hpp"
+#include "thread_pool.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Number of matrices per parallel chunk
+inline constexpr size_t kMatBatchGrain = size_t{1} << 12;
+
+namespace detail {
+
+// Traits identifying 4x4 matrices of any element type and layout
+template<typename T>
+struct Mat4Traits {
+    static constexpr bool kIsMat4 = false;
+};
+
+template<typename Type, Layout L>
+struct Mat4Traits<Mat<Type, 4, L>> {
+    static constexpr bool kIsMat4 = true;
+    using ValueType = Type;
+};
+
+// Contiguous range of 4x4 matrices (e.g. std::vector<Mat4f>, std::span<const Mat4d>)
+template<typename R>
+concept Mat4Range = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+        && Mat4Traits<std::ranges::range_value_t<R>>::kIsMat4;
+
+// Element type of a range of 4x4 matrices
+template<typename R>
+using Mat4ValueType = typename Mat4Traits<std::ranges::range_value_t<R>>::ValueType;
+
+// Elements (i, j) of kLaneWidth<Lane> consecutive 4x4 matrices, one lane per matrix
+template<typename Lane>
+struct MatLanes4 {
+    std::array<Lane, 16> elems;
+
+    // Load elements of matrices [first, first + kLaneWidth<Lane>)
+    template<typename Type, Layout L>
+    static MatLanes4 gather(const Mat<Type, 4, L>* first) {
+        MatLanes4 out;
+        for (size_t i = 0; i < 4; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                alignas(simd::kLaneWidth<Lane> * sizeof(Type)) Type tmp[simd::kLaneWidth<Lane>];
+                for (size_t l = 0; l < simd::kLaneWidth<Lane>; l++) {
+                    tmp[l] = first[l](i, j);
+                }
+                out.elems[4 * i + j] = simd::load<Lane>(tmp);
+            }
+        }
+        return out;
+    }
+
+    // Store elements to matrices [first, first + kLaneWidth<Lane>)
+    template<typename Type, Layout L>
+    void scatter(Mat<Type, 4, L>* first) const {
+        for (size_t i = 0; i < 4; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                alignas(simd::kLaneWidth<Lane> * sizeof(Type)) Type tmp[simd::kLaneWidth<Lane>];
+                simd::store(tmp, elems[4 * i + j]);
+                for (size_t l = 0; l < simd::kLaneWidth<Lane>; l++) {
+                    first[l](i, j) = tmp[l];
+                }
+            }
+        }
+    }
+
+    // Get element (i, j) lane
+    const Lane& operator()(size_t i, size_t j) const {
+        return elems[4 * i + j];
+    }
+};
+
+// Compute the inverse of a (lanes of) 4x4 matrix from its minors and reciprocal determinant
+template<typename Lane>
+MatLanes4<Lane> inverse4(const MatLanes4<Lane>& a, const Minors4<Lane>& m, const Lane& inv_det) {
+    const auto& s = m.s;
+    const auto& c = m.c;
+    MatLanes4<Lane> out;
+    auto& r = out.elems;
+    r[0]  = ( a(1,1) * c[5] - a(1,2) * c[4] + a(1,3) * c[3]) * inv_det;
+    r[1]  = (-a(0,1) * c[5] + a(0,2) * c[4] - a(0,3) * c[3]) * inv_det;
+    r[2]  = ( a(3,1) * s[5] - a(3,2) * s[4] + a(3,3) * s[3]) * inv_det;
+    r[3]  = (-a(2,1) * s[5] + a(2,2) * s[4] - a(2,3) * s[3]) * inv_det;
+    r[4]  = (-a(1,0) * c[5] + a(1,2) * c[2] - a(1,3) * c[1]) * inv_det;
+    r[5]  = ( a(0,0) * c[5] - a(0,2) * c[2] + a(0,3) * c[1]) * inv_det;
+    r[6]  = (-a(3,0) * s[5] + a(3,2) * s[2] - a(3,3) * s[1]) * inv_det;
+    r[7]  = ( a(2,0) * s[5] - a(2,2) * s[2] + a(2,3) * s[1]) * inv_det;
+    r[8]  = ( a(1,0) * c[4] - a(1,1) * c[2] + a(1,3) * c[0]) * inv_det;
+    r[9]  = (-a(0,0) * c[4] + a(0,1) * c[2] - a(0,3) * c[0]) * inv_det;
+    r[10] = ( a(3,0) * s[4] - a(3,1) * s[2] + a(3,3) * s[0]) * inv_det;
+    r[11] = (-a(2,0) * s[4] + a(2,1) * s[2] - a(2,3) * s[0]) * inv_det;
+    r[12] = (-a(1,0) * c[3] + a(1,1) * c[1] - a(1,2) * c[0]) * inv_det;
+    r[13] = ( a(0,0) * c[3] - a(0,1) * c[1] + a(0,2) * c[0]) * inv_det;
+    r[14] = (-a(3,0) * s[3] + a(3,1) * s[1] - a(3,2) * s[0]) * inv_det;
+    r[15] = ( a(2,0) * s[3] - a(2,1) * s[1] + a(2,2) * s[0]) * inv_det;
+    return out;
+}
+
+} // namespace detail
+
+// Compute the determinant of each 4x4 matrix in the input (any contiguous range of Mat<Type, 4>)
+template<detail::Mat4Range In>
+void batch_determinant(const In& in, std::span<detail::Mat4ValueType<In>> out,
+                       ThreadPool& pool = ThreadPool::shared()) {
+    using Type = detail::Mat4ValueType<In>;
+    const auto* mats = std::ranges::data(in);
+    const size_t count = std::ranges::size(in);
+    assert(count == out.size());
+    pool.parallel_for(count, kMatBatchGrain, [&](size_t first, size_t last) {
+        dispatch::for_each_lane<Type>(first, last, [&]<typename Lane>(size_t i) {
+            const auto a = detail::MatLanes4<Lane>::gather(mats + i);
+            simd::store(&out[i], detail::Minors4<Lane>::compute(a).determinant());
+        });
+    });
+}
+
+// Compute the inverse and the determinant of each 4x4 matrix in the input
+// Note: singular matrices yield non-finite elements; check the determinants to detect them
+template<detail::Mat4Range In>
+void batch_inverse(const In& in, std::span<std::ranges::range_value_t<In>> out,
+                   std::span<detail::Mat4ValueType<In>> determinants,
+                   ThreadPool& pool = ThreadPool::shared()) {
+    using Type = detail::Mat4ValueType<In>;
+    const auto* mats = std::ranges::data(in);
+    const size_t count = std::ranges::size(in);
+    assert(count == out.size());
+    assert(determinants.empty() || (determinants.size() == count));
+    pool.parallel_for(count, kMatBatchGrain, [&](size_t first, size_t last) {
+        dispatch::for_each_lane<Type>(first, last, [&]<typename Lane>(size_t i) {
+            const auto a = detail::MatLanes4<Lane>::gather(mats + i);
+            const auto minors = detail::Minors4<Lane>::compute(a);
+            const Lane det = minors.determinant();
+            if (!determinants.empty()) {
+                simd::store(&determinants[i], det);
+            }
+            detail::inverse4(a, minors, Lane(static_cast<Type>(1)) / det).scatter(&out[i]);
+        });
+    });
+}
+
+// Compute the inverse of each 4x4 matrix in the input
+// Note: singular matrices yield non-finite elements; use the overload above to get determinants
+template<detail::Mat4Range In>
+void batch_inverse(const In& in, std::span<std::ranges::range_value_t<In>> out,
+                   ThreadPool& pool = ThreadPool::shared()) {
+    batch_inverse(in, out, {}, pool);
+}
+
+} // namespace vec
@@ -0,0 +1,341 @@
+// Quantized encodings for unit vectors and rotations
+//
+// OctVec packs a unit Vec3 into 32 bits (4 bytes instead of 12): the vector is projected onto the
+// octahedron |x| + |y| + |z| = 1, whose lower half is folded out over the upper one into the
+// square [-1, 1]^2, and the two square coordinates are stored as 16-bit signed-normalized
+// integers. The decoded vector is renormalized; its angle to the input is below
+// kOctMaxAngularError (about 0.005 degrees).
+//
+// QuantizedQuat packs a unit quaternion into 64 bits (8 bytes instead of 16, or 36 for the
+// equivalent Mat3f) with "smallest three" quantization: since q and -q are the same rotation, the
+// largest-magnitude component can be made positive and recovered from unit length, so only its
+// index (2 bits) and the other three components (each within +/-1/sqrt(2), 20 bits each) are
+// stored. The decoded rotation differs from the input by less than kQuatMaxAngularError (about
+// 0.0003 degrees). Rotation matrices go through Quat::from_mat3() and Quat::to_mat3().
+//
+// The single-value functions are constexpr. The array overloads encode and decode kQuantizeLanes
+// values at a time with the same generic code instantiated for Lanes (see vec_packet.hpp), using
+// select() instead of branches, so each lane performs the same operations as the single-value
+// functions.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "quat.hpp"
+#include "utils.hpp"
+#include "vec.hpp"
+#include "vec_packet.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Unit vector quantized to two 16-bit octahedral coordinates
+struct OctVec {
+    std::int16_t u;
+    std::int16_t v;
+
+    friend constexpr bool operator==(const OctVec&, const OctVec&) = default;
+};
+
+// Unit quaternion quantized with smallest-three encoding
+// Bits 0-1 hold the index of the dropped (largest) component; bits 2-21, 22-41 and 42-61 hold the
+// remaining components in (x, y, z, w) order
+struct QuantizedQuat {
+    std::uint64_t bits;
+
+    friend constexpr bool operator==(const QuantizedQuat&, const QuantizedQuat&) = default;
+};
+
+// Largest octahedral coordinate code (coordinates in [-1, 1] map to [-32767, 32767])
+inline constexpr std::int32_t kOctMax = 32767;
+
+// Bits per quantized quaternion component, and the code of a zero component (components in
+// [-1/sqrt(2), 1/sqrt(2)] map to [0, 2 * kQuatZero])
+inline constexpr unsigned kQuatBits = 20;
+inline constexpr std::int32_t kQuatZero = (std::int32_t{1} << (kQuatBits - 1)) - 1;
+
+// Upper bounds on the angle (radians) between a unit input and its decoded encoding
+inline constexpr double kOctMaxAngularError = 8e-5;
+inline constexpr double kQuatMaxAngularError = 6e-6;
+
+// Number of values encoded or decoded at a time by the array overloads
+inline constexpr size_t kQuantizeLanes = 8;
+
+namespace detail {
+
+// Absolute value of a scalar or of every lane
+template<typename Scalar>
+constexpr Scalar quant_abs(const Scalar& a) {
+    return select(a < Scalar(0), -a, a);
+}
+
+// Square root of a scalar or of every lane
+template<typename Scalar>
+constexpr Scalar quant_sqrt(const Scalar& a) {
+    if constexpr (std::is_floating_point_v<Scalar>) {
+        return utils::sqrt(a);
+    } else {
+        return sqrt(a);
+    }
+}
+
+// -1 for negative values, otherwise +1 (for a scalar or every lane)
+template<typename Type, typename Scalar>
+constexpr Scalar quant_sign(const Scalar& a) {
+    return select(a < Scalar(0), Scalar(static_cast<Type>(-1)), Scalar(static_cast<Type>(1)));
+}
+
+// Round a scaled value to the nearest integer code (ties away from zero)
+template<typename Type>
+constexpr std::int32_t quant_round(Type value) {
+    const Type half = static_cast<Type>(0.5);
+    return static_cast<std::int32_t>((value < 0) ? value - half : value + half);
+}
+
+// Map unit vector (x, y, z) to octahedral square coordinates in [-1, 1]
+template<typename Type, typename Scalar>
+constexpr std::array<Scalar, 2> oct_project(const Scalar& x, const Scalar& y, const Scalar& z) {
+    const Scalar one(static_cast<Type>(1));
+    const Scalar inv_l1 = one / (quant_abs(x) + quant_abs(y) + quant_abs(z));
+    const Scalar u = x * inv_l1;
+    const Scalar v = y * inv_l1;
+    // Fold the lower hemisphere out over the triangles of the square's corners
+    const auto lower = z < Scalar(0);
+    const Scalar folded_u = (one - quant_abs(v)) * quant_sign<Type>(u);
+    const Scalar folded_v = (one - quant_abs(u)) * quant_sign<Type>(v);
+    return {select(lower, folded_u, u), select(lower, folded_v, v)};
+}
+
+// Map octahedral square coordinates in [-1, 1] back to a unit vector (x, y, z)
+template<typename Type, typename Scalar>
+constexpr std::array<Scalar, 3> oct_unproject(const Scalar& u, const Scalar& v) {
+    const Scalar one(static_cast<Type>(1));
+    const Scalar z = one - quant_abs(u) - quant_abs(v);
+    const auto lower = z < Scalar(0);
+    const Scalar x = select(lower, (one - quant_abs(v)) * quant_sign<Type>(u), u);
+    const Scalar y = select(lower, (one - quant_abs(u)) * quant_sign<Type>(v), v);
+    const Scalar inv_norm = one / quant_sqrt(x * x + y * y + z * z);
+    return {x * inv_norm, y * inv_norm, z * inv_norm};
+}
+
+// Get the index of the largest-magnitude component (the first on ties), and the other three
+// components in order, sign-flipped so that the dropped component is positive
+template<typename Type, typename Scalar>
+constexpr std::array<Scalar, 4> quat_smallest_three(const Scalar& x, const Scalar& y,
+                                                    const Scalar& z, const Scalar& w) {
+    Scalar index(static_cast<Type>(0));
+    Scalar largest = x;
+    Scalar largest_abs = quant_abs(x);
+    const std::array<Scalar, 3> rest{y, z, w};
+    for (size_t i = 0; i < 3; i++) {
+        const Scalar candidate = quant_abs(rest[i]);
+        const auto greater = candidate > largest_abs;
+        index = select(greater, Scalar(static_cast<Type>(i + 1)), index);
+        largest = select(greater, rest[i], largest);
+        largest_abs = select(greater, candidate, largest_abs);
+    }
+    const Scalar sign = quant_sign<Type>(largest);
+    const Scalar a = select(index == Scalar(static_cast<Type>(0)), y, x);
+    const Scalar b = select(index <= Scalar(static_cast<Type>(1)), z, y);
+    const Scalar c = select(index <= Scalar(static_cast<Type>(2)), w, z);
+    return {index, a * sign, b * sign, c * sign};
+}
+
+// Rebuild (x, y, z, w) from the dropped component's index and the other three components
+template<typename Type, typename Scalar>
+constexpr std::array<Scalar, 4> quat_from_smallest_three(const Scalar& index, const Scalar& a,
+                                                         const Scalar& b, const Scalar& c) {
+    const Scalar zero(static_cast<Type>(0));
+    const Scalar remainder = Scalar(static_cast<Type>(1)) - a * a - b * b - c * c;
+    const Scalar d = quant_sqrt(select(remainder < zero, zero, remainder));
+    const auto is0 = index == zero;
+    const auto is1 = index == Scalar(static_cast<Type>(1));
+    const auto is2 = index == Scalar(static_cast<Type>(2));
+    const auto le1 = index <= Scalar(static_cast<Type>(1));
+    return {
+            select(is0, d, a),
+            select(is0, a, select(is1, d, b)),
+            select(le1, b, select(is2, d, c)),
+            select(index == Scalar(static_cast<Type>(3)), d, c),
+    };
+}
+
+// Quantize a smallest-three component in [-1/sqrt(2), 1/sqrt(2)] to [0, 2 * kQuatZero]
+template<typename Type>
+constexpr std::uint64_t quat_quantize(Type value) {
+    constexpr Type kScale = static_cast<Type>(1.41421356237309504880L * kQuatZero);
+    const std::int32_t code = quant_round(value * kScale) + kQuatZero;
+    return static_cast<std::uint64_t>(std::clamp<std::int32_t>(code, 0, 2 * kQuatZero));
+}
+
+// Get the component in [-1/sqrt(2), 1/sqrt(2)] of a smallest-three code
+template<typename Type>
+constexpr Type quat_dequantize(std::uint64_t bits, unsigned shift) {
+    constexpr Type kScale = static_cast<Type>(0.70710678118654752440L / kQuatZero);
+    const auto code = static_cast<std::int32_t>((bits >> shift) & ((1U << kQuatBits) - 1));
+    return static_cast<Type>(code - kQuatZero) * kScale;
+}
+
+// Pack the dropped component's index and the three quantized components
+template<typename Type>
+constexpr QuantizedQuat quat_pack(Type index, Type a, Type b, Type c) {
+    return {static_cast<std::uint64_t>(index) | (quat_quantize(a) << 2)
+            | (quat_quantize(b) << (2 + kQuatBits)) | (quat_quantize(c) << (2 + 2 * kQuatBits))};
+}
+
+} // namespace detail
+
+/*** SINGLE VALUES ***/
+
+// Encode unit vector n as octahedral coordinates
+template<typename Type>
+requires utils::IsFloatingPoint<Type>
+constexpr OctVec encode_oct(const Vec<Type, 3>& n) {
+    const auto [u, v] = detail::oct_project<Type>(n.x(), n.y(), n.z());
+    const auto scale = static_cast<Type>(kOctMax);
+    return {static_cast<std::int16_t>(detail::quant_round(u * scale)),
+            static_cast<std::int16_t>(detail::quant_round(v * scale))};
+}
+
+// Decode octahedral coordinates as a unit vector
+template<typename Type = float>
+requires utils::IsFloatingPoint<Type>
+constexpr Vec<Type, 3> decode_oct(OctVec e) {
+    const auto inv_scale = static_cast<Type>(1) / static_cast<Type>(kOctMax);
+    const auto [x, y, z] = detail::oct_unproject<Type>(static_cast<Type>(e.u) * inv_scale,
+                                                       static_cast<Type>(e.v) * inv_scale);
+    return {x, y, z};
+}
+
+// Encode unit quaternion q with smallest-three quantization
+template<typename Type>
+requires utils::IsFloatingPoint<Type>
+constexpr QuantizedQuat encode_quat(const Quat<Type>& q) {
+    const auto [index, a, b, c] = detail::quat_smallest_three<Type>(q.x(), q.y(), q.z(), q.w());
+    return detail::quat_pack(index, a, b, c);
+}
+
+// Decode a smallest-three quantized quaternion (unit length, with a non-negative largest component)
+template<typename Type = float>
+requires utils::IsFloatingPoint<Type>
+constexpr Quat<Type> decode_quat(QuantizedQuat e) {
+    const auto index = static_cast<Type>(e.bits & 3);
+    const auto [x, y, z, w] = detail::quat_from_smallest_three<Type>(
+            index, detail::quat_dequantize<Type>(e.bits, 2),
+            detail::quat_dequantize<Type>(e.bits, 2 + kQuatBits),
+            detail::quat_dequantize<Type>(e.bits, 2 + 2 * kQuatBits));
+    return {x, y, z, w};
+}
+
+/*** ARRAYS ***/
+
+// Encode each unit vector in[i] as out[i] (out.size() must be >= in.size())
+template<typename Type>
+requires IsPacketType<Type>
+void encode_oct(std::span<const Vec<Type, 3>> in, std::span<OctVec> out) {
+    using LanesT = Lanes<Type, kQuantizeLanes>;
+    assert(out.size() >= in.size());
+    size_t first = 0;
+    for (; first + kQuantizeLanes <= in.size(); first += kQuantizeLanes) {
+        LanesT x, y, z;
+        for (size_t i = 0; i < kQuantizeLanes; i++) {
+            x.set(i, in[first + i].x());
+            y.set(i, in[first + i].y());
+            z.set(i, in[first + i].z());
+        }
+        const auto [u, v] = detail::oct_project<Type>(x, y, z);
+        const LanesT scaled_u = u * LanesT(static_cast<Type>(kOctMax));
+        const LanesT scaled_v = v * LanesT(static_cast<Type>(kOctMax));
+        for (size_t i = 0; i < kQuantizeLanes; i++) {
+            out[first + i] = {static_cast<std::int16_t>(detail::quant_round(scaled_u[i])),
+                              static_cast<std::int16_t>(detail::quant_round(scaled_v[i]))};
+        }
+    }
+    for (; first < in.size(); first++) {
+        out[first] = encode_oct(in[first]);
+    }
+}
+
+// Decode each in[i] as unit vector out[i] (out.size() must be >= in.size())
+template<typename Type>
+requires IsPacketType<Type>
+void decode_oct(std::span<const OctVec> in, std::span<Vec<Type, 3>> out) {
+    using LanesT = Lanes<Type, kQuantizeLanes>;
+    assert(out.size() >= in.size());
+    const LanesT inv_scale(static_cast<Type>(1) / static_cast<Type>(kOctMax));
+    size_t first = 0;
+    for (; first + kQuantizeLanes <= in.size(); first += kQuantizeLanes) {
+        LanesT u, v;
+        for (size_t i = 0; i < kQuantizeLanes; i++) {
+            u.set(i, static_cast<Type>(in[first + i].u));
+            v.set(i, static_cast<Type>(in[first + i].v));
+        }
+        const auto [x, y, z] = detail::oct_unproject<Type>(u * inv_scale, v * inv_scale);
+        for (size_t i = 0; i < kQuantizeLanes; i++) {
+            out[first + i] = {x[i], y[i], z[i]};
+        }
+    }
+    for (; first < in.size(); first++) {
+        out[first] = decode_oct<Type>(in[first]);
+    }
+}
+
+// Encode each unit quaternion in[i] as out[i] (out.size() must be >= in.size())
+template<typename Type>
+requires IsPacketType<Type>
+void encode_quat(std::span<const Quat<Type>> in, std::span<QuantizedQuat> out) {
+    using LanesT = Lanes<Type, kQuantizeLanes>;
+    assert(out.size() >= in.size());
+    size_t first = 0;
+    for (; first + kQuantizeLanes <= in.size(); first += kQuantizeLanes) {
+        LanesT x, y, z, w;
+        for (size_t i = 0; i < kQuantizeLanes; i++) {
+            x.set(i, in[first + i].x());
+            y.set(i, in[first + i].y());
+            z.set(i, in[first + i].z());
+            w.set(i, in[first + i].w());
+        }
+        const auto [index, a, b, c] = detail::quat_smallest_three<Type>(x, y, z, w);
+        for (size_t i = 0; i < kQuantizeLanes; i++) {
+            out[first + i] = detail::quat_pack(index[i], a[i], b[i], c[i]);
+        }
+    }
+    for (; first < in.size(); first++) {
+        out[first] = encode_quat(in[first]);
+    }
+}
+
+// Decode each in[i] as unit quaternion out[i] (out.size() must be >= in.size())
+template<typename Type>
+requires IsPacketType<Type>
+void decode_quat(std::span<const QuantizedQuat> in, std::span<Quat<Type>> out) {
+    using LanesT = Lanes<Type, kQuantizeLanes>;
+    assert(out.size() >= in.size());
+    size_t first = 0;
+    for (; first + kQuantizeLanes <= in.size(); first += kQuantizeLanes) {
+        LanesT index, a, b, c;
+        for (size_t i = 0; i < kQuantizeLanes; i++) {
+            const std::uint64_t bits = in[first + i].bits;
+            index.set(i, static_cast<Type>(bits & 3));
+            a.set(i, detail::quat_dequantize<Type>(bits, 2));
+            b.set(i, detail::quat_dequantize<Type>(bits, 2 + kQuatBits));
+            c.set(i, detail::quat_dequantize<Type>(bits, 2 + 2 * kQuatBits));
+        }
+        const auto [x, y, z, w] = detail::quat_from_smallest_three<Type>(index, a, b, c);
+        for (size_t i = 0; i < kQuantizeLanes; i++) {
+            out[first + i] = {x[i], y[i], z[i], w[i]};
+        }
+    }
+    for (; first < in.size(); first++) {
+        out[first] = decode_quat<Type>(in[first]);
+    }
+}
+
+} // namespace vec
@@ -0,0 +1,355 @@
+// Quaternion class template definition (rotations in 3D)
+
+#pragma once
+
+#include <cassert>
+#include <iostream>
+#include <span>
+#include <utility>
+
+#include "mat.hpp"
+#include "transform.hpp"
+#include "vec.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Forward declaration
+template<typename Type>
+class Quat;
+
+// Aliases for supported types
+using Quatf = Quat<float>;
+using Quatd = Quat<double>;
+using Quatld = Quat<long double>;
+
+// Quaternion class template
+// Stored as (x, y, z, w) with vector part (x, y, z) and scalar part w, in a single Vec<Type, 4> (so
+// run-time arithmetic uses the SIMD backend when enabled). Rotation matrices follow the same
+// convention as AffineTransform::rotate_x/y/z: rotate(v) equals to_mat3() * v, and the product a * b
+// rotates by b first, then a. AffineTransform maps row vectors (p * T), so to_affine() and
+// from_affine() use the transposed matrix: p * to_affine() equals rotate(p).
+template<typename Type>
+class Quat {
+    // Template parameter assertions
+    static_assert(std::is_floating_point_v<Type>, "Type must be floating-point");
+
+    // Type aliases for convenience
+    using QuatT = Quat<Type>;
+    using Vec3T = Vec<Type, 3>;
+    using Vec4T = Vec<Type, 4>;
+
+public:
+    // Construct identity quaternion (no rotation)
+    constexpr Quat() : q_{static_cast<Type>(0), static_cast<Type>(0),
+                          static_cast<Type>(0), static_cast<Type>(1)} {}
+
+    // Construct quaternion from individual elements
+    constexpr Quat(Type x, Type y, Type z, Type w) : q_{x, y, z, w} {}
+
+    // Construct quaternion from vector part and scalar part
+    constexpr Quat(const Vec3T& v, Type w) : q_{v.x(), v.y(), v.z(), w} {}
+
+    // Construct quaternion from (x, y, z, w) vector
+    constexpr explicit Quat(const Vec4T& xyzw) : q_{xyzw} {}
+
+    /**************************************************************************
+     * STATIC MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the identity quaternion
+    constexpr static QuatT identity() {
+        return QuatT();
+    }
+
+    // Construct quaternion for counter-clockwise rotation around a unit-length axis in radians
+    constexpr static QuatT from_axis_angle(const Vec3T& unit_axis, Type rad) {
+        const auto [s, c] = utils::sincos(rad / static_cast<Type>(2));
+        return QuatT(unit_axis * s, c);
+    }
+
+    // Construct unit quaternion from a 3x3 rotation matrix (orthonormal, determinant +1)
+    template<Layout L>
+    constexpr static QuatT from_mat3(const Mat<Type, 3, L>& m) {
+        // Note: branch on the largest diagonal term so the divisor stays well away from zero
+        const Type one = static_cast<Type>(1);
+        const Type quarter = static_cast<Type>(0.25);
+        const Type trace = m(0,0) + m(1,1) + m(2,2);
+        if (trace > 0) {
+            const Type s = utils::sqrt(trace + one) * 2;
+            return {(m(2,1) - m(1,2)) / s, (m(0,2) - m(2,0)) / s, (m(1,0) - m(0,1)) / s, quarter * s};
+        } else if ((m(0,0) > m(1,1)) && (m(0,0) > m(2,2))) {
+            const Type s = utils::sqrt(one + m(0,0) - m(1,1) - m(2,2)) * 2;
+            return {quarter * s, (m(0,1) + m(1,0)) / s, (m(0,2) + m(2,0)) / s, (m(2,1) - m(1,2)) / s};
+        } else if (m(1,1) > m(2,2)) {
+            const Type s = utils::sqrt(one + m(1,1) - m(0,0) - m(2,2)) * 2;
+            return {(m(0,1) + m(1,0)) / s, quarter * s, (m(1,2) + m(2,1)) / s, (m(0,2) - m(2,0)) / s};
+        } else {
+            const Type s = utils::sqrt(one + m(2,2) - m(0,0) - m(1,1)) * 2;
+            return {(m(0,2) + m(2,0)) / s, (m(1,2) + m(2,1)) / s, quarter * s, (m(1,0) - m(0,1)) / s};
+        }
+    }
+
+    // Construct unit quaternion performing the same rotation as an affine transform's (rotation-only)
+    // linear part, i.e. rotate(p) == p * transform for zero translation
+    template<Layout L>
+    constexpr static QuatT from_affine(const AffineTransform<Type, 3, L>& transform) {
+        return from_mat3(transform.get_linear_transform().transpose());
+    }
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get element x (vector part)
+    constexpr Type x() const {
+        return q_.x();
+    }
+
+    // Get element y (vector part)
+    constexpr Type y() const {
+        return q_.y();
+    }
+
+    // Get element z (vector part)
+    constexpr Type z() const {
+        return q_.z();
+    }
+
+    // Get element w (scalar part)
+    constexpr Type w() const {
+        return q_.w();
+    }
+
+    // Get the vector part (x, y, z)
+    constexpr Vec3T vector() const {
+        return Vec3T(q_); // 3D <- 4D
+    }
+
+    // Get the elements as an (x, y, z, w) vector
+    constexpr const Vec4T& xyzw() const {
+        return q_;
+    }
+
+    // Get the quaternion norm
+    constexpr Type norm() const {
+        return q_.euclidean();
+    }
+
+    // Get the quaternion norm squared
+    constexpr Type norm2() const {
+        return q_.euclidean2();
+    }
+
+    // Get normalization of quaternion
+    [[nodiscard]] constexpr QuatT normalize() const {
+        return QuatT(q_.normalize());
+    }
+
+    // Get the conjugate (negated vector part)
+    constexpr QuatT conjugate() const {
+        return QuatT(-x(), -y(), -z(), w());
+    }
+
+    // Get the multiplicative inverse (equal to the conjugate for unit quaternions)
+    constexpr QuatT inverse() const {
+        return QuatT(conjugate().q_ / norm2());
+    }
+
+    // Rotate 3D vector v by this unit quaternion without building a matrix
+    constexpr Vec3T rotate(const Vec3T& v) const {
+        // v' = v + 2w(u x v) + 2u x (u x v), with u the vector part
+        const Vec3T u = vector();
+        const Vec3T t = cross(u, v) * static_cast<Type>(2);
+        return v + t * w() + cross(u, t);
+    }
+
+    // Get the 3x3 rotation matrix equivalent to this unit quaternion
+    template<Layout L = Layout::RowMajor>
+    constexpr Mat<Type, 3, L> to_mat3() const {
+        const Type one = static_cast<Type>(1);
+        const Type two = static_cast<Type>(2);
+        const Type xx = x() * x(), yy = y() * y(), zz = z() * z();
+        const Type xy = x() * y(), xz = x() * z(), yz = y() * z();
+        const Type xw = x() * w(), yw = y() * w(), zw = z() * w();
+        return {one - two * (yy + zz), two * (xy - zw),       two * (xz + yw),
+                two * (xy + zw),       one - two * (xx + zz), two * (yz - xw),
+                two * (xz - yw),       two * (yz + xw),       one - two * (xx + yy)};
+    }
+
+    // Get the affine transform performing this rotation on row vectors (zero translation)
+    // Note: the linear part is to_mat3().transpose(), so that p * to_affine() == rotate(p)
+    template<Layout L = Layout::RowMajor>
+    constexpr AffineTransform<Type, 3, L> to_affine() const {
+        return AffineTransform<Type, 3, L>(to_mat3<L>().transpose());
+    }
+
+    /**************************************************************************
+     * MEMBER OPERATORS
+     **************************************************************************/
+
+    // Add quaternion to this quaternion
+    constexpr QuatT& operator+=(const QuatT& rhs) {
+        q_ += rhs.q_;
+        return *this;
+    }
+
+    // Subtract quaternion from this quaternion
+    constexpr QuatT& operator-=(const QuatT& rhs) {
+        q_ -= rhs.q_;
+        return *this;
+    }
+
+    // Multiply this quaternion by scalar
+    constexpr QuatT& operator*=(Type rhs) {
+        q_ *= rhs;
+        return *this;
+    }
+
+    // Multiply this quaternion by another quaternion (Hamilton product)
+    constexpr QuatT& operator*=(const QuatT& rhs) {
+        *this = (*this) * rhs;
+        return *this;
+    }
+
+    // Divide this quaternion by scalar
+    constexpr QuatT& operator/=(Type rhs) {
+        q_ /= rhs;
+        return *this;
+    }
+
+    /**************************************************************************
+     * FRIEND OPERATORS
+     **************************************************************************/
+
+    // Get negation of quaternion (represents the same rotation)
+    friend constexpr QuatT operator-(const QuatT& rhs) {
+        return QuatT(-rhs.q_);
+    }
+
+    // Check equality of two quaternions
+    friend constexpr bool operator==(const QuatT& lhs, const QuatT& rhs) {
+        return approx_eq(lhs, rhs);
+    }
+
+    // Check inequality of two quaternions
+    friend constexpr bool operator!=(const QuatT& lhs, const QuatT& rhs) {
+        return !approx_eq(lhs, rhs);
+    }
+
+    // Add two quaternions
+    friend constexpr QuatT operator+(const QuatT& lhs, const QuatT& rhs) {
+        return QuatT(lhs.q_ + rhs.q_);
+    }
+
+    // Subtract two quaternions
+    friend constexpr QuatT operator-(const QuatT& lhs, const QuatT& rhs) {
+        return QuatT(lhs.q_ - rhs.q_);
+    }
+
+    // Multiply quaternion by scalar
+    friend constexpr QuatT operator*(const QuatT& lhs, Type rhs) {
+        return QuatT(lhs.q_ * rhs);
+    }
+
+    // Multiply quaternion by scalar (reverse operand order)
+    friend constexpr QuatT operator*(Type lhs, const QuatT& rhs) {
+        return rhs * lhs;
+    }
+
+    // Get Hamilton product of two quaternions (rotation by rhs, then lhs)
+    friend constexpr QuatT operator*(const QuatT& lhs, const QuatT& rhs) {
+        const Type x1 = lhs.x(), y1 = lhs.y(), z1 = lhs.z(), w1 = lhs.w();
+        const Type x2 = rhs.x(), y2 = rhs.y(), z2 = rhs.z(), w2 = rhs.w();
+        return {w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+                w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+                w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2,
+                w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2};
+    }
+
+    // Divide quaternion by scalar
+    friend constexpr QuatT operator/(const QuatT& lhs, Type rhs) {
+        return QuatT(lhs.q_ / rhs);
+    }
+
+    // Stream quaternion contents in human-readable form (x, y, z, w)
+    friend std::ostream& operator<<(std::ostream& os, const QuatT& rhs) {
+        return os << rhs.q_;
+    }
+
+    /**************************************************************************
+     * FRIEND FUNCTIONS
+     **************************************************************************/
+
+    // Check if two quaternions are approximately equal (elementwise)
+    friend constexpr bool approx_eq(const QuatT& a, const QuatT& b,
+                                    Type epsilon = utils::kFloatEqDefaultEpsilon<Type>,
+                                    Type abs_threshold = utils::kFloatEqDefaultAbsThreshold<Type>) {
+        return approx_eq(a.q_, b.q_, epsilon, abs_threshold);
+    }
+
+    // Get the 4D dot product of two quaternions
+    friend constexpr Type dot(const QuatT& a, const QuatT& b) {
+        return dot(a.q_, b.q_);
+    }
+
+    // Normalized linear interpolation between unit quaternions a and b (shortest path)
+    // Note: cheaper than slerp() but does not interpolate at constant angular velocity
+    friend constexpr QuatT nlerp(const QuatT& a, const QuatT& b, Type t) {
+        const Type sign = (dot(a, b) < 0) ? static_cast<Type>(-1) : static_cast<Type>(1);
+        return QuatT(a.q_ * (static_cast<Type>(1) - t) + b.q_ * (t * sign)).normalize();
+    }
+
+    // Spherical linear interpolation between unit quaternions a and b (shortest path)
+    friend constexpr QuatT slerp(const QuatT& a, const QuatT& b, Type t) {
+        const auto [wa, wb] = slerp_weights(dot(a, b), t);
+        return QuatT(a.q_ * wa + b.q_ * wb);
+    }
+
+    // Spherical linear interpolation of each pair (a[i], b[i]) by t[i] (outputs may alias inputs)
+    // Note: the per-pair weights are scalar; the blend itself runs on Vec<Type, 4> arithmetic
+    friend void batch_slerp(std::span<const QuatT> a, std::span<const QuatT> b,
+                            std::span<const Type> t, std::span<QuatT> out) {
+        assert((a.size() == b.size()) && (a.size() == t.size()) && (a.size() == out.size()));
+        for (size_t i = 0; i < a.size(); i++) {
+            const auto [wa, wb] = slerp_weights(dot(a[i].q_, b[i].q_), t[i]);
+            out[i].q_ = a[i].q_ * wa + b[i].q_ * wb;
+        }
+    }
+
+    // Spherical linear interpolation of each pair (a[i], b[i]) by the same t
+    friend void batch_slerp(std::span<const QuatT> a, std::span<const QuatT> b,
+                            Type t, std::span<QuatT> out) {
+        assert((a.size() == b.size()) && (a.size() == out.size()));
+        for (size_t i = 0; i < a.size(); i++) {
+            const auto [wa, wb] = slerp_weights(dot(a[i].q_, b[i].q_), t);
+            out[i].q_ = a[i].q_ * wa + b[i].q_ * wb;
+        }
+    }
+
+private:
+    // Get the weights of a and b in slerp(a, b, t) given cos_theta = dot(a, b)
+    // Note: the sign of b's weight selects the shortest path; nearly parallel inputs fall back to
+    // normalized linear weights to avoid dividing by sin(theta) ~ 0
+    static constexpr std::pair<Type, Type> slerp_weights(Type cos_theta, Type t) {
+        constexpr Type kLinearThreshold = static_cast<Type>(0.9995);
+        const Type sign = (cos_theta < 0) ? static_cast<Type>(-1) : static_cast<Type>(1);
+        cos_theta *= sign;
+        if (cos_theta > kLinearThreshold) {
+            const Type wa = static_cast<Type>(1) - t;
+            const Type wb = t;
+            const Type norm = utils::sqrt(wa * wa + wb * wb + 2 * wa * wb * cos_theta);
+            return {wa / norm, sign * wb / norm};
+        }
+        const Type theta = utils::acos(cos_theta);
+        const Type inv_sin_theta = static_cast<Type>(1) / utils::sin(theta);
+        return {utils::sin((static_cast<Type>(1) - t) * theta) * inv_sin_theta,
+                sign * utils::sin(t * theta) * inv_sin_theta};
+    }
+
+    // Quaternion elements (x, y, z, w)
+    Vec4T q_;
+};
+
+} // namespace vec
@@ -0,0 +1,116 @@
+// Encoding of Vec, Mat and AffineTransform values as flat sequences of scalars ("records")
+//
+// Shared by the binary and text I/O headers. A record's scalars are in reading order: the M
+// elements of a Vec, the M rows of a Mat (in either Layout), or the M rows of an AffineTransform's
+// linear part followed by its translation (the constant homogeneous column is omitted).
+
+#pragma once
+
+#include <cstdint>
+
+#include "transform.hpp"
+
+using std::size_t;
+
+namespace vec::io {
+
+// Type of a record
+enum class RecordKind : std::uint8_t {
+    Vec = 1,
+    Mat = 2,
+    AffineTransform = 3,
+};
+
+/******************************************************************************
+ * RECORD TRAITS
+ ******************************************************************************/
+
+// Encoding of a record type as scalars
+template<typename Record>
+struct RecordTraits;
+
+template<typename Type, size_t M>
+struct RecordTraits<Vec<Type, M>> {
+    using Scalar = Type;
+    static constexpr RecordKind kKind = RecordKind::Vec;
+    static constexpr size_t kDim = M;
+    static constexpr size_t kElems = M;
+
+    // Write the scalars of v to out[0], out[stride], ...
+    static void encode(const Vec<Type, M>& v, Type* out, size_t stride) {
+        for (size_t i = 0; i < M; i++) {
+            out[i * stride] = v[i];
+        }
+    }
+
+    // Read a vector from in[0], in[stride], ...
+    static Vec<Type, M> decode(const Type* in, size_t stride) {
+        Vec<Type, M> out;
+        for (size_t i = 0; i < M; i++) {
+            out[i] = in[i * stride];
+        }
+        return out;
+    }
+};
+
+template<typename Type, size_t M, Layout L>
+struct RecordTraits<Mat<Type, M, L>> {
+    using Scalar = Type;
+    static constexpr RecordKind kKind = RecordKind::Mat;
+    static constexpr size_t kDim = M;
+    static constexpr size_t kElems = M * M;
+
+    // Write the scalars of m (in reading order) to out[0], out[stride], ...
+    static void encode(const Mat<Type, M, L>& m, Type* out, size_t stride) {
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                out[(i * M + j) * stride] = m(i, j);
+            }
+        }
+    }
+
+    // Read a matrix (in reading order) from in[0], in[stride], ...
+    static Mat<Type, M, L> decode(const Type* in, size_t stride) {
+        Mat<Type, M, L> out;
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                out(i, j) = in[(i * M + j) * stride];
+            }
+        }
+        return out;
+    }
+};
+
+template<typename Type, size_t M, Layout L>
+struct RecordTraits<AffineTransform<Type, M, L>> {
+    using Scalar = Type;
+    static constexpr RecordKind kKind = RecordKind::AffineTransform;
+    static constexpr size_t kDim = M;
+    static constexpr size_t kElems = (M + 1) * M;
+
+    // Write the linear part rows, then the translation, to out[0], out[stride], ...
+    static void encode(const AffineTransform<Type, M, L>& t, Type* out, size_t stride) {
+        for (size_t i = 0; i <= M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                out[(i * M + j) * stride] = t(i, j);
+            }
+        }
+    }
+
+    // Read the linear part rows, then the translation, from in[0], in[stride], ...
+    static AffineTransform<Type, M, L> decode(const Type* in, size_t stride) {
+        AffineTransform<Type, M, L> out;
+        for (size_t i = 0; i <= M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                out(i, j) = in[(i * M + j) * stride];
+            }
+        }
+        return out;
+    }
+};
+
+// Concepts
+template<typename Record>
+concept IsRecord = requires { RecordTraits<Record>::kKind; };
+
+} // namespace vec::io
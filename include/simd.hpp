@@ -0,0 +1,452 @@
+// SIMD kernels backing Vec storage (opt-in)
+//
+// Define VEC_ENABLE_SIMD (or configure CMake with -DVEC_ENABLE_SIMD=ON) to route run-time Vec
+// arithmetic for 3D/4D float and double vectors through SSE2/AVX registers. 3D vectors are then
+// padded to four elements so they fill a full register. The padding lane is never observable: it is
+// excluded from iteration, comparisons, and reductions.
+//
+// Every kernel performs the same IEEE operations in the same order as the scalar std::transform
+// path, so results are bitwise-identical. Reductions (dot product) multiply lane-wise but sum
+// sequentially to match std::inner_product. Compile-time evaluation never reaches these kernels.
+//
+// The 4x4 matrix kernels accumulate broadcast rows in the same order as the generic Mat loops. When
+// the compiler targets FMA (e.g. -mfma), each multiply-add is fused, so matrix products may then
+// differ from the compile-time result in the last bit. The fma() and madd() kernels always round
+// once like utils::fma(): without FMA registers they call std::fma() per lane.
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "utils.hpp"
+
+#if defined(VEC_ENABLE_SIMD) && defined(__SSE2__)
+#include <immintrin.h>
+#define VEC_SIMD_SSE2 1
+#if defined(__AVX__)
+#define VEC_SIMD_AVX 1
+#endif
+#if defined(__FMA__)
+#define VEC_SIMD_FMA 1
+#endif
+#endif
+
+using std::size_t;
+
+namespace vec::simd {
+
+// Register-level primitives for a 4-lane vector of Type (specialized below when available)
+template<typename Type>
+struct Ops;
+
+// Whether SIMD kernels are available for Vec<Type, M>
+template<typename Type, size_t M>
+inline constexpr bool kEnabled = false;
+
+// Whether Ops::madd() is fused (otherwise it rounds the product and the sum separately)
+#if defined(VEC_SIMD_FMA)
+inline constexpr bool kFusedMadd = true;
+#else
+inline constexpr bool kFusedMadd = false;
+#endif
+
+#if defined(VEC_SIMD_SSE2)
+
+template<>
+struct Ops<float> {
+    using Reg = __m128;
+
+    static Reg load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg r) { _mm_storeu_ps(p, r); }
+    static Reg set1(float s) { return _mm_set1_ps(s); }
+    static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+#if defined(VEC_SIMD_FMA)
+    static Reg madd(Reg a, Reg b, Reg c) { return _mm_fmadd_ps(a, b, c); }
+#else
+    static Reg madd(Reg a, Reg b, Reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+#endif
+    static Reg sqrt(Reg a) { return _mm_sqrt_ps(a); }
+    static Reg rsqrt(Reg a) { return _mm_rsqrt_ps(a); } // Estimate, relative error <= 1.5 * 2^-12
+    static Reg neg(Reg a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0F)); }
+    static Reg abs(Reg a) { return _mm_andnot_ps(_mm_set1_ps(-0.0F), a); }
+    static Reg min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+    static Reg cmp_eq(Reg a, Reg b) { return _mm_cmpeq_ps(a, b); }
+    static Reg cmp_lt(Reg a, Reg b) { return _mm_cmplt_ps(a, b); }
+    static Reg bit_or(Reg a, Reg b) { return _mm_or_ps(a, b); }
+    static int movemask(Reg a) { return _mm_movemask_ps(a); }
+    static void transpose(Reg& r0, Reg& r1, Reg& r2, Reg& r3) { _MM_TRANSPOSE4_PS(r0, r1, r2, r3); }
+};
+
+template<>
+struct Ops<double> {
+#if defined(VEC_SIMD_AVX)
+    using Reg = __m256d;
+
+    static Reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, Reg r) { _mm256_storeu_pd(p, r); }
+    static Reg set1(double s) { return _mm256_set1_pd(s); }
+    static Reg add(Reg a, Reg b) { return _mm256_add_pd(a, b); }
+    static Reg sub(Reg a, Reg b) { return _mm256_sub_pd(a, b); }
+    static Reg mul(Reg a, Reg b) { return _mm256_mul_pd(a, b); }
+    static Reg div(Reg a, Reg b) { return _mm256_div_pd(a, b); }
+#if defined(VEC_SIMD_FMA)
+    static Reg madd(Reg a, Reg b, Reg c) { return _mm256_fmadd_pd(a, b, c); }
+#else
+    static Reg madd(Reg a, Reg b, Reg c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+#endif
+    static Reg sqrt(Reg a) { return _mm256_sqrt_pd(a); }
+    static Reg neg(Reg a) { return _mm256_xor_pd(a, _mm256_set1_pd(-0.0)); }
+    static Reg abs(Reg a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_pd(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_pd(a, b); }
+    static Reg cmp_eq(Reg a, Reg b) { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    static Reg cmp_lt(Reg a, Reg b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static Reg bit_or(Reg a, Reg b) { return _mm256_or_pd(a, b); }
+    static int movemask(Reg a) { return _mm256_movemask_pd(a); }
+    static void transpose(Reg& r0, Reg& r1, Reg& r2, Reg& r3) {
+        const Reg t0 = _mm256_unpacklo_pd(r0, r1);
+        const Reg t1 = _mm256_unpackhi_pd(r0, r1);
+        const Reg t2 = _mm256_unpacklo_pd(r2, r3);
+        const Reg t3 = _mm256_unpackhi_pd(r2, r3);
+        r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+        r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+        r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+        r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+    }
+#else
+    // Without AVX, four doubles are held as a pair of SSE2 registers
+    struct Reg {
+        __m128d lo;
+        __m128d hi;
+    };
+
+    template<typename Op>
+    static Reg apply(Reg a, Reg b, Op op) { return {op(a.lo, b.lo), op(a.hi, b.hi)}; }
+
+    static Reg load(const double* p) { return {_mm_loadu_pd(p), _mm_loadu_pd(p + 2)}; }
+    static void store(double* p, Reg r) { _mm_storeu_pd(p, r.lo); _mm_storeu_pd(p + 2, r.hi); }
+    static Reg set1(double s) { return {_mm_set1_pd(s), _mm_set1_pd(s)}; }
+    static Reg add(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_add_pd(x, y); }); }
+    static Reg sub(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_sub_pd(x, y); }); }
+    static Reg mul(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_mul_pd(x, y); }); }
+    static Reg div(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_div_pd(x, y); }); }
+#if defined(VEC_SIMD_FMA)
+    static Reg madd(Reg a, Reg b, Reg c) { return {_mm_fmadd_pd(a.lo, b.lo, c.lo), _mm_fmadd_pd(a.hi, b.hi, c.hi)}; }
+#else
+    static Reg madd(Reg a, Reg b, Reg c) { return add(mul(a, b), c); }
+#endif
+    static Reg sqrt(Reg a) { return {_mm_sqrt_pd(a.lo), _mm_sqrt_pd(a.hi)}; }
+    static Reg neg(Reg a) { return apply(a, set1(-0.0), [](auto x, auto y) { return _mm_xor_pd(x, y); }); }
+    static Reg abs(Reg a) { return apply(set1(-0.0), a, [](auto x, auto y) { return _mm_andnot_pd(x, y); }); }
+    static Reg min(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_min_pd(x, y); }); }
+    static Reg max(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_max_pd(x, y); }); }
+    static Reg cmp_eq(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_cmpeq_pd(x, y); }); }
+    static Reg cmp_lt(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_cmplt_pd(x, y); }); }
+    static Reg bit_or(Reg a, Reg b) { return apply(a, b, [](auto x, auto y) { return _mm_or_pd(x, y); }); }
+    static int movemask(Reg a) { return _mm_movemask_pd(a.lo) | (_mm_movemask_pd(a.hi) << 2); }
+    static void transpose(Reg& r0, Reg& r1, Reg& r2, Reg& r3) {
+        const Reg c0{_mm_unpacklo_pd(r0.lo, r1.lo), _mm_unpacklo_pd(r2.lo, r3.lo)};
+        const Reg c1{_mm_unpackhi_pd(r0.lo, r1.lo), _mm_unpackhi_pd(r2.lo, r3.lo)};
+        const Reg c2{_mm_unpacklo_pd(r0.hi, r1.hi), _mm_unpacklo_pd(r2.hi, r3.hi)};
+        const Reg c3{_mm_unpackhi_pd(r0.hi, r1.hi), _mm_unpackhi_pd(r2.hi, r3.hi)};
+        r0 = c0;
+        r1 = c1;
+        r2 = c2;
+        r3 = c3;
+    }
+#endif
+};
+
+template<> inline constexpr bool kEnabled<float, 3> = true;
+template<> inline constexpr bool kEnabled<float, 4> = true;
+template<> inline constexpr bool kEnabled<double, 3> = true;
+template<> inline constexpr bool kEnabled<double, 4> = true;
+
+#endif // VEC_SIMD_SSE2
+
+// Number of elements allocated for Vec<Type, M> (3D vectors are padded when SIMD is enabled)
+template<typename Type, size_t M>
+inline constexpr size_t kStorageSize = kEnabled<Type, M> ? 4 : M;
+
+// Alignment of Vec<Type, M> storage (one full register when SIMD is enabled)
+template<typename Type, size_t M>
+inline constexpr size_t kAlignment = kEnabled<Type, M> ? 4 * sizeof(Type) : alignof(Type);
+
+/******************************************************************************
+ * KERNELS
+ *
+ * Each kernel operates on 4-element storage. Only instantiated when kEnabled.
+ ******************************************************************************/
+
+// out = a + b
+template<typename Type>
+inline void add(const Type* a, const Type* b, Type* out) {
+    using O = Ops<Type>;
+    O::store(out, O::add(O::load(a), O::load(b)));
+}
+
+// out = a - b
+template<typename Type>
+inline void sub(const Type* a, const Type* b, Type* out) {
+    using O = Ops<Type>;
+    O::store(out, O::sub(O::load(a), O::load(b)));
+}
+
+// out = a * s
+template<typename Type>
+inline void scale(const Type* a, Type s, Type* out) {
+    using O = Ops<Type>;
+    O::store(out, O::mul(O::load(a), O::set1(s)));
+}
+
+// out = a / s
+template<typename Type>
+inline void div(const Type* a, Type s, Type* out) {
+    using O = Ops<Type>;
+    O::store(out, O::div(O::load(a), O::set1(s)));
+}
+
+// out = -a
+template<typename Type>
+inline void neg(const Type* a, Type* out) {
+    using O = Ops<Type>;
+    O::store(out, O::neg(O::load(a)));
+}
+
+// out = a * b + c, rounded once like utils::fma()
+template<typename Type>
+inline void fma(const Type* a, const Type* b, const Type* c, Type* out) {
+    if constexpr (kFusedMadd) {
+        using O = Ops<Type>;
+        O::store(out, O::madd(O::load(a), O::load(b), O::load(c)));
+    } else {
+        for (size_t i = 0; i < 4; i++) {
+            out[i] = std::fma(a[i], b[i], c[i]);
+        }
+    }
+}
+
+// out = a * s + b, rounded once like utils::fma()
+template<typename Type>
+inline void madd(const Type* a, Type s, const Type* b, Type* out) {
+    if constexpr (kFusedMadd) {
+        using O = Ops<Type>;
+        O::store(out, O::madd(O::load(a), O::set1(s), O::load(b)));
+    } else {
+        for (size_t i = 0; i < 4; i++) {
+            out[i] = std::fma(a[i], s, b[i]);
+        }
+    }
+}
+
+// Dot product of the first M lanes (lane-wise multiply, sequential sum like std::inner_product)
+template<typename Type, size_t M>
+inline Type dot(const Type* a, const Type* b) {
+    using O = Ops<Type>;
+    alignas(4 * sizeof(Type)) Type products[4];
+    O::store(products, O::mul(O::load(a), O::load(b)));
+    Type out = static_cast<Type>(0);
+    for (size_t i = 0; i < M; i++) {
+        out = out + products[i];
+    }
+    return out;
+}
+
+// Approximate equality of the first M lanes (same predicate as utils::floating_point_eq)
+template<typename Type, size_t M>
+inline bool approx_eq(const Type* a, const Type* b, Type epsilon, Type abs_threshold) {
+    assert(epsilon >= std::numeric_limits<Type>::epsilon());
+    assert(epsilon < static_cast<Type>(1));
+
+    using O = Ops<Type>;
+    const auto va = O::load(a);
+    const auto vb = O::load(b);
+    const auto diff = O::abs(O::sub(va, vb));
+    const auto norm = O::min(O::set1(std::numeric_limits<Type>::max()), O::abs(O::add(va, vb)));
+    const auto bound = O::max(O::mul(O::set1(epsilon), norm), O::set1(abs_threshold));
+    const auto eq = O::bit_or(O::cmp_eq(va, vb), O::cmp_lt(diff, bound));
+
+    constexpr int kLaneMask = (1 << M) - 1;
+    return (O::movemask(eq) & kLaneMask) == kLaneMask;
+}
+
+// out = v * m (+ c) for a 4D row vector v and row-major 4x4 matrix m (16 contiguous elements)
+// Each output lane accumulates v[k] * m[k][j] over k, starting from zero (or c) like the generic loop
+template<typename Type>
+inline void vec4_mat4(const Type* v, const Type* m, Type* out, const Type* c = nullptr) {
+    using O = Ops<Type>;
+    auto acc = c ? O::load(c) : O::set1(static_cast<Type>(0));
+    for (size_t k = 0; k < 4; k++) {
+        acc = O::madd(O::set1(v[k]), O::load(m + 4 * k), acc);
+    }
+    O::store(out, acc);
+}
+
+// out = m * v (+ c) for a row-major 4x4 matrix m and 4D column vector v
+// The matrix is transposed in registers so that each output lane accumulates m[i][k] * v[k] over k
+template<typename Type>
+inline void mat4_vec4(const Type* m, const Type* v, Type* out, const Type* c = nullptr) {
+    using O = Ops<Type>;
+    auto c0 = O::load(m);
+    auto c1 = O::load(m + 4);
+    auto c2 = O::load(m + 8);
+    auto c3 = O::load(m + 12);
+    O::transpose(c0, c1, c2, c3);
+    auto acc = c ? O::load(c) : O::set1(static_cast<Type>(0));
+    acc = O::madd(c0, O::set1(v[0]), acc);
+    acc = O::madd(c1, O::set1(v[1]), acc);
+    acc = O::madd(c2, O::set1(v[2]), acc);
+    acc = O::madd(c3, O::set1(v[3]), acc);
+    O::store(out, acc);
+}
+
+// out = a * b (+ c) for row-major 4x4 matrices (16 contiguous elements each; out must not alias)
+// Row i of the product is the combination of b's rows weighted by broadcast elements of a's row i
+template<typename Type>
+inline void mat4_mul(const Type* a, const Type* b, Type* out, const Type* c = nullptr) {
+    using O = Ops<Type>;
+    const auto b0 = O::load(b);
+    const auto b1 = O::load(b + 4);
+    const auto b2 = O::load(b + 8);
+    const auto b3 = O::load(b + 12);
+    for (size_t i = 0; i < 4; i++) {
+        const Type* row = a + 4 * i;
+        auto acc = c ? O::load(c + 4 * i) : O::set1(static_cast<Type>(0));
+        acc = O::madd(O::set1(row[0]), b0, acc);
+        acc = O::madd(O::set1(row[1]), b1, acc);
+        acc = O::madd(O::set1(row[2]), b2, acc);
+        acc = O::madd(O::set1(row[3]), b3, acc);
+        O::store(out + 4 * i, acc);
+    }
+}
+
+/******************************************************************************
+ * LANES
+ *
+ * Batch kernels (e.g. VecArray) are written once against a generic "lane" type and instantiated
+ * for a full register (Pack<Type>) and for a single scalar (Type, used for tails and whenever SIMD
+ * is disabled). Lane arithmetic is exactly the corresponding scalar arithmetic per element.
+ ******************************************************************************/
+
+// Four values of Type held in one SIMD register (only usable when kEnabled<Type, 4>)
+template<typename Type>
+struct Pack {
+    using O = Ops<Type>;
+    static constexpr size_t kWidth = 4;
+
+    typename O::Reg reg;
+
+    Pack() = default;
+    explicit Pack(typename O::Reg r) : reg(r) {}
+    explicit Pack(Type s) : reg(O::set1(s)) {}
+
+    static Pack load(const Type* p) { return Pack(O::load(p)); }
+    void store(Type* p) const { O::store(p, reg); }
+
+    friend Pack operator+(Pack a, Pack b) { return Pack(O::add(a.reg, b.reg)); }
+    friend Pack operator-(Pack a, Pack b) { return Pack(O::sub(a.reg, b.reg)); }
+    friend Pack operator*(Pack a, Pack b) { return Pack(O::mul(a.reg, b.reg)); }
+    friend Pack operator/(Pack a, Pack b) { return Pack(O::div(a.reg, b.reg)); }
+    friend Pack operator-(Pack a) { return Pack(O::neg(a.reg)); }
+    friend Pack sqrt(Pack a) { return Pack(O::sqrt(a.reg)); }
+
+    // Approximate reciprocal square root, same error bound as utils::rsqrt_fast()
+    friend Pack rsqrt_fast(Pack a) {
+        if constexpr (std::is_same_v<Type, float>) {
+            // Lanes outside the positive normal range take the scalar path (see utils::rsqrt_fast())
+            const auto out_of_range = O::bit_or(
+                    O::cmp_lt(a.reg, O::set1(std::numeric_limits<float>::min())),
+                    O::cmp_lt(O::set1(std::numeric_limits<float>::max()), a.reg));
+            if (O::movemask(out_of_range) != 0) {
+                alignas(4 * sizeof(Type)) Type lanes[kWidth];
+                a.store(lanes);
+                for (Type& lane : lanes) {
+                    lane = utils::rsqrt_fast(lane);
+                }
+                return load(lanes);
+            }
+            const Pack y(O::rsqrt(a.reg));
+            return y * (Pack(1.5F) - Pack(0.5F) * a * y * y);
+        } else {
+            return Pack(static_cast<Type>(1)) / sqrt(a);
+        }
+    }
+};
+
+// Number of elements processed per lane
+template<typename Lane>
+inline constexpr size_t kLaneWidth = 1;
+
+template<typename Type>
+inline constexpr size_t kLaneWidth<Pack<Type>> = Pack<Type>::kWidth;
+
+// Load one lane from p
+template<typename Lane, typename Type>
+inline Lane load(const Type* p) {
+    if constexpr (std::is_same_v<Lane, Type>) {
+        return *p;
+    } else {
+        return Lane::load(p);
+    }
+}
+
+// Store one lane to p
+template<typename Lane, typename Type>
+inline void store(Type* p, const Lane& lane) {
+    if constexpr (std::is_same_v<Lane, Type>) {
+        *p = lane;
+    } else {
+        lane.store(p);
+    }
+}
+
+// Square root of one lane
+template<typename Lane>
+inline Lane lane_sqrt(const Lane& lane) {
+    if constexpr (std::is_floating_point_v<Lane>) {
+        return std::sqrt(lane);
+    } else {
+        return sqrt(lane);
+    }
+}
+
+// Approximate reciprocal square root of one lane (see utils::rsqrt_fast())
+template<typename Lane>
+inline Lane lane_rsqrt_fast(const Lane& lane) {
+    if constexpr (std::is_floating_point_v<Lane>) {
+        return utils::rsqrt_fast(lane);
+    } else {
+        return rsqrt_fast(lane);
+    }
+}
+
+// Invoke kernel.template operator()<Lane>(i) over [first, last), using full registers where possible
+template<typename Type, typename Kernel>
+inline void for_each_lane(size_t first, size_t last, Kernel&& kernel) {
+    size_t i = first;
+    if constexpr (kEnabled<Type, 4>) {
+        for (; i + Pack<Type>::kWidth <= last; i += Pack<Type>::kWidth) {
+            kernel.template operator()<Pack<Type>>(i);
+        }
+    }
+    for (; i < last; i++) {
+        kernel.template operator()<Type>(i);
+    }
+}
+
+// Invoke kernel.template operator()<Lane>(i) over [0, count), using full registers where possible
+template<typename Type, typename Kernel>
+inline void for_each_lane(size_t count, Kernel&& kernel) {
+    for_each_lane<Type>(0, count, std::forward<Kernel>(kernel));
+}
+
+} // namespace vec::simd
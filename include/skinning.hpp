@@ -0,0 +1,147 @@
+// Dual quaternion skinning of structure-of-arrays vertex streams
+//
+// Each vertex blends up to kMaxSkinInfluences bone transforms with dual quaternion linear blending:
+// the weighted sum of the bones' unit dual quaternions (each sign-flipped into the hemisphere of the
+// vertex's first bone) is normalized and applied to the vertex. Compared to blending Mat4 bone
+// transforms (one Vec4 * Mat4 per bone), a bone costs 8 multiply-adds, and the blended transform is
+// applied once, without the volume loss of linear blend skinning.
+//
+// The blend and the transform run on SIMD lanes holding consecutive vertices (bone dual quaternions
+// are gathered per lane), and inputs are split into chunks that run on a ThreadPool (the shared pool
+// by default). The output may alias the input for in-place skinning.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "dual_quat.hpp"
+#include "dispatch.hpp"
+#include "simd.hpp"
+#include "thread_pool.hpp"
+#include "vec_array.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Maximum number of bones blended per vertex
+inline constexpr size_t kMaxSkinInfluences = 4;
+
+// Number of vertices per parallel chunk
+inline constexpr size_t kSkinningGrain = size_t{1} << 13;
+
+// Bone indices of one vertex (one per influence slot)
+using SkinIndices = std::array<std::uint32_t, kMaxSkinInfluences>;
+
+namespace detail {
+
+// Blend and apply bone dual quaternions to vertices [first, last) of structure-of-arrays streams
+template<bool kTranslate, typename Type>
+void skin_streams(std::span<const DualQuat<Type>> bones, std::span<const SkinIndices> indices,
+                  const std::array<const Type*, kMaxSkinInfluences>& weights,
+                  const std::array<const Type*, 3>& in, const std::array<Type*, 3>& out,
+                  size_t first, size_t last) {
+    dispatch::for_each_lane<Type>(first, last, [&]<typename Lane>(size_t i) {
+        constexpr size_t kWidth = simd::kLaneWidth<Lane>;
+
+        // Blended (real x, y, z, w, dual x, y, z, w) of each lane's vertex
+        std::array<Lane, 8> blend;
+        for (size_t k = 0; k < kMaxSkinInfluences; k++) {
+            alignas(kWidth * sizeof(Type)) Type tmp[9][kWidth];
+            for (size_t l = 0; l < kWidth; l++) {
+                const DualQuat<Type>& pivot = bones[indices[i + l][0]];
+                const DualQuat<Type>& bone = bones[indices[i + l][k]];
+                const Type weight = weights[k][i + l];
+                tmp[8][l] = (dot(pivot.real(), bone.real()) < 0) ? -weight : weight;
+                for (size_t c = 0; c < 4; c++) {
+                    tmp[c][l] = bone.real().xyzw()[c];
+                    tmp[4 + c][l] = bone.dual().xyzw()[c];
+                }
+            }
+            const Lane weight = simd::load<Lane>(tmp[8]);
+            for (size_t c = 0; c < 8; c++) {
+                const Lane term = simd::load<Lane>(tmp[c]) * weight;
+                blend[c] = (k == 0) ? term : blend[c] + term;
+            }
+        }
+
+        // Normalize by the norm of the real part
+        const Lane norm2 = blend[0] * blend[0] + blend[1] * blend[1] + blend[2] * blend[2]
+                         + blend[3] * blend[3];
+        const Lane inv_norm = Lane(static_cast<Type>(1)) / simd::lane_sqrt(norm2);
+        for (auto& c : blend) {
+            c = c * inv_norm;
+        }
+        const auto& [rx, ry, rz, rw, dx, dy, dz, dw] = blend;
+
+        // Rotate: v' = v + w * t + cross(u, t), with t = 2 * cross(u, v)
+        const Lane two(static_cast<Type>(2));
+        const Lane vx = simd::load<Lane>(in[0] + i);
+        const Lane vy = simd::load<Lane>(in[1] + i);
+        const Lane vz = simd::load<Lane>(in[2] + i);
+        const Lane tx = (ry * vz - rz * vy) * two;
+        const Lane ty = (rz * vx - rx * vz) * two;
+        const Lane tz = (rx * vy - ry * vx) * two;
+        Lane ox = vx + rw * tx + (ry * tz - rz * ty);
+        Lane oy = vy + rw * ty + (rz * tx - rx * tz);
+        Lane oz = vz + rw * tz + (rx * ty - ry * tx);
+
+        // Translate: t = 2 * (w_r * d - w_d * r + cross(r, d)), vector parts only
+        if constexpr (kTranslate) {
+            ox = ox + (rw * dx - dw * rx + (ry * dz - rz * dy)) * two;
+            oy = oy + (rw * dy - dw * ry + (rz * dx - rx * dz)) * two;
+            oz = oz + (rw * dz - dw * rz + (rx * dy - ry * dx)) * two;
+        }
+        simd::store(out[0] + i, ox);
+        simd::store(out[1] + i, oy);
+        simd::store(out[2] + i, oz);
+    });
+}
+
+// Split structure-of-arrays skinning across the pool
+template<bool kTranslate, typename Type>
+void skin_array(std::span<const DualQuat<Type>> bones, std::span<const SkinIndices> indices,
+                const VecArray<Type, kMaxSkinInfluences>& weights, const VecArray<Type, 3>& in,
+                VecArray<Type, 3>& out, ThreadPool& pool) {
+    assert((indices.size() == in.size()) && (weights.size() == in.size()));
+    out.resize(in.size());
+    std::array<const Type*, kMaxSkinInfluences> weight_streams;
+    for (size_t k = 0; k < kMaxSkinInfluences; k++) {
+        weight_streams[k] = weights.component(k).data();
+    }
+    const std::array<const Type*, 3> in_streams{in.x().data(), in.y().data(), in.z().data()};
+    const std::array<Type*, 3> out_streams{out.x().data(), out.y().data(), out.z().data()};
+    pool.parallel_for(in.size(), kSkinningGrain, [&](size_t first, size_t last) {
+        skin_streams<kTranslate>(bones, indices, weight_streams, in_streams, out_streams,
+                                 first, last);
+    });
+}
+
+} // namespace detail
+
+// Skin vertex positions: vertex i blends bones[indices[i][k]] with weight weights.component(k)[i]
+// Note: bones must be unit dual quaternions; unused slots need weight 0 and any valid bone index
+template<typename Type>
+void skin_points(std::type_identity_t<std::span<const DualQuat<Type>>> bones,
+                 std::span<const SkinIndices> indices,
+                 const VecArray<Type, kMaxSkinInfluences>& weights,
+                 const VecArray<Type, 3>& in, VecArray<Type, 3>& out,
+                 ThreadPool& pool = ThreadPool::shared()) {
+    detail::skin_array<true>(bones, indices, weights, in, out, pool);
+}
+
+// Skin vertex directions (e.g. normals, tangents): as skin_points(), with translation ignored
+template<typename Type>
+void skin_directions(std::type_identity_t<std::span<const DualQuat<Type>>> bones,
+                     std::span<const SkinIndices> indices,
+                     const VecArray<Type, kMaxSkinInfluences>& weights,
+                     const VecArray<Type, 3>& in, VecArray<Type, 3>& out,
+                     ThreadPool& pool = ThreadPool::shared()) {
+    detail::skin_array<false>(bones, indices, weights, in, out, pool);
+}
+
+} // namespace vec
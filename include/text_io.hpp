@@ -0,0 +1,232 @@
+// Bulk text formatting and parsing for arrays of Vec, Mat and AffineTransform records
+//
+// Records are written one per line, as their scalars (see record_traits.hpp) separated by a
+// delimiter (',' for CSV, ' ' for whitespace-separated text). Scalars are formatted with
+// std::to_chars in shortest round-trip form, so parsing the text gives back bitwise-identical
+// values, and neither direction depends on the locale. Formatting writes into caller-provided
+// buffers and never allocates.
+//
+// Parsing accepts any mix of commas, spaces and tabs between scalars, LF or CRLF line endings and
+// blank lines; every other line must hold exactly one record. Errors are reported like
+// std::from_chars, with the position of the offending text. Large inputs can be parsed in parallel:
+// the text is split into chunks at line boundaries, which are parsed on a ThreadPool and appended
+// in order.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "record_traits.hpp"
+#include "thread_pool.hpp"
+
+using std::size_t;
+
+namespace vec::io {
+
+// Number of text bytes per parallel parsing chunk
+inline constexpr size_t kTextParseGrain = size_t{1} << 20;
+
+// Maximum number of characters in the shortest round-trip form of a scalar (e.g. "-1.2345e-308")
+template<typename Type>
+inline constexpr size_t kMaxScalarChars = std::numeric_limits<Type>::max_digits10 + 8;
+
+// Maximum number of characters in a formatted record, including delimiters and the line terminator
+template<typename Record>
+requires IsRecord<Record>
+inline constexpr size_t kMaxRecordChars =
+        RecordTraits<Record>::kElems * (kMaxScalarChars<typename RecordTraits<Record>::Scalar> + 1);
+
+// Result of formatting an array of records
+struct FormatResult {
+    // One past the last character written
+    char* ptr;
+
+    // Number of records written
+    size_t count;
+};
+
+// Result of parsing an array of records
+struct ParseResult {
+    // One past the parsed text, or the position of the error
+    const char* ptr;
+
+    // Number of records parsed (before the error, if any)
+    size_t count;
+
+    // Error code (std::errc{} on success)
+    std::errc ec;
+};
+
+namespace detail {
+
+// Check whether c may separate scalars
+constexpr bool is_text_separator(char c) {
+    return (c == ' ') || (c == '\t') || (c == ',') || (c == '\r');
+}
+
+// Skip separators in [first, last)
+inline const char* skip_text_separators(const char* first, const char* last) {
+    while ((first != last) && is_text_separator(*first)) {
+        first++;
+    }
+    return first;
+}
+
+} // namespace detail
+
+// Format record as one line into [first, last)
+// Note: as std::to_chars, fails with std::errc::value_too_large if the line does not fit
+template<typename Record>
+requires IsRecord<Record>
+std::to_chars_result format_record(char* first, char* last, const Record& record,
+                                   char delimiter = ',') {
+    using Traits = RecordTraits<Record>;
+    std::array<typename Traits::Scalar, Traits::kElems> scalars;
+    Traits::encode(record, scalars.data(), 1);
+    for (size_t e = 0; e < Traits::kElems; e++) {
+        if (e > 0) {
+            if (first == last) {
+                return {last, std::errc::value_too_large};
+            }
+            *first++ = delimiter;
+        }
+        const auto result = std::to_chars(first, last, scalars[e]);
+        if (result.ec != std::errc{}) {
+            return result;
+        }
+        first = result.ptr;
+    }
+    if (first == last) {
+        return {last, std::errc::value_too_large};
+    }
+    *first++ = '\n';
+    return {first, std::errc{}};
+}
+
+// Format records, one line each, into out until all are written or the next one does not fit
+// Note: only whole records are written, so a full buffer can be flushed and formatting resumed
+// from records.subspan(count)
+template<typename Record>
+requires IsRecord<Record>
+FormatResult format(std::span<char> out, std::type_identity_t<std::span<const Record>> records,
+                    char delimiter = ',') {
+    char* first = out.data();
+    char* const last = out.data() + out.size();
+    size_t count = 0;
+    for (const auto& record : records) {
+        const auto result = format_record(first, last, record, delimiter);
+        if (result.ec != std::errc{}) {
+            break;
+        }
+        first = result.ptr;
+        count++;
+    }
+    return {first, count};
+}
+
+// Parse one record from a line [first, last) (without its line terminator)
+template<typename Record>
+requires IsRecord<Record>
+std::from_chars_result parse_record(const char* first, const char* last, Record& out) {
+    using Traits = RecordTraits<Record>;
+    std::array<typename Traits::Scalar, Traits::kElems> scalars;
+    for (size_t e = 0; e < Traits::kElems; e++) {
+        first = detail::skip_text_separators(first, last);
+        const auto result = std::from_chars(first, last, scalars[e]);
+        if (result.ec != std::errc{}) {
+            return result;
+        }
+        first = result.ptr;
+        if ((first != last) && !detail::is_text_separator(*first)) {
+            return {first, std::errc::invalid_argument};
+        }
+    }
+    first = detail::skip_text_separators(first, last);
+    if (first != last) {
+        // Extra text after the last scalar
+        return {first, std::errc::invalid_argument};
+    }
+    out = Traits::decode(scalars.data(), 1);
+    return {first, std::errc{}};
+}
+
+namespace detail {
+
+// Parse the lines of [first, last), appending records to out, until the end or the first error
+template<typename Record>
+ParseResult parse_lines(const char* first, const char* last, std::vector<Record>& out) {
+    size_t count = 0;
+    while (first != last) {
+        const char* const line_end = std::find(first, last, '\n');
+        // Note: lines holding only separators are blank
+        if (skip_text_separators(first, line_end) != line_end) {
+            Record record;
+            const auto result = parse_record(first, line_end, record);
+            if (result.ec != std::errc{}) {
+                return {result.ptr, count, result.ec};
+            }
+            out.push_back(record);
+            count++;
+        }
+        first = (line_end == last) ? last : line_end + 1;
+    }
+    return {last, count, std::errc{}};
+}
+
+} // namespace detail
+
+// Parse text, one record per line, appending records to out
+// Records before an error are kept; the result points at the error
+template<typename Record>
+requires IsRecord<Record>
+ParseResult parse(std::string_view text, std::vector<Record>& out) {
+    return detail::parse_lines(text.data(), text.data() + text.size(), out);
+}
+
+// Parse text as parse(), splitting it into chunks of about grain bytes (at line boundaries) that
+// are parsed in parallel on the pool
+template<typename Record>
+requires IsRecord<Record>
+ParseResult parse(std::string_view text, std::vector<Record>& out, ThreadPool& pool,
+                  size_t grain = kTextParseGrain) {
+    const char* const end = text.data() + text.size();
+    grain = std::max<size_t>(grain, 1);
+
+    // Split after the first line terminator at or beyond each multiple of grain
+    std::vector<const char*> bounds{text.data()};
+    while (bounds.back() != end) {
+        const char* next = bounds.back() + std::min<size_t>(grain, end - bounds.back());
+        next = std::find(next, end, '\n');
+        bounds.push_back((next == end) ? end : next + 1);
+    }
+
+    const size_t chunks = bounds.size() - 1;
+    std::vector<std::vector<Record>> parts(chunks);
+    std::vector<ParseResult> results(chunks);
+    pool.parallel_for(chunks, 1, [&](size_t first, size_t last) {
+        for (size_t c = first; c < last; c++) {
+            results[c] = detail::parse_lines(bounds[c], bounds[c + 1], parts[c]);
+        }
+    });
+
+    // Append chunks in order, up to the first error
+    size_t count = 0;
+    for (size_t c = 0; c < chunks; c++) {
+        out.insert(out.end(), parts[c].begin(), parts[c].end());
+        count += results[c].count;
+        if (results[c].ec != std::errc{}) {
+            return {results[c].ptr, count, results[c].ec};
+        }
+    }
+    return {end, count, std::errc{}};
+}
+
+} // namespace vec::io
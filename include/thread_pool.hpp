@@ -0,0 +1,149 @@
+// Minimal thread pool used to split batch kernels across cores
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using std::size_t;
+
+namespace vec {
+
+// Fixed-size pool of worker threads executing parallel_for() chunks
+// Note: parallel_for() must not be called from within a task running on the same pool
+class ThreadPool {
+public:
+    // Construct pool with the specified number of worker threads (the calling thread also works)
+    explicit ThreadPool(size_t worker_count = default_worker_count()) {
+        workers_.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; i++) {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Stop and join all worker threads
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**************************************************************************
+     * STATIC MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the number of worker threads used by default (one per hardware thread, minus the caller)
+    static size_t default_worker_count() {
+        const size_t hardware_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        return hardware_threads - 1;
+    }
+
+    // Get the process-wide pool shared by batch kernels
+    static ThreadPool& shared() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the number of threads participating in parallel_for() (workers plus the caller)
+    size_t concurrency() const {
+        return workers_.size() + 1;
+    }
+
+    // Invoke fn(begin, end) over [0, count) in chunks of at most grain items, in parallel
+    // The first exception thrown by fn (if any) is rethrown on the calling thread once all chunks
+    // have finished
+    template<typename Fn>
+    void parallel_for(size_t count, size_t grain, Fn&& fn) {
+        grain = std::max<size_t>(grain, 1);
+        const size_t chunks = (count + grain - 1) / grain;
+        if (chunks <= 1 || workers_.empty()) {
+            if (count > 0) {
+                fn(size_t{0}, count);
+            }
+            return;
+        }
+
+        std::atomic<size_t> next_chunk{0};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        auto run_chunks = [&] {
+            for (size_t c = next_chunk++; c < chunks; c = next_chunk++) {
+                try {
+                    fn(c * grain, std::min(count, (c + 1) * grain));
+                } catch (...) {
+                    std::lock_guard lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        const size_t helpers = std::min(workers_.size(), chunks - 1);
+        std::latch done(static_cast<std::ptrdiff_t>(helpers));
+        {
+            std::lock_guard lock(mutex_);
+            for (size_t i = 0; i < helpers; i++) {
+                tasks_.emplace_back([&] {
+                    run_chunks();
+                    done.count_down();
+                });
+            }
+        }
+        cv_.notify_all();
+
+        run_chunks();
+        done.wait();
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    // Pop and run tasks until the pool is stopped
+    void worker_loop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex_);
+                cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (stop_ && tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+};
+
+} // namespace vec
@@ -2,14 +2,15 @@
 
 #pragma once
 
-#include <cmath>
+#include <optional>
 
+#include "instrument.hpp"
 #include "mat.hpp"
 
 namespace vec {
 
 // Forward declaration
-template<typename Type, size_t M>
+template<typename Type, size_t M, Layout L = Layout::RowMajor>
 class AffineTransform;
 
 // Aliases for supported types and sizes
@@ -22,23 +23,33 @@ using Transform3d = AffineTransform<double, 3>;
 using Transform2ld = AffineTransform<long double, 2>;
 using Transform3ld = AffineTransform<long double, 3>;
 
+template<typename Type, size_t M>
+using ColTransform = AffineTransform<Type, M, Layout::ColMajor>;
+
+using ColTransform2f = ColTransform<float, 2>;
+using ColTransform3f = ColTransform<float, 3>;
+
+using ColTransform2d = ColTransform<double, 2>;
+using ColTransform3d = ColTransform<double, 3>;
+
+using ColTransform2ld = ColTransform<long double, 2>;
+using ColTransform3ld = ColTransform<long double, 3>;
+
 // Affine transform class template
 // Extends matrix class template with size M+1 to enable homogeneous coordinate representation
-template<typename Type, size_t M>
-class AffineTransform final : public Mat<Type, M+1> {
+// The linear part occupies elements (i, j) for i, j < M and the translation occupies row M, in
+// either storage layout
+template<typename Type, size_t M, Layout L>
+class AffineTransform final : public Mat<Type, M+1, L> {
     // Template parameter assertions
     static_assert((M >= 2) && (M <= 3), "Transform must be 2D or 3D (3x3 or 4x4 matrix)");
     static_assert(std::is_floating_point_v<Type>, "Type must be floating-point");
 
     // Type aliases for convenience
-    using BaseMatT = Mat<Type, M+1>;
-    using MatT = Mat<Type, M>;
+    using BaseMatT = Mat<Type, M+1, L>;
+    using MatT = Mat<Type, M, L>;
     using VecT = Vec<Type, M>;
 
-    // Template-param dependent parent members
-    using BaseMatT::rows_;
-    using BaseMatT::begin;
-
 public:
     // Construct default affine transform (identity transform, zero translation)
     constexpr AffineTransform() : AffineTransform(MatT::identity(), VecT(0)) {}
@@ -47,9 +58,15 @@ public:
     constexpr AffineTransform(MatT m_linear_transform, VecT v_translation) {
         set_linear_transform(m_linear_transform);
         set_translation(v_translation);
-        rows_[M][M] = 1;
+        (*this)(M, M) = 1;
     }
 
+    // Construct affine transform from a transform with the opposite storage order (same elements)
+    template<Layout L2>
+    requires (L2 != L)
+    constexpr explicit AffineTransform(const AffineTransform<Type, M, L2>& other)
+            : AffineTransform(MatT(other.get_linear_transform()), other.get_translation()) {}
+
     // Construct affine transform from MxM transform matrix (zero translation)
     constexpr explicit AffineTransform(MatT m_linear_transform)
             : AffineTransform(m_linear_transform, VecT(0)) {}
@@ -64,34 +81,38 @@ public:
 
     // Construct matrix for counter-clockwise rotation around the x axis in radians
     constexpr static MatT rotate_x(Type rad) requires Is3D<M> {
-        return {1.0F, 0.0F,           0.0F,
-                0.0F, std::cos(rad), -std::sin(rad),
-                0.0F, std::sin(rad),  std::cos(rad)};
+        const auto [s, c] = utils::sincos(rad);
+        return {1.0F, 0.0F, 0.0F,
+                0.0F, c,    -s,
+                0.0F, s,     c};
     }
 
     // Construct matrix for counter-clockwise rotation around the y axis in radians
     constexpr static MatT rotate_y(Type rad) requires Is3D<M> {
+        const auto [s, c] = utils::sincos(rad);
         return {
-            { std::cos(rad), 0.0F, std::sin(rad)},
-            { 0.0F,          1.0F, 0.0F},
-            {-std::sin(rad), 0.0F, std::cos(rad)},
+            { c,    0.0F, s},
+            { 0.0F, 1.0F, 0.0F},
+            {-s,    0.0F, c},
         };
     }
 
     // Construct matrix for counter-clockwise rotation around the z axis in radians
     constexpr static MatT rotate_z(Type rad) requires Is3D<M> {
+        const auto [s, c] = utils::sincos(rad);
         return {
-            {std::cos(rad), -std::sin(rad), 0.0F},
-            {std::sin(rad),  std::cos(rad), 0.0F},
-            {0.0F,           0.0F,          1.0F},
+            {c,    -s,    0.0F},
+            {s,     c,    0.0F},
+            {0.0F,  0.0F, 1.0F},
         };
     }
 
     // Construct matrix for counter-clockwise rotation of a 2D vector
     constexpr static MatT rotate(Type rad) requires Is2D<M> {
+        const auto [s, c] = utils::sincos(rad);
         return {
-                {std::cos(rad), -std::sin(rad)},
-                {std::sin(rad),  std::cos(rad)},
+                {c, -s},
+                {s,  c},
         };
     }
 
@@ -102,39 +123,95 @@ public:
     // Get the MxM matrix representing the linear transform
     constexpr MatT get_linear_transform() const {
         MatT out;
-        std::transform(rows_.cbegin(), rows_.cbegin() + M,
-                       out.begin(),
-                       slice_vec);
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                out(i, j) = (*this)(i, j);
+            }
+        }
         return out;
     }
 
     // Set the MxM matrix representing the linear transform
     constexpr void set_linear_transform(const MatT& m_linear_transform) {
-        std::transform(m_linear_transform.cbegin(), m_linear_transform.cend(),
-                       begin(),
-                       pad_vec);
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                (*this)(i, j) = m_linear_transform(i, j);
+            }
+            (*this)(i, M) = 0;
+        }
     }
 
     // Get the M-dimensional vector representing the translation
     constexpr VecT get_translation() const {
-        return VecT(rows_[M]);
+        VecT out;
+        for (size_t j = 0; j < M; j++) {
+            out[j] = (*this)(M, j);
+        }
+        return out;
     }
 
     // Set the M-dimensional vector representing the translation
     constexpr void set_translation(const VecT& v_translation) {
-        // Note: copy elements directly to prevent overwriting bottom-rightmost element
-        std::copy(v_translation.cbegin(), v_translation.cend(), rows_[M].begin());
+        // Note: copy elements individually to prevent overwriting bottom-rightmost element
+        for (size_t j = 0; j < M; j++) {
+            (*this)(M, j) = v_translation[j];
+        }
+    }
+
+    // Get the inverse transform (inverts only the MxM linear part)
+    // Note: a singular linear part yields non-finite elements; use try_inverse() to detect this
+    constexpr AffineTransform inverse(VEC_SOURCE_LOCATION) const {
+        VEC_RECORD(TransformInverse, Type, M, location);
+        const MatT linear_inverse = get_linear_transform().inverse();
+        return AffineTransform(linear_inverse, -(get_translation() * linear_inverse));
+    }
+
+    // Get the inverse transform, or std::nullopt if |det(linear part)| <= tolerance
+    constexpr std::optional<AffineTransform> try_inverse(
+            Type tolerance = utils::kSingularDefaultTolerance<Type>
+            VEC_SOURCE_LOCATION_NEXT) const {
+        VEC_RECORD(TransformInverse, Type, M, location);
+        const auto linear_inverse = get_linear_transform().try_inverse(tolerance);
+        if (!linear_inverse) {
+            return std::nullopt;
+        }
+        return AffineTransform(*linear_inverse, -(get_translation() * *linear_inverse));
+    }
+
+    // Get the inverse of a rigid transform (orthonormal linear part, i.e. rotation/reflection)
+    // Note: the linear part is transposed rather than inverted; results are wrong if it is scaled
+    constexpr AffineTransform rigid_inverse(VEC_SOURCE_LOCATION) const {
+        VEC_RECORD(TransformRigidInverse, Type, M, location);
+        const MatT linear_transpose = get_linear_transform().transpose();
+        return AffineTransform(linear_transpose, -(get_translation() * linear_transpose));
+    }
+
+    /**************************************************************************
+     * MEMBER OPERATORS
+     **************************************************************************/
+
+    // Inherit matrix compound assignment (scalar and general (M+1)x(M+1) matrix)
+    using BaseMatT::operator*=;
+
+    // Compose this transform with another (apply this transform, then rhs)
+    constexpr AffineTransform& operator*=(const AffineTransform& rhs) {
+        *this = (*this) * rhs;
+        return *this;
+    }
+
+    /**************************************************************************
+     * FRIEND OPERATORS
+     **************************************************************************/
+
+    // Compose two transforms (apply lhs, then rhs)
+    // Note: only the linear parts and translations are multiplied; the constant column is skipped
+    friend constexpr AffineTransform operator*(const AffineTransform& lhs,
+                                               const AffineTransform& rhs) {
+        VEC_RECORD(TransformCompose, Type, M, std::source_location{});
+        const MatT rhs_linear = rhs.get_linear_transform();
+        return AffineTransform(lhs.get_linear_transform() * rhs_linear,
+                               lhs.get_translation() * rhs_linear + rhs.get_translation());
     }
-private:
-    // Helper to pad vector with trailing 0
-    static constexpr auto pad_vec = [](const Vec<Type, M>& blah) {
-        return Vec<Type, M+1>(blah);
-    };
-
-    // Helper to slice vector (drop final element)
-    static constexpr auto slice_vec = [](const Vec<Type, M+1>& blah) {
-        return Vec<Type, M>(blah);
-    };
 };
 
 // TODO: Helpers for reflection, scale, skew
@@ -2,8 +2,25 @@
 
 #pragma once
 
+#include <bit>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+// Attribute for functions that rely on separately rounded products and sums (error-free
+// transformations): GCC contracts a * b + c into FMA across statements when the target has FMA
+#if defined(__GNUC__) && !defined(__clang__)
+#define VEC_NO_FP_CONTRACT [[gnu::optimize("fp-contract=off")]]
+#else
+#define VEC_NO_FP_CONTRACT
+#endif
 
 namespace vec::utils {
 
@@ -11,6 +28,11 @@ template <typename Type>
 constexpr Type kFloatEqDefaultEpsilon = 128 * std::numeric_limits<Type>::epsilon();
 template <typename Type>
 constexpr Type kFloatEqDefaultAbsThreshold = std::numeric_limits<Type>::min();
+template <typename Type>
+constexpr Type kSingularDefaultTolerance = std::numeric_limits<Type>::min();
+template <typename Type>
+constexpr Type kRsqrtFastMaxRelError = std::is_same_v<Type, float>
+        ? static_cast<Type>(5e-7) : 2 * std::numeric_limits<Type>::epsilon();
 
 // Concepts
 template<typename Type>
@@ -27,22 +49,454 @@ constexpr auto abs(Type const &x) {
     return (x < 0) ? -x : x;
 }
 
-// Implementation for constexpr floating-point square root
+// Wide type used for compile-time evaluation of transcendental functions
+using Wide = long double;
+
+// Constants in wide precision
+inline constexpr Wide kPi = 3.141592653589793238462643383279502884L;
+inline constexpr Wide kPiOver2 = 1.570796326794896619231321691639751442L;
+inline constexpr Wide kPiOver4 = 0.785398163397448309615660845819875721L;
+inline constexpr Wide kLn2 = 0.693147180559945309417232121458176568L;
+
+// Constants split into 40-bit, 40-bit and full-precision parts (Cody-Waite), so that k * part is
+// exact for |k| < 2^24 during argument reduction
+inline constexpr Wide kPiOver2Hi = 0x1.921fb54442p+0L;
+inline constexpr Wide kPiOver2Mid = 0x1.a308d31318p-41L;
+inline constexpr Wide kPiOver2Lo = 6.3683171635109499079619942528806e-25L;
+inline constexpr Wide kLn2Hi = 0x1.62e42fefa2p-1L;
+inline constexpr Wide kLn2Mid = 0x1.9ef35793c6p-41L;
+inline constexpr Wide kLn2Lo = 5.8029889835956904741649023890186e-25L;
+
+// Maximum number of series terms or Newton steps (all loops converge well before this)
+inline constexpr int kMaxIterations = 64;
+
+// Check if floating-point value x is NaN
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr bool isnan(Type x) {
+    return x != x;
+}
+
+// Check if floating-point value x is positive or negative infinity
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr bool isinf(Type x) {
+    return (x == std::numeric_limits<Type>::infinity())
+            || (x == -std::numeric_limits<Type>::infinity());
+}
+
+// Check if the sign bit of floating-point value x is set (including -0)
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr bool signbit(Type x) {
+    // Note: long double has padding bits, but narrowing to double preserves the sign of zero
+    return (x < 0) || ((x == 0) && (std::bit_cast<std::uint64_t>(static_cast<double>(x)) >> 63));
+}
+
+// Get 2 raised to integer power e
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type pow2(int e) {
+    Type out = 1;
+    Type factor = (e < 0) ? static_cast<Type>(0.5) : static_cast<Type>(2);
+    for (unsigned n = static_cast<unsigned>((e < 0) ? -e : e); n > 0; n >>= 1) {
+        if (n & 1U) {
+            out *= factor;
+        }
+        if (n > 1) {
+            // Square only while bits remain, so that large |e| doesn't overflow the factor
+            factor *= factor;
+        }
+    }
+    return out;
+}
+
+// Split finite positive x into m * 2^e with m in [1, 2)
 template<typename Type>
 requires IsFloatingPoint<Type>
-constexpr Type sqrt_floating_point_helper(Type x, Type current, Type previous) {
-    return (current == previous)
-            ? current
-            : sqrt_floating_point_helper<Type>(x, 0.5 * (current + (x / current)), current);
+constexpr Type split_exponent(Type x, int& e) {
+    e = 0;
+    while (x >= static_cast<Type>(0x1p64)) { x *= static_cast<Type>(0x1p-64); e += 64; }
+    while (x >= static_cast<Type>(2)) { x *= static_cast<Type>(0.5); e += 1; }
+    while (x < static_cast<Type>(0x1p-64)) { x *= static_cast<Type>(0x1p64); e -= 64; }
+    while (x < static_cast<Type>(1)) { x *= static_cast<Type>(2); e -= 1; }
+    return x;
 }
 
+// Get an initial estimate of sqrt(x) for positive normal x by halving the exponent bits
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type sqrt_seed(Type x) {
+    if constexpr (std::is_same_v<Type, float>) {
+        return std::bit_cast<float>(0x1fbd1df5U + (std::bit_cast<std::uint32_t>(x) >> 1));
+    } else if constexpr (std::is_same_v<Type, double>) {
+        return std::bit_cast<double>(0x1ff7a3bea91d9b1bULL + (std::bit_cast<std::uint64_t>(x) >> 1));
+    } else {
+        // Note: long double has padding bits, so seed from the exponent instead of its bits
+        int e = 0;
+        const Type m = split_exponent(x, e);
+        return ((e % 2) ? m : (m + 1) / 2) * pow2<Type>((e - (e % 2 != 0)) / 2);
+    }
+}
+
+// Get an initial estimate of 1 / sqrt(x) for positive normal x from the exponent bits
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type rsqrt_seed(Type x) {
+    if constexpr (std::is_same_v<Type, float>) {
+        return std::bit_cast<float>(0x5f3759dfU - (std::bit_cast<std::uint32_t>(x) >> 1));
+    } else if constexpr (std::is_same_v<Type, double>) {
+        return std::bit_cast<double>(0x5fe6eb50c7b537a9ULL - (std::bit_cast<std::uint64_t>(x) >> 1));
+    } else {
+        return static_cast<Type>(1) / sqrt_seed(x);
+    }
+}
+
+// Implementation for constexpr floating-point square root
+// Note: subnormal inputs are scaled into the normal range so the exponent-based seed applies
 template<typename Type>
 requires IsFloatingPoint<Type>
 constexpr Type sqrt_floating_point(Type x) {
-    // TODO: error on negative/infinite inputs
-    return (x >= 0) && (x < std::numeric_limits<Type>::infinity())
-            ? sqrt_floating_point_helper<Type>(x, x, 0)
-            : std::numeric_limits<Type>::quiet_NaN();
+    if (isnan(x) || (x < 0)) {
+        return std::numeric_limits<Type>::quiet_NaN();
+    }
+    if ((x == 0) || isinf(x)) {
+        return x;
+    }
+    if (x < std::numeric_limits<Type>::min()) {
+        constexpr int kDigits = std::numeric_limits<Type>::digits;
+        return sqrt_floating_point(x * pow2<Type>(2 * kDigits)) * pow2<Type>(-kDigits);
+    }
+    // Heron's method, evaluated in wide precision and rounded once; after the first step the
+    // iterates decrease monotonically towards the root
+    Wide current = sqrt_seed(x);
+    current = static_cast<Wide>(0.5) * (current + x / current);
+    for (int i = 0; i < kMaxIterations; i++) {
+        const Wide next = static_cast<Wide>(0.5) * (current + x / current);
+        if (next >= current) {
+            break;
+        }
+        current = next;
+    }
+    return static_cast<Type>(current);
+}
+
+// Implementation for constexpr floating-point reciprocal square root
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type rsqrt_floating_point(Type x) {
+    if (isnan(x) || (x < 0)) {
+        return std::numeric_limits<Type>::quiet_NaN();
+    }
+    if (x == 0) {
+        return std::numeric_limits<Type>::infinity();
+    }
+    if (isinf(x)) {
+        return 0;
+    }
+    if (x < std::numeric_limits<Type>::min()) {
+        constexpr int kDigits = std::numeric_limits<Type>::digits;
+        return rsqrt_floating_point(x * pow2<Type>(2 * kDigits)) * pow2<Type>(kDigits);
+    }
+    // Refine the seed with Newton steps y' = y * (1.5 - 0.5 * x * y^2) in wide precision, then
+    // round once
+    Wide y = rsqrt_seed(x);
+    for (int i = 0; i < kMaxIterations; i++) {
+        const Wide next = y * (static_cast<Wide>(1.5) - static_cast<Wide>(0.5) * x * y * y);
+        if (next == y) {
+            break;
+        }
+        y = next;
+    }
+    return static_cast<Type>(y);
+}
+
+// Split x into high and low halves whose products with other halves are exact (Veltkamp)
+template<typename Type>
+requires IsFloatingPoint<Type>
+VEC_NO_FP_CONTRACT constexpr std::pair<Type, Type> split_halves(Type x) {
+    constexpr Type kSplitter = pow2<Type>((std::numeric_limits<Type>::digits + 1) / 2) + 1;
+    const Type t = kSplitter * x;
+    const Type hi = t - (t - x);
+    return {hi, x - hi};
+}
+
+// Expand a * b + c into s + t, where s = p + c is the rounded sum of the rounded product p = a * b
+// and t collects the error terms (Dekker's product, Knuth's sum), rounded once
+// Note: requires finite operands whose product and error terms stay within the normal range
+template<typename Type>
+requires IsFloatingPoint<Type>
+VEC_NO_FP_CONTRACT constexpr std::pair<Type, Type> fma_terms(Type a, Type b, Type c) {
+    const Type p = a * b;
+    const Type s = p + c;
+    const auto [a_hi, a_lo] = split_halves(a);
+    const auto [b_hi, b_lo] = split_halves(b);
+    const Type p_err = ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+    const Type v = s - p;
+    const Type s_err = (p - (s - v)) + (c - v);
+    return {s, p_err + s_err};
+}
+
+// Round s + t (from fma_terms(), scaled up by 2^scale) to the subnormal grid of Type, then unscale
+// Note: requires |s + t| below the smallest normal value times 2^scale
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type round_subnormal(Type s, Type t, int scale) {
+    // Renormalize so that |t| is at most half an ulp of s (t can be larger after cancellation)
+    const Type sum = s + t;
+    const Type v = sum - s;
+    const Type err = (s - (sum - v)) + (t - v);
+    if (sum < 0) {
+        return -round_subnormal(-sum, -err, scale);
+    }
+    // Adding shift rounds sum to a multiple of the grid spacing ulp; the remainder decides the rest
+    using Limits = std::numeric_limits<Type>;
+    const Type ulp = pow2<Type>(Limits::min_exponent - Limits::digits + scale);
+    const Type shift = pow2<Type>(Limits::min_exponent - 1 + scale);
+    Type q = (sum + shift) - shift;
+    const Type rest = (sum - q) + err;
+    if ((rest > ulp / 2) || ((rest == ulp / 2)
+            && (static_cast<unsigned long long>(q / ulp) % 2 != 0))) {
+        q += ulp;
+    } else if ((rest < -ulp / 2) || ((rest == -ulp / 2)
+            && (static_cast<unsigned long long>(q / ulp) % 2 != 0))) {
+        q -= ulp;
+    }
+    return q * pow2<Type>(-scale);
+}
+
+// Implementation for constexpr fused multiply-add
+// The product and sum are expanded into error-free terms (see fma_terms()), so the result is
+// a * b + c with a single final rounding, up to rare double-rounding ties
+// Note: operands are first rescaled by powers of two so that the split and the error terms stay
+// within the normal range (a product near overflow or underflow scales c and the result too)
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type fma_floating_point(Type a, Type b, Type c) {
+    const auto finite = [](Type x) { return !isnan(x) && !isinf(x); };
+    if (!finite(a) || !finite(b) || (a == 0) || (b == 0)) {
+        return a * b + c;
+    }
+    if (!finite(c)) {
+        return c;
+    }
+    using Limits = std::numeric_limits<Type>;
+    constexpr int kDigits = Limits::digits;
+    constexpr Type kLarge = pow2<Type>(Limits::max_exponent - kDigits);
+    constexpr Type kSmall = pow2<Type>(Limits::min_exponent + 2 * kDigits);
+    constexpr Type kDown = pow2<Type>(-kDigits);
+    constexpr Type kUp = pow2<Type>(kDigits);
+    const auto abs = [](Type x) { return (x < 0) ? -x : x; };
+    const bool a_larger = abs(a) >= abs(b);
+    const Type larger = a_larger ? abs(a) : abs(b);
+    const Type smaller = a_larger ? abs(b) : abs(a);
+    // Compare the product without forming it, since overflow isn't a constant expression
+    const bool large_product = (smaller >= 1) ? (larger > kLarge / smaller)
+                                              : (larger * smaller > kLarge);
+    if (large_product || (abs(c) > kLarge)) {
+        // Product or sum near (or past) overflow: scale the product and c down, then the result
+        // back up
+        const Type out = a_larger ? fma_floating_point(a * kDown, b, c * kDown)
+                                  : fma_floating_point(a, b * kDown, c * kDown);
+        if (abs(out) > Limits::max() * kDown) {
+            return (out < 0) ? -Limits::infinity() : Limits::infinity();
+        }
+        return out * kUp;
+    }
+    const Type p = a * b;
+    if (p == 0) {
+        // A product that underflows to zero only decides the sign of a zero result
+        return (c == 0) ? p : c;
+    }
+    if (larger > kLarge) {
+        // One factor too large to split: move scale onto the other (the product is unchanged)
+        return a_larger ? fma_floating_point(a * kDown, b * kUp, c)
+                        : fma_floating_point(a * kUp, b * kDown, c);
+    }
+    if ((abs(p) < kSmall) && (abs(c) < kLarge * kDown * kDown * kDown)) {
+        // Product near underflow: scale the smaller factor and c up (which makes every factor
+        // normal), then round the scaled terms back down once
+        constexpr int kScale = 3 * kDigits;
+        constexpr Type kUp3 = pow2<Type>(kScale);
+        const auto [s_up, t_up] = a_larger ? fma_terms(a, b * kUp3, c * kUp3)
+                                           : fma_terms(a * kUp3, b, c * kUp3);
+        const Type out = s_up + t_up;
+        if (abs(out) >= Limits::min() * kUp3) {
+            return out * pow2<Type>(-kScale);
+        }
+        return round_subnormal(s_up, t_up, kScale);
+    }
+    const auto [s, t] = fma_terms(a, b, c);
+    return s + t;
+}
+
+// Evaluate sin(r) and cos(r) for reduced argument |r| <= pi/4 by Taylor series
+constexpr std::pair<Wide, Wide> sincos_series(Wide r) {
+    const Wide r2 = r * r;
+    Wide sin_term = r;
+    Wide cos_term = 1;
+    Wide sin_sum = sin_term;
+    Wide cos_sum = cos_term;
+    for (int n = 1; n < kMaxIterations; n++) {
+        sin_term *= -r2 / static_cast<Wide>((2 * n) * (2 * n + 1));
+        cos_term *= -r2 / static_cast<Wide>((2 * n - 1) * (2 * n));
+        if ((sin_sum + sin_term == sin_sum) && (cos_sum + cos_term == cos_sum)) {
+            break;
+        }
+        sin_sum += sin_term;
+        cos_sum += cos_term;
+    }
+    return {sin_sum, cos_sum};
+}
+
+// Implementation for constexpr simultaneous sine and cosine
+// Note: the argument is reduced by a three-part multiple of pi/2, which is exact for |x| < 2^24 * pi/2;
+// accuracy degrades beyond that, and |x| >= 2^62 * pi/2 yields NaN
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr std::pair<Type, Type> sincos_floating_point(Type x) {
+    if (isnan(x) || isinf(x)) {
+        return {std::numeric_limits<Type>::quiet_NaN(), std::numeric_limits<Type>::quiet_NaN()};
+    }
+    const Wide q = static_cast<Wide>(x) / kPiOver2;
+    if (abs(q) >= static_cast<Wide>(0x1p62)) {
+        return {std::numeric_limits<Type>::quiet_NaN(), std::numeric_limits<Type>::quiet_NaN()};
+    }
+    const Wide k = static_cast<Wide>(static_cast<long long>(
+            (q >= 0) ? (q + static_cast<Wide>(0.5)) : (q - static_cast<Wide>(0.5))));
+    const auto [s, c] = sincos_series(((static_cast<Wide>(x) - k * kPiOver2Hi) - k * kPiOver2Mid)
+                                      - k * kPiOver2Lo);
+    switch (static_cast<long long>(k) & 3) {
+        case 0: return {static_cast<Type>(s), static_cast<Type>(c)};
+        case 1: return {static_cast<Type>(c), static_cast<Type>(-s)};
+        case 2: return {static_cast<Type>(-s), static_cast<Type>(-c)};
+        default: return {static_cast<Type>(-c), static_cast<Type>(s)};
+    }
+}
+
+// Evaluate atan(x) for |x| <= 1 in wide precision
+constexpr Wide atan_unit(Wide x) {
+    // Halve the angle twice (atan(x) = 2 atan(x / (1 + sqrt(1 + x^2)))) so |x| <= tan(pi/16)
+    x = x / (1 + sqrt_floating_point(1 + x * x));
+    x = x / (1 + sqrt_floating_point(1 + x * x));
+    const Wide x2 = x * x;
+    Wide term = x;
+    Wide sum = x;
+    for (int n = 1; n < kMaxIterations; n++) {
+        term *= -x2;
+        const Wide next = sum + term / static_cast<Wide>(2 * n + 1);
+        if (next == sum) {
+            break;
+        }
+        sum = next;
+    }
+    return 4 * sum;
+}
+
+// Implementation for constexpr two-argument arctangent
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type atan2_floating_point(Type y, Type x) {
+    if (isnan(x) || isnan(y)) {
+        return std::numeric_limits<Type>::quiet_NaN();
+    }
+    const bool y_negative = (y < 0) || ((y == 0) && signbit(y));
+    const Wide ay = abs(static_cast<Wide>(y));
+    const Wide ax = abs(static_cast<Wide>(x));
+    Wide angle = 0;
+    if ((ay == 0) && (ax == 0)) {
+        angle = 0;
+    } else if (isinf(ay) && isinf(ax)) {
+        angle = kPiOver4;
+    } else if (ay <= ax) {
+        angle = isinf(ax) ? 0 : atan_unit(ay / ax);
+    } else {
+        angle = kPiOver2 - (isinf(ay) ? 0 : atan_unit(ax / ay));
+    }
+    if ((x < 0) || ((x == 0) && signbit(x))) {
+        angle = kPi - angle;
+    }
+    return static_cast<Type>(y_negative ? -angle : angle);
+}
+
+// Implementation for constexpr arc cosine
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type acos_floating_point(Type x) {
+    if (isnan(x) || (x < -1) || (x > 1)) {
+        return std::numeric_limits<Type>::quiet_NaN();
+    }
+    // acos(x) = 2 atan2(sqrt(1 - x), sqrt(1 + x)), which stays accurate near x = +/-1
+    const Wide wx = x;
+    return static_cast<Type>(2 * atan2_floating_point(sqrt_floating_point(1 - wx),
+                                                      sqrt_floating_point(1 + wx)));
+}
+
+// Implementation for constexpr natural exponential
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type exp_floating_point(Type x) {
+    if (isnan(x)) {
+        return x;
+    }
+    if (x > std::numeric_limits<Type>::max_exponent * kLn2) {
+        return std::numeric_limits<Type>::infinity();
+    }
+    if (x < (std::numeric_limits<Type>::min_exponent - std::numeric_limits<Type>::digits) * kLn2) {
+        return 0;
+    }
+    // exp(x) = 2^k * exp(r) with |r| <= ln(2) / 2
+    const Wide wx = x;
+    const int k = static_cast<int>((wx >= 0) ? (wx / kLn2 + static_cast<Wide>(0.5))
+                                             : (wx / kLn2 - static_cast<Wide>(0.5)));
+    const Wide r = ((wx - k * kLn2Hi) - k * kLn2Mid) - k * kLn2Lo;
+    Wide term = 1;
+    Wide sum = 1;
+    for (int n = 1; n < kMaxIterations; n++) {
+        term *= r / n;
+        if (sum + term == sum) {
+            break;
+        }
+        sum += term;
+    }
+    // Note: scale in two steps so 2^k itself never overflows or underflows before the product
+    return static_cast<Type>(sum * pow2<Wide>(k / 2) * pow2<Wide>(k - k / 2));
+}
+
+// Implementation for constexpr natural logarithm
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type log_floating_point(Type x) {
+    if (isnan(x) || (x < 0)) {
+        return std::numeric_limits<Type>::quiet_NaN();
+    }
+    if (x == 0) {
+        return -std::numeric_limits<Type>::infinity();
+    }
+    if (isinf(x)) {
+        return x;
+    }
+    // log(x) = e * ln(2) + log(m) with m in [sqrt(1/2), sqrt(2)), and log(m) = 2 atanh(s) for
+    // s = (m - 1) / (m + 1)
+    int e = 0;
+    Wide m = split_exponent(static_cast<Wide>(x), e);
+    if (m > static_cast<Wide>(1.41421356237309504880L)) {
+        m *= static_cast<Wide>(0.5);
+        e += 1;
+    }
+    const Wide s = (m - 1) / (m + 1);
+    const Wide s2 = s * s;
+    Wide term = s;
+    Wide sum = s;
+    for (int n = 1; n < kMaxIterations; n++) {
+        term *= s2;
+        const Wide next = sum + term / static_cast<Wide>(2 * n + 1);
+        if (next == sum) {
+            break;
+        }
+        sum = next;
+    }
+    return static_cast<Type>(e * kLn2 + 2 * sum);
 }
 
 } // namespace constexpr_impl
@@ -71,6 +525,167 @@ constexpr Type sqrt(Type const &x) {
     }
 }
 
+// Get a * b + c for floating-point values, rounded once
+// Note: run-time evaluation uses std::fma() even when the build doesn't target FMA (the C library
+// then selects the hardware instruction when the CPU has it), so results match compile time
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type fma(Type a, Type b, Type c) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::fma_floating_point<Type>(a, b, c);
+    } else {
+        return std::fma(a, b, c);
+    }
+}
+
+// Get the reciprocal square root of floating-point value x
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type rsqrt(Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::rsqrt_floating_point<Type>(x);
+    } else {
+        // Use standard library implementation at runtime
+        return static_cast<Type>(1) / std::sqrt(x);
+    }
+}
+
+// Get an approximate reciprocal square root of floating-point value x
+// For float, the hardware estimate (or an exponent-bit estimate without SSE) is refined by Newton
+// steps to a relative error below kRsqrtFastMaxRelError<float> (5e-7) over all positive input,
+// including subnormals; zero gives +inf and infinity gives 0. double and long double use the exact
+// 1 / sqrt(x). Compile-time evaluation is exact for all types.
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type rsqrt_fast(Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::rsqrt_floating_point<Type>(x);
+    } else if constexpr (std::is_same_v<Type, float>) {
+        // The estimate and Newton step only hold for positive normal x: subnormals are scaled into
+        // the normal range, and zero, infinity, negative and NaN input are computed exactly
+        if (!(x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max())) {
+            if (x > 0 && x < std::numeric_limits<float>::min()) {
+                constexpr int kDigits = std::numeric_limits<float>::digits;
+                constexpr float kScale = constexpr_impl::pow2<float>(2 * kDigits);
+                constexpr float kUnscale = constexpr_impl::pow2<float>(kDigits);
+                return rsqrt_fast(x * kScale) * kUnscale;
+            }
+            return 1.0F / std::sqrt(x);
+        }
+#if defined(__SSE__)
+        // Estimate has relative error <= 1.5 * 2^-12; one step squares it (to ~2e-7)
+        const float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+        return y * (1.5F - 0.5F * x * y * y);
+#else
+        // Estimate has relative error <= 3.5e-2; three steps bring it to rounding level
+        float y = constexpr_impl::rsqrt_seed(x);
+        for (int i = 0; i < 3; i++) {
+            y = y * (1.5F - 0.5F * x * y * y);
+        }
+        return y;
+#endif
+    } else {
+        return static_cast<Type>(1) / std::sqrt(x);
+    }
+}
+
+// Get the sine of floating-point value x in radians
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type sin(Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::sincos_floating_point<Type>(x).first;
+    } else {
+        // Use standard library implementation at runtime
+        return std::sin(x);
+    }
+}
+
+// Get the cosine of floating-point value x in radians
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type cos(Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::sincos_floating_point<Type>(x).second;
+    } else {
+        // Use standard library implementation at runtime
+        return std::cos(x);
+    }
+}
+
+// Get the sine and cosine of floating-point value x in radians
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr std::pair<Type, Type> sincos(Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::sincos_floating_point<Type>(x);
+    } else {
+        // Use standard library implementation at runtime
+        return {std::sin(x), std::cos(x)};
+    }
+}
+
+// Get the tangent of floating-point value x in radians
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type tan(Type x) {
+    if (std::is_constant_evaluated()) {
+        const auto [s, c] = constexpr_impl::sincos_floating_point<Type>(x);
+        return s / c;
+    } else {
+        // Use standard library implementation at runtime
+        return std::tan(x);
+    }
+}
+
+// Get the angle in radians of the point (x, y), in [-pi, pi]
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type atan2(Type y, Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::atan2_floating_point<Type>(y, x);
+    } else {
+        // Use standard library implementation at runtime
+        return std::atan2(y, x);
+    }
+}
+
+// Get the arc cosine of floating-point value x in radians, in [0, pi]
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type acos(Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::acos_floating_point<Type>(x);
+    } else {
+        // Use standard library implementation at runtime
+        return std::acos(x);
+    }
+}
+
+// Get e raised to floating-point value x
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type exp(Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::exp_floating_point<Type>(x);
+    } else {
+        // Use standard library implementation at runtime
+        return std::exp(x);
+    }
+}
+
+// Get the natural logarithm of floating-point value x
+template<typename Type>
+requires IsFloatingPoint<Type>
+constexpr Type log(Type x) {
+    if (std::is_constant_evaluated()) {
+        return constexpr_impl::log_floating_point<Type>(x);
+    } else {
+        // Use standard library implementation at runtime
+        return std::log(x);
+    }
+}
+
 // Check approximate equality of two floating-point values a and b
 template<typename Type>
 requires IsFloatingPoint<Type>
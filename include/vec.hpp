@@ -7,11 +7,14 @@
 #include <numeric>
 #include <iostream>
 #include <iterator>
+#include <stdexcept>
 #include <type_traits>
 
 #include <cmath>
 #include <cstddef>
 
+#include "instrument.hpp"
+#include "simd.hpp"
 #include "utils.hpp"
 
 using std::size_t;
@@ -59,6 +62,9 @@ class Vec {
     // Type alias for convenience
     using VecT = Vec<Type, M>;
 
+    // Whether run-time arithmetic is routed through SIMD kernels (see simd.hpp)
+    static constexpr bool kSimd = simd::kEnabled<Type, M>;
+
 public:
     // Construct M-dimensional vector with zero-init elements
     // TODO: consider uninitialized constructor
@@ -71,7 +77,7 @@ public:
 
     // Construct M-dimensional vector from another vector
     template <size_t N>
-    constexpr explicit Vec(const Vec<Type, N>& other) {
+    constexpr explicit Vec(const Vec<Type, N>& other) : elems_{} {
         std::copy(other.cbegin(),
                   other.cbegin() + std::min(M, N),
                   begin());
@@ -122,12 +128,18 @@ public:
 
     // Get reference to element at specified index (with bounds check)
     constexpr Type& at(size_t index) {
-        return elems_.at(index);
+        if (index >= M) {
+            throw std::out_of_range("Vec::at");
+        }
+        return elems_[index];
     }
 
     // Get const reference to element at specified index (with bounds check)
     constexpr const Type& at(size_t index) const {
-        return elems_.at(index);
+        if (index >= M) {
+            throw std::out_of_range("Vec::at");
+        }
+        return elems_[index];
     }
 
     // Get begin iterator for underlying array
@@ -142,12 +154,12 @@ public:
 
     // Get end iterator for underlying array
     constexpr auto end() {
-        return elems_.end();
+        return elems_.begin() + M;
     }
 
     // Get const end iterator for underlying array
     constexpr auto cend() const {
-        return elems_.cend();
+        return elems_.cbegin() + M;
     }
 
     // Get reference to element x
@@ -208,11 +220,24 @@ public:
         return dot(*this, *this);
     }
 
+    // Get approximate reciprocal of euclidean (L2) norm (see utils::rsqrt_fast() for the error bound)
+    constexpr Type euclidean_inv() const {
+        return utils::rsqrt_fast(euclidean2());
+    }
+
     // Get normalization of vector
-    [[nodiscard]] constexpr VecT normalize() const {
-        return (*this * (1.0F / euclidean()));
+    [[nodiscard]] constexpr VecT normalize(VEC_SOURCE_LOCATION) const {
+        VEC_RECORD(Normalize, Type, M, location);
+        return (*this * (static_cast<Type>(1) / euclidean()));
     }
 
+    // Get approximate normalization of vector, avoiding the square root and division
+    // Note: for float, each element is within a relative 1e-6 of normalize() (also for subnormal
+    // squared lengths); other types match normalize() up to rounding
+    [[nodiscard]] constexpr VecT normalize_fast(VEC_SOURCE_LOCATION) const {
+        VEC_RECORD(NormalizeFast, Type, M, location);
+        return (*this * euclidean_inv());
+    }
 
     // Fill the vector with the specified value
     constexpr void fill(Type fill_value) {
@@ -240,6 +265,12 @@ public:
 
     // Add M-dimensional vector to this M-dimensional vector
     constexpr VecT& operator+=(const VecT& rhs) {
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::add(elems_.data(), rhs.elems_.data(), elems_.data());
+                return *this;
+            }
+        }
         std::transform(cbegin(), cend(), // this input
                        rhs.cbegin(),     // rhs input
                        begin(),          // output
@@ -249,6 +280,12 @@ public:
 
     // Subtract M-dimensional vector from this M-dimensional vector
     constexpr VecT& operator-=(const VecT& rhs) {
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::sub(elems_.data(), rhs.elems_.data(), elems_.data());
+                return *this;
+            }
+        }
         std::transform(cbegin(), cend(), // this input
                        rhs.cbegin(),     // rhs input
                        begin(),          // output
@@ -258,6 +295,12 @@ public:
 
     // Multiply this M-dimensional vector by scalar
     constexpr VecT& operator*=(Type rhs) {
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::scale(elems_.data(), rhs, elems_.data());
+                return *this;
+            }
+        }
         auto mult_by_rhs = [rhs](Type lhs_elem) { return lhs_elem * rhs; };
         std::transform(cbegin(), cend(), // this input
                        begin(),          // output
@@ -267,6 +310,12 @@ public:
 
     // Divide this M-dimensional vector by scalar
     constexpr VecT& operator/=(Type rhs) {
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::div(elems_.data(), rhs, elems_.data());
+                return *this;
+            }
+        }
         auto div_by_rhs = [rhs](Type lhs_elem) { return lhs_elem / rhs; };
         std::transform(cbegin(), cend(), // this input
                        begin(),          // output
@@ -281,6 +330,12 @@ public:
     // Get negation of M-dimensional vector
     friend constexpr VecT operator-(const VecT& rhs) {
         VecT out;
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::neg(rhs.elems_.data(), out.elems_.data());
+                return out;
+            }
+        }
         std::transform(rhs.cbegin(), rhs.cend(), // rhs input
                        out.begin(),              // output
                        std::negate());           // operation
@@ -300,6 +355,12 @@ public:
     // Add two M-dimensional vectors
     friend constexpr VecT operator+(const VecT& lhs, const VecT& rhs) {
         VecT out;
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::add(lhs.elems_.data(), rhs.elems_.data(), out.elems_.data());
+                return out;
+            }
+        }
         std::transform(lhs.cbegin(), lhs.cend(), // lhs input
                        rhs.cbegin(),             // rhs input
                        out.begin(),              // output
@@ -310,6 +371,12 @@ public:
     // Subtract two M-dimensional vectors
     friend constexpr VecT operator-(const VecT& lhs, const VecT& rhs) {
         VecT out;
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::sub(lhs.elems_.data(), rhs.elems_.data(), out.elems_.data());
+                return out;
+            }
+        }
         std::transform(lhs.cbegin(), lhs.cend(), // lhs input
                        rhs.cbegin(),             // rhs input
                        out.begin(),              // output
@@ -320,6 +387,12 @@ public:
     // Multiply M-dimensional vector by scalar
     friend constexpr VecT operator*(const VecT& lhs, Type rhs) {
         VecT out;
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::scale(lhs.elems_.data(), rhs, out.elems_.data());
+                return out;
+            }
+        }
         auto mult_by_rhs = [rhs](Type lhs_elem) { return lhs_elem * rhs; };
         std::transform(lhs.cbegin(), lhs.cend(), // lhs input
                        out.begin(),              // output
@@ -335,6 +408,12 @@ public:
     // Divide M-dimensional vector by scalar
     friend constexpr VecT operator/(const VecT& lhs, Type rhs) {
         VecT out;
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::div(lhs.elems_.data(), rhs, out.elems_.data());
+                return out;
+            }
+        }
         auto div_by_rhs = [rhs](Type lhs_elem) { return lhs_elem / rhs; };
         std::transform(lhs.cbegin(), lhs.cend(), // lhs input
                        out.begin(),              // output
@@ -359,6 +438,12 @@ public:
     friend constexpr bool approx_eq(VecT a, VecT b,
                                     Type epsilon = utils::kFloatEqDefaultEpsilon<Type>,
                                     Type abs_threshold = utils::kFloatEqDefaultAbsThreshold<Type>) {
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                return simd::approx_eq<Type, M>(a.elems_.data(), b.elems_.data(),
+                                                epsilon, abs_threshold);
+            }
+        }
         auto float_compare = [epsilon, abs_threshold](const Type& a_elem, const Type& b_elem) {
             return utils::floating_point_eq<Type>(a_elem, b_elem, epsilon, abs_threshold);
         };
@@ -369,6 +454,11 @@ public:
 
     // Get the dot product of M-dimensional vectors a and b
     friend constexpr Type dot(const VecT& a, const VecT& b) {
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                return simd::dot<Type, M>(a.elems_.data(), b.elems_.data());
+            }
+        }
         return std::inner_product(a.cbegin(), a.cend(),  // a input
                                   b.cbegin(),            // b input
                                   static_cast<Type>(0)); // init val
@@ -431,9 +521,50 @@ public:
         return a - project_onto_unit(a, b);
     }
 
+    // Get a * b + c elementwise for M-dimensional vectors (see utils::fma() for rounding)
+    friend constexpr VecT fma(const VecT& a, const VecT& b, const VecT& c) {
+        VecT out;
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::fma(a.elems_.data(), b.elems_.data(), c.elems_.data(), out.elems_.data());
+                return out;
+            }
+        }
+        for (size_t i = 0; i < M; i++) {
+            out[i] = utils::fma(a[i], b[i], c[i]);
+        }
+        return out;
+    }
+
+    // Get a * s + b for M-dimensional vectors a and b and scalar s (e.g. ray evaluation s + t * v)
+    friend constexpr VecT madd(const VecT& a, Type s, const VecT& b) {
+        VecT out;
+        if constexpr (kSimd) {
+            if (!std::is_constant_evaluated()) {
+                simd::madd(a.elems_.data(), s, b.elems_.data(), out.elems_.data());
+                return out;
+            }
+        }
+        for (size_t i = 0; i < M; i++) {
+            out[i] = utils::fma(a[i], s, b[i]);
+        }
+        return out;
+    }
+
+    // Linearly interpolate between M-dimensional vectors a and b by t
+    // Note: evaluated as t * b + (a - t * a), so t = 0 and t = 1 give exactly a and b
+    friend constexpr VecT lerp(const VecT& a, const VecT& b, Type t) {
+        return madd(b, t, madd(a, -t, a));
+    }
+
+    // Linearly interpolate between M-dimensional vectors a and b by per-element weights t
+    friend constexpr VecT mix(const VecT& a, const VecT& b, const VecT& t) {
+        return fma(t, b, fma(-t, a, a));
+    }
+
 private:
-    // Vector elements
-    std::array<Type, M> elems_;
+    // Vector elements (3D vectors carry an unused padding lane when SIMD is enabled)
+    alignas(simd::kAlignment<Type, M>) std::array<Type, simd::kStorageSize<Type, M>> elems_;
 };
 
 } // namespace vec
\ No newline at end of file
@@ -0,0 +1,472 @@
+// Structure-of-arrays vector container class template definition
+//
+// VecArray<Type, M> holds N M-dimensional vectors as M separate contiguous component streams
+// (x[0..N), y[0..N), ...) rather than N interleaved Vec values. Batch kernels over whole arrays then
+// operate on full SIMD registers of one component at a time: for float and double on x86, the
+// widest registers the CPU supports (see dispatch.hpp); otherwise four vectors per instruction with
+// VEC_ENABLE_SIMD, or plain loops the compiler can auto-vectorize.
+//
+// Each batch kernel performs, per vector, the same operations in the same order as the matching
+// Vec member/friend function in vec.hpp, so results agree exactly with element-by-element use of
+// Vec. Kernels writing to an output array read all inputs for an index before writing it, so the
+// output may alias an input.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+#include <vector>
+
+#include "dispatch.hpp"
+#include "simd.hpp"
+#include "vec.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Forward declaration
+template<typename Type, size_t M>
+class VecArray;
+
+// Aliases for supported types and sizes
+using VecArray2f = VecArray<float, 2>;
+using VecArray3f = VecArray<float, 3>;
+using VecArray4f = VecArray<float, 4>;
+
+using VecArray2d = VecArray<double, 2>;
+using VecArray3d = VecArray<double, 3>;
+using VecArray4d = VecArray<double, 4>;
+
+using VecArray2ld = VecArray<long double, 2>;
+using VecArray3ld = VecArray<long double, 3>;
+using VecArray4ld = VecArray<long double, 4>;
+
+// Structure-of-arrays vector container class template
+template<typename Type, size_t M>
+class VecArray {
+    // Template parameter assertions
+    static_assert((M >= 2) && (M <= 4), "Vector size must be 2, 3, or 4");
+    static_assert(std::is_floating_point_v<Type>, "Vector type must be floating-point");
+
+    // Type aliases for convenience
+    using VecT = Vec<Type, M>;
+    using VecArrayT = VecArray<Type, M>;
+
+public:
+    // Construct empty array
+    VecArray() = default;
+
+    // Construct array of count zero vectors
+    explicit VecArray(size_t count) {
+        resize(count);
+    }
+
+    // Construct array by scattering the provided vectors into component streams
+    explicit VecArray(std::span<const VecT> vecs) {
+        resize(vecs.size());
+        scatter(vecs);
+    }
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the number of vectors in the array
+    size_t size() const {
+        return streams_[0].size();
+    }
+
+    // Check if the array holds no vectors
+    bool empty() const {
+        return streams_[0].empty();
+    }
+
+    // Resize the array to count vectors (new vectors are zero)
+    void resize(size_t count) {
+        for (auto& stream : streams_) {
+            stream.resize(count, static_cast<Type>(0));
+        }
+    }
+
+    // Reserve capacity for count vectors
+    void reserve(size_t count) {
+        for (auto& stream : streams_) {
+            stream.reserve(count);
+        }
+    }
+
+    // Remove all vectors from the array
+    void clear() {
+        for (auto& stream : streams_) {
+            stream.clear();
+        }
+    }
+
+    // Get contiguous stream of component k for all vectors
+    std::span<Type> component(size_t k) {
+        return streams_.at(k);
+    }
+
+    // Get read-only contiguous stream of component k for all vectors
+    std::span<const Type> component(size_t k) const {
+        return streams_.at(k);
+    }
+
+    // Get stream of x components
+    std::span<Type> x() { return streams_[0]; }
+    std::span<const Type> x() const { return streams_[0]; }
+
+    // Get stream of y components
+    std::span<Type> y() requires IsAtLeast2D<M> { return streams_[1]; }
+    std::span<const Type> y() const requires IsAtLeast2D<M> { return streams_[1]; }
+
+    // Get stream of z components
+    std::span<Type> z() requires IsAtLeast3D<M> { return streams_[2]; }
+    std::span<const Type> z() const requires IsAtLeast3D<M> { return streams_[2]; }
+
+    // Get stream of w components
+    std::span<Type> w() requires Is4D<M> { return streams_[3]; }
+    std::span<const Type> w() const requires Is4D<M> { return streams_[3]; }
+
+    // Gather the components of vector i into a Vec
+    VecT gather(size_t i) const {
+        VecT out;
+        for (size_t k = 0; k < M; k++) {
+            out[k] = streams_[k][i];
+        }
+        return out;
+    }
+
+    // Gather vectors [first, first + out.size()) into a contiguous range of Vec
+    void gather(std::span<VecT> out, size_t first = 0) const {
+        assert(first + out.size() <= size());
+        for (size_t k = 0; k < M; k++) {
+            const Type* stream = streams_[k].data() + first;
+            for (size_t i = 0; i < out.size(); i++) {
+                out[i][k] = stream[i];
+            }
+        }
+    }
+
+    // Scatter the components of v into vector i
+    void scatter(size_t i, const VecT& v) {
+        for (size_t k = 0; k < M; k++) {
+            streams_[k][i] = v[k];
+        }
+    }
+
+    // Scatter a contiguous range of Vec into vectors [first, first + vecs.size())
+    void scatter(std::span<const VecT> vecs, size_t first = 0) {
+        assert(first + vecs.size() <= size());
+        for (size_t k = 0; k < M; k++) {
+            Type* stream = streams_[k].data() + first;
+            for (size_t i = 0; i < vecs.size(); i++) {
+                stream[i] = vecs[i][k];
+            }
+        }
+    }
+
+    // Append vector v to the end of the array
+    void push_back(const VecT& v) {
+        for (size_t k = 0; k < M; k++) {
+            streams_[k].push_back(v[k]);
+        }
+    }
+
+    // Get euclidean (L2) norm squared of every vector
+    std::vector<Type> euclidean2() const {
+        std::vector<Type> out(size());
+        euclidean2_kernel(*this, out);
+        return out;
+    }
+
+    // Get normalization of every vector
+    [[nodiscard]] VecArrayT normalize() const {
+        VecArrayT out(size());
+        normalize_kernel(*this, out);
+        return out;
+    }
+
+    // Get approximate normalization of every vector (see Vec::normalize_fast() for the error bound)
+    [[nodiscard]] VecArrayT normalize_fast() const {
+        VecArrayT out(size());
+        normalize_fast_kernel(*this, out);
+        return out;
+    }
+
+    /**************************************************************************
+     * MEMBER OPERATORS
+     **************************************************************************/
+
+    // Add array of M-dimensional vectors to this array elementwise
+    VecArrayT& operator+=(const VecArrayT& rhs) {
+        add(*this, rhs, *this);
+        return *this;
+    }
+
+    // Subtract array of M-dimensional vectors from this array elementwise
+    VecArrayT& operator-=(const VecArrayT& rhs) {
+        subtract(*this, rhs, *this);
+        return *this;
+    }
+
+    // Multiply every vector in this array by scalar
+    VecArrayT& operator*=(Type rhs) {
+        scale(*this, rhs, *this);
+        return *this;
+    }
+
+    /**************************************************************************
+     * FRIEND OPERATORS
+     **************************************************************************/
+
+    // Add two arrays of M-dimensional vectors elementwise
+    friend VecArrayT operator+(const VecArrayT& lhs, const VecArrayT& rhs) {
+        VecArrayT out(lhs.size());
+        add(lhs, rhs, out);
+        return out;
+    }
+
+    // Subtract two arrays of M-dimensional vectors elementwise
+    friend VecArrayT operator-(const VecArrayT& lhs, const VecArrayT& rhs) {
+        VecArrayT out(lhs.size());
+        subtract(lhs, rhs, out);
+        return out;
+    }
+
+    // Multiply every vector in array by scalar
+    friend VecArrayT operator*(const VecArrayT& lhs, Type rhs) {
+        VecArrayT out(lhs.size());
+        scale(lhs, rhs, out);
+        return out;
+    }
+
+    // Multiply every vector in array by scalar (reverse operand order)
+    friend VecArrayT operator*(Type lhs, const VecArrayT& rhs) {
+        return rhs * lhs;
+    }
+
+    /**************************************************************************
+     * FRIEND FUNCTIONS (BATCH KERNELS)
+     *
+     * Each kernel writes into caller-provided output sized to match the inputs.
+     **************************************************************************/
+
+    // out[i] = a[i] + b[i]
+    friend void add(const VecArrayT& a, const VecArrayT& b, VecArrayT& out) {
+        assert((a.size() == b.size()) && (a.size() == out.size()));
+        for (size_t k = 0; k < M; k++) {
+            const Type* pa = a.streams_[k].data();
+            const Type* pb = b.streams_[k].data();
+            Type* po = out.streams_[k].data();
+            dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+                simd::store(po + i, simd::load<Lane>(pa + i) + simd::load<Lane>(pb + i));
+            });
+        }
+    }
+
+    // out[i] = a[i] - b[i]
+    friend void subtract(const VecArrayT& a, const VecArrayT& b, VecArrayT& out) {
+        assert((a.size() == b.size()) && (a.size() == out.size()));
+        for (size_t k = 0; k < M; k++) {
+            const Type* pa = a.streams_[k].data();
+            const Type* pb = b.streams_[k].data();
+            Type* po = out.streams_[k].data();
+            dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+                simd::store(po + i, simd::load<Lane>(pa + i) - simd::load<Lane>(pb + i));
+            });
+        }
+    }
+
+    // out[i] = a[i] * s
+    friend void scale(const VecArrayT& a, Type s, VecArrayT& out) {
+        assert(a.size() == out.size());
+        for (size_t k = 0; k < M; k++) {
+            const Type* pa = a.streams_[k].data();
+            Type* po = out.streams_[k].data();
+            dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+                simd::store(po + i, simd::load<Lane>(pa + i) * Lane(s));
+            });
+        }
+    }
+
+    // out[i] = dot(a[i], b[i])
+    friend void dot(const VecArrayT& a, const VecArrayT& b, std::span<Type> out) {
+        assert((a.size() == b.size()) && (a.size() == out.size()));
+        dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+            simd::store(out.data() + i, dot_lane<Lane>(a, b, i));
+        });
+    }
+
+    // Get dot(a[i], b[i]) for every vector pair
+    friend std::vector<Type> dot(const VecArrayT& a, const VecArrayT& b) {
+        std::vector<Type> out(a.size());
+        dot(a, b, out);
+        return out;
+    }
+
+    // out[i] = cross(a[i], b[i])
+    friend void cross(const VecArrayT& a, const VecArrayT& b, VecArrayT& out) requires Is3D<M> {
+        assert((a.size() == b.size()) && (a.size() == out.size()));
+        dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+            const auto [ax, ay, az] = load_lanes<Lane>(a, i);
+            const auto [bx, by, bz] = load_lanes<Lane>(b, i);
+            simd::store(out.streams_[0].data() + i, ay * bz - az * by);
+            simd::store(out.streams_[1].data() + i, az * bx - ax * bz);
+            simd::store(out.streams_[2].data() + i, ax * by - ay * bx);
+        });
+    }
+
+    // Get cross(a[i], b[i]) for every vector pair
+    friend VecArrayT cross(const VecArrayT& a, const VecArrayT& b) requires Is3D<M> {
+        VecArrayT out(a.size());
+        cross(a, b, out);
+        return out;
+    }
+
+    // out[i] = a[i].euclidean2()
+    friend void euclidean2(const VecArrayT& a, std::span<Type> out) {
+        euclidean2_kernel(a, out);
+    }
+
+    // out[i] = euclidean2(a[i], b[i])
+    friend void euclidean2(const VecArrayT& a, const VecArrayT& b, std::span<Type> out) {
+        euclidean2_kernel(a, b, out);
+    }
+
+    // Get euclidean2(a[i], b[i]) for every vector pair
+    friend std::vector<Type> euclidean2(const VecArrayT& a, const VecArrayT& b) {
+        std::vector<Type> out(a.size());
+        euclidean2_kernel(a, b, out);
+        return out;
+    }
+
+    // out[i] = a[i].normalize()
+    friend void normalize(const VecArrayT& a, VecArrayT& out) {
+        normalize_kernel(a, out);
+    }
+
+    // out[i] = a[i].normalize_fast()
+    friend void normalize_fast(const VecArrayT& a, VecArrayT& out) {
+        normalize_fast_kernel(a, out);
+    }
+
+    // out[i] = project_onto(a[i], b[i])
+    friend void project_onto(const VecArrayT& a, const VecArrayT& b, VecArrayT& out) {
+        assert((a.size() == b.size()) && (a.size() == out.size()));
+        dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+            const auto pb = load_lanes<Lane>(b, i);
+            const Lane a_dot_b = dot_lane<Lane>(a, b, i);
+            const Lane b_norm2 = dot_lane<Lane>(b, b, i);
+            for (size_t k = 0; k < M; k++) {
+                simd::store(out.streams_[k].data() + i, (pb[k] * a_dot_b) / b_norm2);
+            }
+        });
+    }
+
+    // Get project_onto(a[i], b[i]) for every vector pair
+    friend VecArrayT project_onto(const VecArrayT& a, const VecArrayT& b) {
+        VecArrayT out(a.size());
+        project_onto(a, b, out);
+        return out;
+    }
+
+    // out[i] = reject_from(a[i], b[i])
+    friend void reject_from(const VecArrayT& a, const VecArrayT& b, VecArrayT& out) {
+        assert((a.size() == b.size()) && (a.size() == out.size()));
+        dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+            const auto pa = load_lanes<Lane>(a, i);
+            const auto pb = load_lanes<Lane>(b, i);
+            const Lane a_dot_b = dot_lane<Lane>(a, b, i);
+            const Lane b_norm2 = dot_lane<Lane>(b, b, i);
+            for (size_t k = 0; k < M; k++) {
+                simd::store(out.streams_[k].data() + i, pa[k] - (pb[k] * a_dot_b) / b_norm2);
+            }
+        });
+    }
+
+    // Get reject_from(a[i], b[i]) for every vector pair
+    friend VecArrayT reject_from(const VecArrayT& a, const VecArrayT& b) {
+        VecArrayT out(a.size());
+        reject_from(a, b, out);
+        return out;
+    }
+
+private:
+    // Kernel for euclidean2() (separate so the member and friend overloads don't hide each other)
+    static void euclidean2_kernel(const VecArrayT& a, std::span<Type> out) {
+        assert(a.size() == out.size());
+        dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+            simd::store(out.data() + i, dot_lane<Lane>(a, a, i));
+        });
+    }
+
+    // Kernel for euclidean2(a, b)
+    static void euclidean2_kernel(const VecArrayT& a, const VecArrayT& b, std::span<Type> out) {
+        assert((a.size() == b.size()) && (a.size() == out.size()));
+        dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+            const auto pa = load_lanes<Lane>(a, i);
+            const auto pb = load_lanes<Lane>(b, i);
+            Lane acc(static_cast<Type>(0));
+            for (size_t k = 0; k < M; k++) {
+                const Lane diff = pa[k] - pb[k];
+                acc = acc + diff * diff;
+            }
+            simd::store(out.data() + i, acc);
+        });
+    }
+
+    // Kernel for normalize_fast() (separate so the member and friend overloads don't hide each other)
+    // Note: not dispatched, since the reciprocal square root estimate differs between ISAs
+    static void normalize_fast_kernel(const VecArrayT& a, VecArrayT& out) {
+        assert(a.size() == out.size());
+        simd::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+            const auto pa = load_lanes<Lane>(a, i);
+            const Lane inv_norm = simd::lane_rsqrt_fast(dot_lane<Lane>(a, a, i));
+            for (size_t k = 0; k < M; k++) {
+                simd::store(out.streams_[k].data() + i, pa[k] * inv_norm);
+            }
+        });
+    }
+
+    // Kernel for normalize() (separate so the member and friend overloads don't hide each other)
+    static void normalize_kernel(const VecArrayT& a, VecArrayT& out) {
+        assert(a.size() == out.size());
+        dispatch::for_each_lane<Type>(a.size(), [&]<typename Lane>(size_t i) {
+            const auto pa = load_lanes<Lane>(a, i);
+            const Lane norm = simd::lane_sqrt(dot_lane<Lane>(a, a, i));
+            const Lane inv_norm = Lane(static_cast<Type>(1)) / norm;
+            for (size_t k = 0; k < M; k++) {
+                simd::store(out.streams_[k].data() + i, pa[k] * inv_norm);
+            }
+        });
+    }
+
+    // Load all M components of the lane starting at vector i
+    template<typename Lane>
+    static std::array<Lane, M> load_lanes(const VecArrayT& a, size_t i) {
+        std::array<Lane, M> out;
+        for (size_t k = 0; k < M; k++) {
+            out[k] = simd::load<Lane>(a.streams_[k].data() + i);
+        }
+        return out;
+    }
+
+    // Dot product of the lane starting at vector i (summed in the same order as Vec dot())
+    template<typename Lane>
+    static Lane dot_lane(const VecArrayT& a, const VecArrayT& b, size_t i) {
+        Lane acc(static_cast<Type>(0));
+        for (size_t k = 0; k < M; k++) {
+            acc = acc + simd::load<Lane>(a.streams_[k].data() + i)
+                        * simd::load<Lane>(b.streams_[k].data() + i);
+        }
+        return acc;
+    }
+
+    // Component streams (x, y, z, w)
+    std::array<std::vector<Type>, M> streams_;
+};
+
+} // namespace vec
@@ -0,0 +1,583 @@
+// Fixed-width vector packet (AoSoA) class template definition
+//
+// VecPacket<Type, M, W> holds W M-dimensional vectors as M "wide scalars" of W lanes each, e.g.
+// eight Vec3f values as three 8-lane registers (x0..x7, y0..y7, z0..z7). It exposes the same
+// operator set as Vec, but every scalar result is itself W lanes wide (Lanes<Type, W>) and every
+// comparison yields a LaneMask<Type, W>. Generic code written against Vec can therefore be
+// instantiated for packets to process W items per instruction, with select() replacing branches
+// on per-item conditions.
+//
+// Lanes are built on GCC/Clang vector extensions, so the compiler maps them onto the widest SIMD
+// registers the target supports (SSE, AVX, AVX-512), splitting wider packets as needed. Each lane
+// performs the same operations in the same order as the matching Vec function.
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "vec.hpp"
+#include "vec_array.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Forward declarations
+template<typename Type, size_t W>
+class Lanes;
+
+template<typename Type, size_t W>
+class LaneMask;
+
+template<typename Type, size_t M, size_t W>
+class VecPacket;
+
+// Aliases for supported types and sizes
+template<size_t W> using VecPacket2f = VecPacket<float, 2, W>;
+template<size_t W> using VecPacket3f = VecPacket<float, 3, W>;
+template<size_t W> using VecPacket4f = VecPacket<float, 4, W>;
+
+template<size_t W> using VecPacket2d = VecPacket<double, 2, W>;
+template<size_t W> using VecPacket3d = VecPacket<double, 3, W>;
+template<size_t W> using VecPacket4d = VecPacket<double, 4, W>;
+
+// Concepts
+template<typename Type>
+concept IsPacketType = std::is_same_v<Type, float> || std::is_same_v<Type, double>;
+template<size_t W>
+concept IsPacketWidth = (W == 2) || (W == 4) || (W == 8) || (W == 16);
+
+/******************************************************************************
+ * LANE MASK
+ ******************************************************************************/
+
+// Per-lane boolean result of comparing two Lanes values
+template<typename Type, size_t W>
+class LaneMask {
+    friend class Lanes<Type, W>;
+
+    // Integer vector of the same width as Lanes<Type, W> (all bits set for true lanes)
+    using Int = std::conditional_t<sizeof(Type) == 4, std::int32_t, std::int64_t>;
+    typedef Int Reg __attribute__((vector_size(sizeof(Type) * W)));
+
+public:
+    // Construct mask with all lanes false
+    LaneMask() : reg_{} {}
+
+    // Construct mask with all lanes set to value
+    explicit LaneMask(bool value) : reg_{} {
+        reg_ = reg_ - static_cast<Int>(value);
+    }
+
+    // Get the number of lanes
+    static constexpr size_t size() {
+        return W;
+    }
+
+    // Check lane i
+    bool operator[](size_t i) const {
+        return reg_[i] != 0;
+    }
+
+    // Set lane i
+    void set(size_t i, bool value) {
+        reg_[i] = value ? static_cast<Int>(-1) : static_cast<Int>(0);
+    }
+
+    // Get lanes as a bitmask (bit i set for true lane i)
+    std::uint32_t bits() const {
+        std::uint32_t out = 0;
+        for (size_t i = 0; i < W; i++) {
+            out |= static_cast<std::uint32_t>(reg_[i] != 0) << i;
+        }
+        return out;
+    }
+
+    // Check if any lane is true
+    bool any() const {
+        return bits() != 0;
+    }
+
+    // Check if all lanes are true
+    bool all() const {
+        return bits() == ((std::uint32_t{1} << W) - 1);
+    }
+
+    // Check if no lane is true
+    bool none() const {
+        return bits() == 0;
+    }
+
+    friend LaneMask operator&(const LaneMask& lhs, const LaneMask& rhs) {
+        return from_reg(lhs.reg_ & rhs.reg_);
+    }
+
+    friend LaneMask operator|(const LaneMask& lhs, const LaneMask& rhs) {
+        return from_reg(lhs.reg_ | rhs.reg_);
+    }
+
+    friend LaneMask operator!(const LaneMask& rhs) {
+        return from_reg(~rhs.reg_);
+    }
+
+private:
+    // Wrap integer vector (factory rather than constructor: GCC can't overload on vector typedefs)
+    static LaneMask from_reg(const Reg& reg) {
+        LaneMask out;
+        out.reg_ = reg;
+        return out;
+    }
+
+    Reg reg_;
+};
+
+/******************************************************************************
+ * LANES (WIDE SCALAR)
+ ******************************************************************************/
+
+// W values of Type processed together, standing in for a scalar Type in packet code
+template<typename Type, size_t W>
+class Lanes {
+    // Template parameter assertions
+    static_assert(IsPacketType<Type>, "Lane type must be float or double");
+    static_assert(IsPacketWidth<W>, "Lane count must be 2, 4, 8, or 16");
+
+    using LanesT = Lanes<Type, W>;
+    using MaskT = LaneMask<Type, W>;
+    typedef Type Reg __attribute__((vector_size(sizeof(Type) * W)));
+
+public:
+    // Construct lanes with zero-init values
+    Lanes() : reg_{} {}
+
+    // Construct lanes by broadcasting value to every lane (adding to zero would lose -0)
+    Lanes(Type value) {
+        for (size_t i = 0; i < W; i++) {
+            reg_[i] = value;
+        }
+    }
+
+    // Load W contiguous values
+    static LanesT load(const Type* src) {
+        LanesT out;
+        std::memcpy(&out.reg_, src, sizeof(Reg));
+        return out;
+    }
+
+    // Store W contiguous values
+    void store(Type* dst) const {
+        std::memcpy(dst, &reg_, sizeof(Reg));
+    }
+
+    // Get the number of lanes
+    static constexpr size_t size() {
+        return W;
+    }
+
+    // Get value of lane i
+    Type operator[](size_t i) const {
+        return reg_[i];
+    }
+
+    // Set value of lane i
+    void set(size_t i, Type value) {
+        reg_[i] = value;
+    }
+
+    LanesT& operator+=(const LanesT& rhs) { reg_ += rhs.reg_; return *this; }
+    LanesT& operator-=(const LanesT& rhs) { reg_ -= rhs.reg_; return *this; }
+    LanesT& operator*=(const LanesT& rhs) { reg_ *= rhs.reg_; return *this; }
+    LanesT& operator/=(const LanesT& rhs) { reg_ /= rhs.reg_; return *this; }
+
+    friend LanesT operator-(const LanesT& rhs) { return from_reg(-rhs.reg_); }
+    friend LanesT operator+(const LanesT& lhs, const LanesT& rhs) { return from_reg(lhs.reg_ + rhs.reg_); }
+    friend LanesT operator-(const LanesT& lhs, const LanesT& rhs) { return from_reg(lhs.reg_ - rhs.reg_); }
+    friend LanesT operator*(const LanesT& lhs, const LanesT& rhs) { return from_reg(lhs.reg_ * rhs.reg_); }
+    friend LanesT operator/(const LanesT& lhs, const LanesT& rhs) { return from_reg(lhs.reg_ / rhs.reg_); }
+
+    friend MaskT operator==(const LanesT& lhs, const LanesT& rhs) { return make_mask(lhs.reg_ == rhs.reg_); }
+    friend MaskT operator!=(const LanesT& lhs, const LanesT& rhs) { return make_mask(lhs.reg_ != rhs.reg_); }
+    friend MaskT operator<(const LanesT& lhs, const LanesT& rhs) { return make_mask(lhs.reg_ < rhs.reg_); }
+    friend MaskT operator<=(const LanesT& lhs, const LanesT& rhs) { return make_mask(lhs.reg_ <= rhs.reg_); }
+    friend MaskT operator>(const LanesT& lhs, const LanesT& rhs) { return make_mask(lhs.reg_ > rhs.reg_); }
+    friend MaskT operator>=(const LanesT& lhs, const LanesT& rhs) { return make_mask(lhs.reg_ >= rhs.reg_); }
+
+    // Per lane, choose a where mask is true and b where it is false
+    friend LanesT select(const MaskT& mask, const LanesT& a, const LanesT& b) {
+        return from_reg(mask_reg(mask) ? a.reg_ : b.reg_);
+    }
+
+    // Get the absolute value of every lane
+    friend LanesT abs(const LanesT& a) {
+        return select(a < LanesT(0), -a, a);
+    }
+
+    // Get the square root of every lane
+    friend LanesT sqrt(const LanesT& a) {
+#if defined(__AVX512F__)
+        if constexpr (sizeof(Reg) == 64) {
+            if constexpr (std::is_same_v<Type, float>) {
+                return from_reg(reinterpret_cast<Reg>(_mm512_sqrt_ps(reinterpret_cast<__m512>(a.reg_))));
+            } else {
+                return from_reg(reinterpret_cast<Reg>(_mm512_sqrt_pd(reinterpret_cast<__m512d>(a.reg_))));
+            }
+        }
+#endif
+#if defined(__AVX__)
+        if constexpr (sizeof(Reg) == 32) {
+            if constexpr (std::is_same_v<Type, float>) {
+                return from_reg(reinterpret_cast<Reg>(_mm256_sqrt_ps(reinterpret_cast<__m256>(a.reg_))));
+            } else {
+                return from_reg(reinterpret_cast<Reg>(_mm256_sqrt_pd(reinterpret_cast<__m256d>(a.reg_))));
+            }
+        }
+#endif
+#if defined(__SSE2__)
+        if constexpr (sizeof(Reg) == 16) {
+            if constexpr (std::is_same_v<Type, float>) {
+                return from_reg(reinterpret_cast<Reg>(_mm_sqrt_ps(reinterpret_cast<__m128>(a.reg_))));
+            } else {
+                return from_reg(reinterpret_cast<Reg>(_mm_sqrt_pd(reinterpret_cast<__m128d>(a.reg_))));
+            }
+        }
+#endif
+        LanesT out;
+        for (size_t i = 0; i < W; i++) {
+            out.reg_[i] = std::sqrt(a.reg_[i]);
+        }
+        return out;
+    }
+
+private:
+    // Wrap vector register (factory rather than constructor: GCC can't overload on vector typedefs)
+    static LanesT from_reg(const Reg& reg) {
+        LanesT out;
+        out.reg_ = reg;
+        return out;
+    }
+
+    // Wrap result of a lane comparison as a mask
+    template<typename MaskReg>
+    static MaskT make_mask(const MaskReg& reg) {
+        return MaskT::from_reg(reg);
+    }
+
+    // Get integer vector underlying a mask (by reference, as wide vectors by value trip -Wpsabi)
+    static const auto& mask_reg(const MaskT& mask) {
+        return mask.reg_;
+    }
+
+    Reg reg_;
+};
+
+// Choose a if mask is true, otherwise b (scalar counterpart of packet select)
+template<typename Type>
+constexpr Type select(bool mask, const Type& a, const Type& b) {
+    return mask ? a : b;
+}
+
+/******************************************************************************
+ * VECTOR PACKET
+ ******************************************************************************/
+
+// Fixed-width vector packet class template
+template<typename Type, size_t M, size_t W>
+class VecPacket {
+    // Template parameter assertions
+    static_assert((M >= 2) && (M <= 4), "Vector size must be 2, 3, or 4");
+    static_assert(IsPacketType<Type>, "Packet type must be float or double");
+    static_assert(IsPacketWidth<W>, "Packet width must be 2, 4, 8, or 16");
+
+    // Type aliases for convenience
+    using VecT = Vec<Type, M>;
+    using LanesT = Lanes<Type, W>;
+    using MaskT = LaneMask<Type, W>;
+    using VecPacketT = VecPacket<Type, M, W>;
+
+public:
+    // Construct packet of W zero vectors
+    VecPacket() = default;
+
+    // Construct packet from M per-component lane values
+    template<typename ...Args>
+    requires IsFullySpecified<M, Args...>
+    VecPacket(Args... args) : comps_{LanesT(args)...} {}
+
+    // Construct packet by broadcasting vector v to every lane
+    explicit VecPacket(const VecT& v) {
+        for (size_t k = 0; k < M; k++) {
+            comps_[k] = LanesT(v[k]);
+        }
+    }
+
+    /**************************************************************************
+     * STATIC MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Load vectors [first, first + W) from a structure-of-arrays container
+    static VecPacketT load(const VecArray<Type, M>& array, size_t first) {
+        assert(first + W <= array.size());
+        VecPacketT out;
+        for (size_t k = 0; k < M; k++) {
+            out.comps_[k] = LanesT::load(array.component(k).data() + first);
+        }
+        return out;
+    }
+
+    // Load W vectors from a contiguous range of Vec (transposing into lanes)
+    static VecPacketT load(std::span<const VecT> vecs) {
+        assert(vecs.size() >= W);
+        VecPacketT out;
+        for (size_t i = 0; i < W; i++) {
+            out.set(i, vecs[i]);
+        }
+        return out;
+    }
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the vector dimension
+    static constexpr size_t size() {
+        return M;
+    }
+
+    // Get the number of lanes (vectors) in the packet
+    static constexpr size_t width() {
+        return W;
+    }
+
+    // Store vectors into [first, first + W) of a structure-of-arrays container
+    void store(VecArray<Type, M>& array, size_t first) const {
+        assert(first + W <= array.size());
+        for (size_t k = 0; k < M; k++) {
+            comps_[k].store(array.component(k).data() + first);
+        }
+    }
+
+    // Store W vectors into a contiguous range of Vec (transposing out of lanes)
+    void store(std::span<VecT> vecs) const {
+        assert(vecs.size() >= W);
+        for (size_t i = 0; i < W; i++) {
+            vecs[i] = get(i);
+        }
+    }
+
+    // Get the vector held in lane i
+    VecT get(size_t i) const {
+        VecT out;
+        for (size_t k = 0; k < M; k++) {
+            out[k] = comps_[k][i];
+        }
+        return out;
+    }
+
+    // Set the vector held in lane i
+    void set(size_t i, const VecT& v) {
+        for (size_t k = 0; k < M; k++) {
+            comps_[k].set(i, v[k]);
+        }
+    }
+
+    // Get reference to x components
+    LanesT& x() { return comps_[0]; }
+    const LanesT& x() const { return comps_[0]; }
+
+    // Get reference to y components
+    LanesT& y() requires IsAtLeast2D<M> { return comps_[1]; }
+    const LanesT& y() const requires IsAtLeast2D<M> { return comps_[1]; }
+
+    // Get reference to z components
+    LanesT& z() requires IsAtLeast3D<M> { return comps_[2]; }
+    const LanesT& z() const requires IsAtLeast3D<M> { return comps_[2]; }
+
+    // Get reference to w components
+    LanesT& w() requires Is4D<M> { return comps_[3]; }
+    const LanesT& w() const requires Is4D<M> { return comps_[3]; }
+
+    // Get euclidean (L2) norm of every lane
+    LanesT euclidean() const {
+        return sqrt(euclidean2());
+    }
+
+    // Get euclidean (L2) norm squared of every lane
+    LanesT euclidean2() const {
+        return dot(*this, *this);
+    }
+
+    // Get normalization of every lane
+    [[nodiscard]] VecPacketT normalize() const {
+        return (*this * (LanesT(1) / euclidean()));
+    }
+
+    /**************************************************************************
+     * MEMBER OPERATORS
+     **************************************************************************/
+
+    // Get reference to component k for all lanes
+    LanesT& operator[](size_t k) {
+        return comps_[k];
+    }
+
+    // Get read-only reference to component k for all lanes
+    const LanesT& operator[](size_t k) const {
+        return comps_[k];
+    }
+
+    // Add packet to this packet
+    VecPacketT& operator+=(const VecPacketT& rhs) {
+        for (size_t k = 0; k < M; k++) {
+            comps_[k] += rhs.comps_[k];
+        }
+        return *this;
+    }
+
+    // Subtract packet from this packet
+    VecPacketT& operator-=(const VecPacketT& rhs) {
+        for (size_t k = 0; k < M; k++) {
+            comps_[k] -= rhs.comps_[k];
+        }
+        return *this;
+    }
+
+    // Multiply this packet by per-lane scalar
+    VecPacketT& operator*=(const LanesT& rhs) {
+        for (auto& comp : comps_) {
+            comp *= rhs;
+        }
+        return *this;
+    }
+
+    // Divide this packet by per-lane scalar
+    VecPacketT& operator/=(const LanesT& rhs) {
+        for (auto& comp : comps_) {
+            comp /= rhs;
+        }
+        return *this;
+    }
+
+    /**************************************************************************
+     * FRIEND OPERATORS
+     **************************************************************************/
+
+    // Get negation of packet
+    friend VecPacketT operator-(const VecPacketT& rhs) {
+        VecPacketT out;
+        for (size_t k = 0; k < M; k++) {
+            out.comps_[k] = -rhs.comps_[k];
+        }
+        return out;
+    }
+
+    // Add two packets
+    friend VecPacketT operator+(VecPacketT lhs, const VecPacketT& rhs) {
+        return lhs += rhs;
+    }
+
+    // Subtract two packets
+    friend VecPacketT operator-(VecPacketT lhs, const VecPacketT& rhs) {
+        return lhs -= rhs;
+    }
+
+    // Multiply packet by per-lane scalar (a plain Type broadcasts)
+    friend VecPacketT operator*(VecPacketT lhs, const LanesT& rhs) {
+        return lhs *= rhs;
+    }
+
+    // Multiply packet by per-lane scalar (reverse operand order)
+    friend VecPacketT operator*(const LanesT& lhs, VecPacketT rhs) {
+        return rhs *= lhs;
+    }
+
+    // Divide packet by per-lane scalar
+    friend VecPacketT operator/(VecPacketT lhs, const LanesT& rhs) {
+        return lhs /= rhs;
+    }
+
+    /**************************************************************************
+     * FRIEND FUNCTIONS
+     **************************************************************************/
+
+    // Check per lane if two packets are approximately equal (same predicate as Vec approx_eq)
+    friend MaskT approx_eq(const VecPacketT& a, const VecPacketT& b,
+                           Type epsilon = utils::kFloatEqDefaultEpsilon<Type>,
+                           Type abs_threshold = utils::kFloatEqDefaultAbsThreshold<Type>) {
+        MaskT out(true);
+        for (size_t k = 0; k < M; k++) {
+            const LanesT& ak = a.comps_[k];
+            const LanesT& bk = b.comps_[k];
+            const LanesT diff = abs(ak - bk);
+            const LanesT sum = abs(ak + bk);
+            const LanesT max = LanesT(std::numeric_limits<Type>::max());
+            const LanesT norm = select(max < sum, max, sum);
+            const LanesT scaled = LanesT(epsilon) * norm;
+            const LanesT bound = select(LanesT(abs_threshold) < scaled, scaled, LanesT(abs_threshold));
+            out = out & ((ak == bk) | (diff < bound));
+        }
+        return out;
+    }
+
+    // Get per-lane dot product of two packets
+    friend LanesT dot(const VecPacketT& a, const VecPacketT& b) {
+        LanesT out(static_cast<Type>(0));
+        for (size_t k = 0; k < M; k++) {
+            out = out + a.comps_[k] * b.comps_[k];
+        }
+        return out;
+    }
+
+    // Get per-lane cross product of two 3-dimensional packets
+    friend VecPacketT cross(const VecPacketT& a, const VecPacketT& b) requires Is3D<M> {
+        return VecPacketT{
+            a.y() * b.z() - a.z() * b.y(),
+            a.z() * b.x() - a.x() * b.z(),
+            a.x() * b.y() - a.y() * b.x()
+        };
+    }
+
+    // Get per-lane euclidean distance between two packets
+    friend LanesT euclidean(const VecPacketT& a, const VecPacketT& b) {
+        return VecPacketT{a - b}.euclidean();
+    }
+
+    // Get per-lane euclidean distance squared between two packets
+    friend LanesT euclidean2(const VecPacketT& a, const VecPacketT& b) {
+        return VecPacketT{a - b}.euclidean2();
+    }
+
+    // Project each lane of packet a onto the matching lane of packet b
+    friend VecPacketT project_onto(const VecPacketT& a, const VecPacketT& b) {
+        return (b * dot(a, b) / b.euclidean2());
+    }
+
+    // Reject each lane of packet a from the matching lane of packet b
+    friend VecPacketT reject_from(const VecPacketT& a, const VecPacketT& b) {
+        return a - project_onto(a, b);
+    }
+
+    // Per lane, choose a where mask is true and b where it is false
+    friend VecPacketT select(const MaskT& mask, const VecPacketT& a, const VecPacketT& b) {
+        VecPacketT out;
+        for (size_t k = 0; k < M; k++) {
+            out.comps_[k] = select(mask, a.comps_[k], b.comps_[k]);
+        }
+        return out;
+    }
+
+private:
+    // Per-component lanes (x, y, z, w)
+    std::array<LanesT, M> comps_{};
+};
+
+} // namespace vec
@@ -0,0 +1,470 @@
+// Non-owning vector references and strided vector views over external memory
+//
+// VecRef<Vec3f> refers to three contiguous floats owned by someone else (an interleaved vertex
+// buffer, a mapped staging buffer, another library's struct), and VecView<Vec3f> is a random-access
+// range of such references spaced a fixed stride apart:
+//
+//     struct Vertex { float position[3]; float normal[3]; float uv[2]; };  // 32-byte stride
+//     VecView<Vec3f> normals(&vertices[0].normal[0], vertices.size(), sizeof(Vertex) / sizeof(float));
+//     for (auto n : normals) {
+//         n = (n * transform).normalize();  // read, compute with Vec, write back in place
+//     }
+//
+// A reference converts implicitly to its Vec (loading the M elements), and the Vec friend operators
+// and functions (+, *, ==, dot(), cross(), lerp(), ...) are found for references too, since the Vec
+// type is the view's template argument. Assigning a Vec (or another reference) to a reference, and
+// the compound assignment operators, write the elements back. Like std::span, a reference is cheap to
+// copy and copying it never copies elements; constness of the pointee comes from the template
+// argument (VecRef<const Vec3f>, aliased as ConstVecRef<Vec3f>), not from the reference object.
+
+#pragma once
+
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+#include "vec.hpp"
+
+using std::size_t;
+
+namespace vec {
+
+// Forward declarations
+template<typename VecT>
+class VecRef;
+template<typename VecT>
+class VecView;
+
+// Aliases for read-only references and views
+template<typename VecT>
+using ConstVecRef = VecRef<const VecT>;
+template<typename VecT>
+using ConstVecView = VecView<const VecT>;
+
+// Aliases for supported types and sizes
+using VecRef2f = VecRef<Vec2f>;
+using VecRef3f = VecRef<Vec3f>;
+using VecRef4f = VecRef<Vec4f>;
+using VecView2f = VecView<Vec2f>;
+using VecView3f = VecView<Vec3f>;
+using VecView4f = VecView<Vec4f>;
+
+using VecRef2d = VecRef<Vec2d>;
+using VecRef3d = VecRef<Vec3d>;
+using VecRef4d = VecRef<Vec4d>;
+using VecView2d = VecView<Vec2d>;
+using VecView3d = VecView<Vec3d>;
+using VecView4d = VecView<Vec4d>;
+
+namespace detail {
+
+// Element type and size of a (possibly const) Vec
+template<typename VecT>
+struct VecTraits;
+
+template<typename Type, size_t M>
+struct VecTraits<Vec<Type, M>> {
+    using Elem = Type;
+    static constexpr size_t kSize = M;
+};
+
+template<typename Type, size_t M>
+struct VecTraits<const Vec<Type, M>> {
+    using Elem = const Type;
+    static constexpr size_t kSize = M;
+};
+
+} // namespace detail
+
+// Reference to M contiguous elements of external memory, used as an M-dimensional vector
+template<typename VecT>
+class VecRef {
+    // Type aliases for convenience
+    using VecV = std::remove_const_t<VecT>;
+    using Elem = typename detail::VecTraits<VecT>::Elem;
+    using Type = std::remove_const_t<Elem>;
+
+    static constexpr size_t M = detail::VecTraits<VecT>::kSize;
+    static constexpr bool kConst = std::is_const_v<VecT>;
+
+public:
+    // Construct reference to the M elements starting at data
+    constexpr explicit VecRef(Elem* data) : data_(data) {}
+
+    // Construct reference to the elements of a vector
+    constexpr explicit VecRef(VecT& v) : data_(&v[0]) {}
+
+    // Construct read-only reference from a mutable reference
+    constexpr VecRef(const VecRef<VecV>& other) requires kConst : data_(other.data()) {}
+
+    // Copy reference (refers to the same elements, no elements are copied)
+    constexpr VecRef(const VecRef& other) = default;
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the size of the referenced vector
+    constexpr size_t size() const {
+        return M;
+    }
+
+    // Get pointer to the first referenced element
+    constexpr Elem* data() const {
+        return data_;
+    }
+
+    // Get begin iterator for referenced elements
+    constexpr Elem* begin() const {
+        return data_;
+    }
+
+    // Get end iterator for referenced elements
+    constexpr Elem* end() const {
+        return data_ + M;
+    }
+
+    // Get reference to element x
+    constexpr Elem& x() const {
+        return data_[0];
+    }
+
+    // Get reference to element y
+    constexpr Elem& y() const requires IsAtLeast2D<M> {
+        return data_[1];
+    }
+
+    // Get reference to element z
+    constexpr Elem& z() const requires IsAtLeast3D<M> {
+        return data_[2];
+    }
+
+    // Get reference to element w
+    constexpr Elem& w() const requires Is4D<M> {
+        return data_[3];
+    }
+
+    // Get a copy of the referenced vector
+    constexpr VecV load() const {
+        VecV out;
+        for (size_t i = 0; i < M; i++) {
+            out[i] = data_[i];
+        }
+        return out;
+    }
+
+    // Overwrite the referenced elements with vector v
+    constexpr void store(const VecV& v) const requires (!kConst) {
+        for (size_t i = 0; i < M; i++) {
+            data_[i] = v[i];
+        }
+    }
+
+    // Get manhattan (L1) norm
+    constexpr Type manhattan() const {
+        return load().manhattan();
+    }
+
+    // Get euclidean (L2) norm
+    constexpr Type euclidean() const {
+        return load().euclidean();
+    }
+
+    // Get euclidean (L2) norm squared
+    constexpr Type euclidean2() const {
+        return load().euclidean2();
+    }
+
+    // Get approximate reciprocal of euclidean (L2) norm
+    constexpr Type euclidean_inv() const {
+        return load().euclidean_inv();
+    }
+
+    // Get normalization of referenced vector
+    [[nodiscard]] constexpr VecV normalize() const {
+        return load().normalize();
+    }
+
+    // Get approximate normalization of referenced vector
+    [[nodiscard]] constexpr VecV normalize_fast() const {
+        return load().normalize_fast();
+    }
+
+    // Fill the referenced elements with the specified value
+    constexpr void fill(Type fill_value) const requires (!kConst) {
+        for (size_t i = 0; i < M; i++) {
+            data_[i] = fill_value;
+        }
+    }
+
+    // Clear the referenced elements (reset to zero)
+    constexpr void clear() const requires (!kConst) {
+        fill(0);
+    }
+
+    /**************************************************************************
+     * MEMBER OPERATORS
+     **************************************************************************/
+
+    // Get a copy of the referenced vector
+    constexpr operator VecV() const {
+        return load();
+    }
+
+    // Get reference to element by index (no bounds check)
+    constexpr Elem& operator[](size_t index) const {
+        return data_[index];
+    }
+
+    // Overwrite the referenced elements with vector rhs
+    constexpr const VecRef& operator=(const VecV& rhs) const requires (!kConst) {
+        store(rhs);
+        return *this;
+    }
+
+    // Overwrite the referenced elements with the elements referenced by rhs (which may overlap)
+    constexpr const VecRef& operator=(const VecRef& rhs) const requires (!kConst) {
+        store(rhs.load());
+        return *this;
+    }
+
+    // Add M-dimensional vector to the referenced vector
+    constexpr const VecRef& operator+=(const VecV& rhs) const requires (!kConst) {
+        store(load() + rhs);
+        return *this;
+    }
+
+    // Subtract M-dimensional vector from the referenced vector
+    constexpr const VecRef& operator-=(const VecV& rhs) const requires (!kConst) {
+        store(load() - rhs);
+        return *this;
+    }
+
+    // Multiply the referenced vector by scalar
+    constexpr const VecRef& operator*=(Type rhs) const requires (!kConst) {
+        store(load() * rhs);
+        return *this;
+    }
+
+    // Divide the referenced vector by scalar
+    constexpr const VecRef& operator/=(Type rhs) const requires (!kConst) {
+        store(load() / rhs);
+        return *this;
+    }
+
+private:
+    // First referenced element
+    Elem* data_;
+};
+
+// Random-access range of vector references spaced a fixed number of elements apart
+template<typename VecT>
+class VecView {
+    // Type aliases for convenience
+    using VecV = std::remove_const_t<VecT>;
+    using Elem = typename detail::VecTraits<VecT>::Elem;
+
+    static constexpr size_t M = detail::VecTraits<VecT>::kSize;
+    static constexpr bool kConst = std::is_const_v<VecT>;
+
+public:
+    // Iterator over the references of a view
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = VecV;
+        using difference_type = std::ptrdiff_t;
+        using reference = VecRef<VecT>;
+
+        // Construct singular iterator
+        constexpr Iterator() = default;
+
+        // Construct iterator to vector index of the view starting at data
+        // Note: the position is kept as an index, so no pointer past the buffer is ever formed
+        constexpr Iterator(Elem* data, size_t stride, difference_type index)
+                : data_(data), stride_(stride), index_(index) {}
+
+        // Get reference to the current vector
+        constexpr reference operator*() const {
+            return reference(data_ + static_cast<size_t>(index_) * stride_);
+        }
+
+        // Get reference to the vector offset n from the current one
+        constexpr reference operator[](difference_type n) const {
+            return *(*this + n);
+        }
+
+        // Advance to the next vector
+        constexpr Iterator& operator++() {
+            index_++;
+            return *this;
+        }
+
+        // Advance to the next vector (postfix)
+        constexpr Iterator operator++(int) {
+            Iterator out = *this;
+            ++(*this);
+            return out;
+        }
+
+        // Step back to the previous vector
+        constexpr Iterator& operator--() {
+            index_--;
+            return *this;
+        }
+
+        // Step back to the previous vector (postfix)
+        constexpr Iterator operator--(int) {
+            Iterator out = *this;
+            --(*this);
+            return out;
+        }
+
+        // Advance by n vectors
+        constexpr Iterator& operator+=(difference_type n) {
+            index_ += n;
+            return *this;
+        }
+
+        // Step back by n vectors
+        constexpr Iterator& operator-=(difference_type n) {
+            index_ -= n;
+            return *this;
+        }
+
+        // Get iterator advanced by n vectors
+        friend constexpr Iterator operator+(Iterator it, difference_type n) {
+            return it += n;
+        }
+
+        // Get iterator advanced by n vectors (reverse operand order)
+        friend constexpr Iterator operator+(difference_type n, Iterator it) {
+            return it += n;
+        }
+
+        // Get iterator stepped back by n vectors
+        friend constexpr Iterator operator-(Iterator it, difference_type n) {
+            return it -= n;
+        }
+
+        // Get the number of vectors between two iterators of the same view
+        friend constexpr difference_type operator-(const Iterator& lhs, const Iterator& rhs) {
+            return lhs.index_ - rhs.index_;
+        }
+
+        // Check whether two iterators refer to the same vector
+        friend constexpr bool operator==(const Iterator& lhs, const Iterator& rhs) {
+            return lhs.index_ == rhs.index_;
+        }
+
+        // Order two iterators of the same view
+        friend constexpr auto operator<=>(const Iterator& lhs, const Iterator& rhs) {
+            return lhs.index_ <=> rhs.index_;
+        }
+
+    private:
+        // First element of the view's first vector
+        Elem* data_ = nullptr;
+
+        // Number of elements between consecutive vectors
+        size_t stride_ = M;
+
+        // Index of the current vector
+        difference_type index_ = 0;
+    };
+
+    // Construct empty view
+    constexpr VecView() = default;
+
+    // Construct view of count vectors, the first starting at data and each stride elements apart
+    constexpr VecView(Elem* data, size_t count, size_t stride = M)
+            : data_(data), count_(count), stride_(stride) {
+        assert(stride >= M);
+    }
+
+    // Construct view of every vector that fits in buffer, starting offset elements in and each
+    // stride elements apart (e.g. one attribute of an interleaved vertex buffer)
+    constexpr VecView(std::span<Elem> buffer, size_t stride = M, size_t offset = 0)
+            : VecView(buffer.data() + offset,
+                      (buffer.size() >= offset + M) ? (buffer.size() - offset - M) / stride + 1 : 0,
+                      stride) {}
+
+    // Construct read-only view from a mutable view
+    constexpr VecView(const VecView<VecV>& other) requires kConst
+            : VecView(other.data(), other.size(), other.stride()) {}
+
+    /**************************************************************************
+     * MEMBER FUNCTIONS
+     **************************************************************************/
+
+    // Get the number of vectors in the view
+    constexpr size_t size() const {
+        return count_;
+    }
+
+    // Check whether the view holds no vectors
+    constexpr bool empty() const {
+        return count_ == 0;
+    }
+
+    // Get the number of elements between consecutive vectors
+    constexpr size_t stride() const {
+        return stride_;
+    }
+
+    // Get pointer to the first element of the first vector
+    constexpr Elem* data() const {
+        return data_;
+    }
+
+    // Get begin iterator
+    constexpr Iterator begin() const {
+        return Iterator(data_, stride_, 0);
+    }
+
+    // Get end iterator
+    constexpr Iterator end() const {
+        return Iterator(data_, stride_, static_cast<std::ptrdiff_t>(count_));
+    }
+
+    // Get reference to the first vector
+    constexpr VecRef<VecT> front() const {
+        return (*this)[0];
+    }
+
+    // Get reference to the last vector
+    constexpr VecRef<VecT> back() const {
+        return (*this)[count_ - 1];
+    }
+
+    // Get view of count vectors starting at vector first
+    constexpr VecView subview(size_t first, size_t count) const {
+        assert(first + count <= count_);
+        return VecView(data_ + first * stride_, count, stride_);
+    }
+
+    /**************************************************************************
+     * MEMBER OPERATORS
+     **************************************************************************/
+
+    // Get reference to vector by index (no bounds check)
+    constexpr VecRef<VecT> operator[](size_t index) const {
+        return VecRef<VecT>(data_ + index * stride_);
+    }
+
+private:
+    // First element of the first vector
+    Elem* data_ = nullptr;
+
+    // Number of vectors
+    size_t count_ = 0;
+
+    // Number of elements between consecutive vectors
+    size_t stride_ = M;
+};
+
+} // namespace vec
@@ -0,0 +1,115 @@
+// Unit tests for the batch transform kernels
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "batch_transform.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using vec::ThreadPool;
+using vec::VecArray;
+
+// Number of vectors per test batch (spans several parallel chunks plus a partial SIMD register)
+static constexpr size_t kCount = 2 * vec::kBatchTransformGrain + 5;
+
+// Helper to generate an affine transform with a non-trivial linear part and translation
+template <typename Type, size_t M>
+AffineTransform<Type, M> get_transform() {
+    constexpr TestGrid kLinear{{
+            {1.0, 2.0, -3.0, 0.5},
+            {4.0, -5.0, 6.0, -0.5},
+            {-7.0, 8.0, 9.0, 1.5},
+            {0.25, -0.75, 2.0, 3.0},
+    }};
+    constexpr TestArray kTranslation{1.0, -2.0, 3.0, -4.0};
+    return AffineTransform<Type, M>(get_mat<Type, M>(kLinear), get_vec<Type, M>(kTranslation));
+}
+
+// Reference result: promote to homogeneous coordinates and multiply by the full matrix
+template <typename Type, size_t M>
+Vec<Type, M> reference(const AffineTransform<Type, M>& transform, const Vec<Type, M>& v, Type w) {
+    Vec<Type, M + 1> h(v);
+    h[M] = w;
+    return Vec<Type, M>(h * transform);
+}
+
+template <typename Type, size_t M>
+void check_batch_transform(ThreadPool& pool) {
+    const auto transform = get_transform<Type, M>();
+    const auto vecs = get_vecs<Type, M>(kCount, 0.25L);
+
+    std::vector<Vec<Type, M>> points(kCount);
+    std::vector<Vec<Type, M>> directions(kCount);
+    vec::transform_points(transform, vecs, points, pool);
+    vec::transform_directions(transform, vecs, directions, pool);
+
+    const VecArray<Type, M> arr(vecs);
+    VecArray<Type, M> arr_points;
+    VecArray<Type, M> arr_directions;
+    vec::transform_points(transform, arr, arr_points, pool);
+    vec::transform_directions(transform, arr, arr_directions, pool);
+    REQUIRE(arr_points.size() == kCount);
+    REQUIRE(arr_directions.size() == kCount);
+
+    for (size_t i = 0; i < kCount; i++) {
+        const auto expected_point = Approx(reference(transform, vecs[i], Type{1}));
+        const auto expected_direction = Approx(reference(transform, vecs[i], Type{0}));
+        CHECK(points[i] == expected_point);
+        CHECK(directions[i] == expected_direction);
+        CHECK(arr_points.gather(i) == expected_point);
+        CHECK(arr_directions.gather(i) == expected_direction);
+    }
+}
+
+TEST_CASE_TEMPLATE("Transform batches of points and directions", Type, VALID_TYPES) {
+    ThreadPool pool(3);
+
+    SUBCASE("2D") {
+        check_batch_transform<Type, 2>(pool);
+    }
+
+    SUBCASE("3D") {
+        check_batch_transform<Type, 3>(pool);
+    }
+}
+
+TEST_CASE_TEMPLATE("Transform batches in place", Type, VALID_TYPES) {
+    ThreadPool pool(2);
+    const auto transform = get_transform<Type, 3>();
+    const auto vecs = get_vecs<Type, 3>(kCount, 0.25L);
+
+    std::vector<Vec<Type, 3>> points(vecs);
+    vec::transform_points(transform, points, points, pool);
+
+    VecArray<Type, 3> arr(vecs);
+    vec::transform_points(transform, arr, arr, pool);
+
+    for (size_t i = 0; i < kCount; i++) {
+        const auto expected = Approx(reference(transform, vecs[i], Type{1}));
+        CHECK(points[i] == expected);
+        CHECK(arr.gather(i) == expected);
+    }
+}
+
+TEST_CASE("Thread pool covers every index exactly once") {
+    ThreadPool pool(3);
+    std::vector<int> hits(1000, 0);
+    pool.parallel_for(hits.size(), 7, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            hits[i]++;
+        }
+    });
+    CHECK(std::all_of(hits.cbegin(), hits.cend(), [](int h) { return h == 1; }));
+
+    CHECK_THROWS_AS(pool.parallel_for(100, 1, [](size_t first, size_t) {
+        if (first == 42) {
+            throw std::runtime_error("chunk failed");
+        }
+    }), std::runtime_error);
+}
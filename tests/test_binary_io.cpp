@@ -0,0 +1,229 @@
+// Unit tests for the binary container reader and writer
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "binary_io.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace io = vec::io;
+using vec::VecArray;
+
+// Number of records per test file (spans several writer chunks plus a partial chunk)
+static constexpr size_t kCount = 1000;
+static constexpr size_t kChunk = 64;
+
+// Helper to get a unique temporary file path per test, removed on destruction
+class TempFile {
+public:
+    explicit TempFile(const std::string& name)
+            : path_(std::filesystem::temp_directory_path() / ("vec_test_binary_io_" + name)) {}
+    ~TempFile() {
+        std::filesystem::remove(path_);
+    }
+    const std::filesystem::path& path() const {
+        return path_;
+    }
+
+private:
+    std::filesystem::path path_;
+};
+
+// Helper to generate distinct (non-integer) vectors
+template <typename Type, size_t M>
+std::vector<Vec<Type, M>> get_vecs() {
+    std::vector<Vec<Type, M>> out(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        for (size_t k = 0; k < M; k++) {
+            const auto value = static_cast<long double>(i) * 0.1L - static_cast<long double>(k);
+            out[i][k] = static_cast<Type>(value);
+        }
+    }
+    return out;
+}
+
+// Helper to read the raw bytes of a file
+std::vector<unsigned char> get_bytes(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+TEST_CASE_TEMPLATE("Binary vector arrays", Type, float, double) {
+    const auto vecs = get_vecs<Type, 3>();
+
+    SUBCASE("Interleaved") {
+        TempFile file("interleaved");
+        {
+            io::Writer<Vec<Type, 3>> writer(file.path(), io::Storage::Interleaved, 0, kChunk);
+            writer.write(std::span(vecs).first(10));
+            for (size_t i = 10; i < kCount; i++) {
+                writer.write(vecs[i]);
+            }
+            CHECK(writer.size() == kCount);
+        }
+        const io::Reader<Vec<Type, 3>> reader(file.path());
+        REQUIRE(reader.size() == kCount);
+        CHECK(reader.storage() == io::Storage::Interleaved);
+        CHECK(reader.elements().size() == 3 * kCount);
+        const auto view = reader.view();
+        REQUIRE(view.size() == kCount);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(reader[i] == vecs[i]);
+            CHECK(view[i].data() == &reader.elements()[3 * i]);
+            CHECK(view[i].x() == vecs[i].x()); // bitwise round trip
+        }
+        CHECK_THROWS_AS(reader.at(kCount), std::out_of_range);
+    }
+
+    SUBCASE("Planar") {
+        TempFile file("planar");
+        {
+            io::Writer<Vec<Type, 3>> writer(file.path(), io::Storage::Planar, kCount + 7, kChunk);
+            writer.write(vecs);
+        }
+        const io::Reader<Vec<Type, 3>> reader(file.path());
+        REQUIRE(reader.size() == kCount);
+        CHECK(reader.info().plane_stride == kCount + 7);
+        for (size_t k = 0; k < 3; k++) {
+            const auto stream = reader.component(k);
+            REQUIRE(stream.size() == kCount);
+            for (size_t i = 0; i < kCount; i++) {
+                CHECK(stream[i] == vecs[i][k]);
+            }
+        }
+        VecArray<Type, 3> array;
+        reader.read(array);
+        REQUIRE(array.size() == kCount);
+        for (size_t i = 0; i < kCount; i += 37) {
+            CHECK(array.gather(i) == vecs[i]);
+            CHECK(reader[i] == vecs[i]);
+        }
+    }
+
+    SUBCASE("Structure-of-arrays input") {
+        TempFile file("soa");
+        const VecArray<Type, 3> array(vecs);
+        {
+            io::Writer<Vec<Type, 3>> writer(file.path());
+            writer.write(array);
+        }
+        const io::Reader<Vec<Type, 3>> reader(file.path());
+        std::vector<Vec<Type, 3>> out(kCount);
+        reader.read(out);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out[i] == vecs[i]);
+        }
+    }
+
+    SUBCASE("Empty") {
+        TempFile file("empty");
+        io::write_file<Vec<Type, 3>>(file.path(), {});
+        const io::Reader<Vec<Type, 3>> reader(file.path());
+        CHECK(reader.size() == 0);
+        CHECK(reader.view().empty());
+    }
+}
+
+TEST_CASE_TEMPLATE("Binary matrix and transform arrays", Type, float, double) {
+    constexpr TestGrid kInput{{
+            {1.0L, 2.0L, -3.5L, 0.0L},
+            {5.0L, 6.6L, 7.0L, -9.0L},
+            {-1.0L, -2.0L, 3.0L, -4.0L},
+            {-5.0L, -6.0L, 7.0L, -8.0L},
+    }};
+    const auto m = get_mat<Type, 4>(kInput);
+    const std::vector<Mat<Type, 4>> mats{m, m.transpose(), m * static_cast<Type>(2)};
+
+    SUBCASE("Matrices in either layout") {
+        TempFile file("mats");
+        io::write_file<Mat<Type, 4>>(file.path(), mats, io::Storage::Planar);
+        const io::Reader<Mat<Type, 4>> reader(file.path());
+        const io::Reader<vec::ColMat<Type, 4>> col_reader(file.path());
+        REQUIRE(reader.size() == mats.size());
+        for (size_t i = 0; i < mats.size(); i++) {
+            CHECK(reader[i] == mats[i]);
+            for (size_t r = 0; r < 4; r++) {
+                for (size_t c = 0; c < 4; c++) {
+                    CHECK(col_reader[i](r, c) == mats[i](r, c));
+                }
+            }
+        }
+    }
+
+    SUBCASE("Affine transforms") {
+        using Transform = AffineTransform<Type, 3>;
+        const std::vector<Transform> transforms{
+                Transform(),
+                Transform(Transform::rotate_y(static_cast<Type>(0.6)),
+                          get_vec<Type, 3>({2.0, 0.0, -1.0})),
+                Transform(get_vec<Type, 3>({-0.5, 0.25, 2.0})),
+        };
+        TempFile file("transforms");
+        io::write_file<Transform>(file.path(), transforms);
+        const io::Reader<Transform> reader(file.path());
+        REQUIRE(reader.size() == transforms.size());
+        CHECK(reader.info().record_elems == 12);
+        CHECK(reader.elements().size() == 12 * transforms.size());
+        for (size_t i = 0; i < transforms.size(); i++) {
+            CHECK(reader[i] == transforms[i]);
+        }
+    }
+}
+
+TEST_CASE("Binary file header") {
+    TempFile file("header");
+    const auto vecs = get_vecs<float, 4>();
+    io::write_file<vec::Vec4f>(file.path(), std::span(vecs).first(5));
+    const auto bytes = get_bytes(file.path());
+    REQUIRE(bytes.size() == io::kHeaderSize + 5 * 4 * sizeof(float));
+
+    SUBCASE("Little-endian fields") {
+        CHECK(std::string(bytes.begin(), bytes.begin() + 4) == "VECB");
+        CHECK(bytes[4] == io::kFormatVersion);
+        CHECK(bytes[5] == 0);
+        CHECK(bytes[6] == static_cast<unsigned char>(io::RecordKind::Vec));
+        CHECK(bytes[7] == 4);
+        CHECK(bytes[8] == 4);
+        CHECK(bytes[16] == 5);
+        CHECK(bytes[17] == 0);
+    }
+
+    SUBCASE("Validation") {
+        CHECK_THROWS_AS(io::Reader<vec::Vec3f>(file.path()), std::runtime_error);
+        CHECK_THROWS_AS(io::Reader<vec::Vec4d>(file.path()), std::runtime_error);
+        CHECK_THROWS_AS(io::Reader<vec::Mat2f>(file.path()), std::runtime_error);
+        CHECK_THROWS_AS(io::Reader<vec::Vec4f>(file.path().string() + ".missing"),
+                        std::runtime_error);
+
+        // Truncated payload
+        std::filesystem::resize_file(file.path(), bytes.size() - 1);
+        CHECK_THROWS_AS(io::Reader<vec::Vec4f>(file.path()), std::runtime_error);
+
+        // Newer format version
+        auto newer = bytes;
+        newer[4] = io::kFormatVersion + 1;
+        std::ofstream out(file.path(), std::ios::binary);
+        out.write(reinterpret_cast<const char*>(newer.data()),
+                  static_cast<std::streamsize>(newer.size()));
+        out.close();
+        CHECK_THROWS_AS(io::Reader<vec::Vec4f>(file.path()), std::runtime_error);
+    }
+
+    SUBCASE("Planar capacity") {
+        TempFile planar("capacity");
+        io::Writer<vec::Vec4f> writer(planar.path(), io::Storage::Planar, 2);
+        writer.write(vecs[0]);
+        writer.write(vecs[1]);
+        CHECK_THROWS_AS(writer.write(vecs[2]), std::length_error);
+        CHECK_THROWS_AS(io::Writer<vec::Vec4f>(planar.path(), io::Storage::Planar),
+                        std::invalid_argument);
+    }
+}
@@ -0,0 +1,897 @@
+// Randomized differential tests of the run-time fast paths against reference implementations
+//
+// Each operation's run-time implementation (SIMD kernels with VEC_ENABLE_SIMD, hardware FMA and
+// reciprocal square root estimates where the compiler targets them, dispatched batch kernels) is
+// evaluated on random inputs that include edge cases: signed zeros, subnormals, magnitudes at the
+// ends of the exponent range and near-singular matrices. Scalar math functions are compared to the
+// constexpr implementations in utils.hpp (evaluated at run time), and vector and matrix operations
+// to the same formulas evaluated in long double. Batch kernels are compared to the reference with
+// every supported instruction set, and (unless the build targets FMA) must match the scalar loop
+// bit for bit. The maximum error in ULPs and the maximum relative error of each operation are
+// printed, and a test fails if an operation exceeds its bound (see the README's Accuracy section).
+//
+// This target is compiled with optimization so that fast paths are generated as in user code. Set
+// VEC_DIFF_SAMPLES to change the number of random inputs per operation (default 65536) and
+// VEC_DIFF_SEED to change the random seed.
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "batch_transform.hpp"
+#include "dispatch.hpp"
+#include "mat_batch.hpp"
+#include "utils.hpp"
+#include "vec_array.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace dispatch = vec::dispatch;
+namespace constexpr_impl = vec::utils::constexpr_impl;
+using vec::ThreadPool;
+using vec::VecArray;
+
+// Types with fast paths to test (long double has no SIMD or estimate paths)
+#define DIFF_TYPES float, double
+
+// Reference precision
+using Real = long double;
+
+// Unbounded error (the operation's error is reported only)
+static constexpr double kUnbounded = std::numeric_limits<double>::infinity();
+
+// Get an unsigned integer from the environment, or fallback if unset
+std::uint64_t env_or(const char* name, std::uint64_t fallback) {
+    const char* value = std::getenv(name);
+    return (value != nullptr) ? std::strtoull(value, nullptr, 0) : fallback;
+}
+
+// Get the number of random inputs per operation
+size_t sample_count() {
+    static const size_t count = env_or("VEC_DIFF_SAMPLES", size_t{1} << 16);
+    return count;
+}
+
+// Get the random seed
+std::uint64_t seed() {
+    static const std::uint64_t value = env_or("VEC_DIFF_SEED", 0x5eed'0f'7e57ULL);
+    return value;
+}
+
+// Get the name of a tested type
+template <typename Type>
+std::string type_name() {
+    return std::is_same_v<Type, float> ? "float" : "double";
+}
+
+// Get the size of one ULP of Type at magnitude x (the subnormal spacing below the normal range)
+template <typename Type>
+Real ulp(Real x) {
+    using Limits = std::numeric_limits<Type>;
+    x = std::fabs(x);
+    const int e = (x >= Limits::min()) ? std::ilogb(x) : Limits::min_exponent - 1;
+    return std::ldexp(Real{1}, e - (Limits::digits - 1));
+}
+
+// Check if a reference value is representable in Type without overflow
+template <typename Type>
+bool in_range(Real x) {
+    return std::isfinite(x) && (std::fabs(x) <= std::numeric_limits<Type>::max());
+}
+
+// Maximum error of one operation against its reference, checked against the documented bounds
+class ErrorStats {
+public:
+    ErrorStats(std::string name, double max_ulp, double max_rel = kUnbounded)
+            : name_(std::move(name)), bound_ulp_(max_ulp), bound_rel_(max_rel) {}
+
+    // Add one result element: error in ULPs of scale (the magnitude the error bound is relative
+    // to) and relative to the reference value
+    template <typename Type>
+    void add(Type fast, Real ref, Real scale) {
+        Real error = std::fabs(static_cast<Real>(fast) - ref);
+        if ((static_cast<Real>(fast) == ref) || (std::isnan(fast) && std::isnan(ref))) {
+            error = 0;
+        } else if (std::isnan(error)) {
+            error = std::numeric_limits<Real>::infinity();
+        }
+        add_error<Type>(error, scale);
+        if (std::fabs(ref) >= std::numeric_limits<Type>::min()) {
+            max_rel_ = std::max(max_rel_, static_cast<double>(error / std::fabs(ref)));
+        }
+    }
+
+    // Add one absolute error, measured in ULPs of Type at scale
+    template <typename Type>
+    void add_error(Real error, Real scale) {
+        max_ulp_ = std::max(max_ulp_, static_cast<double>(error / ulp<Type>(scale)));
+    }
+
+    // Count one input as evaluated
+    void sample() {
+        samples_++;
+    }
+
+    // Count one input as outside the operation's domain
+    void skip() {
+        skipped_++;
+    }
+
+    // Print the maximum errors and check them against the bounds
+    void check() const {
+        std::printf("%-40s %8.3g ulp (bound %-6.3g) %10.3g rel  %8zu samples %7zu skipped\n",
+                    name_.c_str(), max_ulp_, bound_ulp_, max_rel_, samples_, skipped_);
+        CHECK(max_ulp_ <= bound_ulp_);
+        CHECK(max_rel_ <= bound_rel_);
+        CHECK(samples_ > 0);
+    }
+
+private:
+    std::string name_;
+    double bound_ulp_;
+    double bound_rel_;
+    double max_ulp_ = 0;
+    double max_rel_ = 0;
+    size_t samples_ = 0;
+    size_t skipped_ = 0;
+};
+
+// Get the name of an operation on M-dimensional values of Type
+template <typename Type>
+std::string op_name(const char* op, size_t m = 0) {
+    std::string out = std::string(op) + "<" + type_name<Type>();
+    if (m > 0) {
+        out += ", " + std::to_string(m);
+    }
+    return out + ">";
+}
+
+// Random input generator covering ordinary values and edge cases
+template <typename Type>
+class Inputs {
+    using Limits = std::numeric_limits<Type>;
+
+public:
+    // Full exponent range of normal values
+    static constexpr int kMinExp = Limits::min_exponent - 1;
+    static constexpr int kMaxExp = Limits::max_exponent;
+
+    explicit Inputs(std::uint64_t salt) : rng_(seed() ^ (salt * 0x9e3779b97f4a7c15ULL)) {}
+
+    // Get a random value with magnitude below 2^max_exp: mostly ordinary magnitudes, plus values
+    // spread over [2^min_exp, 2^max_exp), values at both ends of that range, signed zeros and
+    // (if subnormals) subnormal values
+    Type value(int min_exp, int max_exp, bool subnormals = false) {
+        const int kind = integer(0, 99);
+        const Type sign = (integer(0, 1) == 0) ? Type(-1) : Type(1);
+        if (kind < 3) {
+            return sign * Type(0);
+        }
+        if (subnormals && (kind < 10)) {
+            const auto mantissa = static_cast<Type>(integer(1, (1LL << (Limits::digits - 2)) - 1));
+            return sign * std::ldexp(mantissa, kMinExp - (Limits::digits - 1));
+        }
+        long long e;
+        if (kind < 60) {
+            e = integer(std::max(min_exp, -8), std::min(max_exp, 8) - 1);
+        } else if (kind < 70) {
+            e = (integer(0, 1) == 0) ? min_exp : max_exp - 1;
+        } else {
+            e = integer(min_exp, max_exp - 1);
+        }
+        return sign * std::ldexp(uniform(Type(1), Type(2)), static_cast<int>(e));
+    }
+
+    // Get a random positive value (see value())
+    Type positive(int min_exp, int max_exp, bool subnormals = false) {
+        Type x = std::fabs(value(min_exp, max_exp, subnormals));
+        return (x == 0) ? std::ldexp(Type(1), min_exp) : x;
+    }
+
+    // Get a random M-dimensional vector (see value())
+    template <size_t M>
+    Vec<Type, M> vec(int min_exp, int max_exp, bool subnormals = false) {
+        Vec<Type, M> out;
+        for (size_t i = 0; i < M; i++) {
+            out[i] = value(min_exp, max_exp, subnormals);
+        }
+        return out;
+    }
+
+    // Get a random MxM matrix (see value())
+    template <size_t M>
+    Mat<Type, M> mat(int min_exp, int max_exp) {
+        Mat<Type, M> out;
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                out(i, j) = value(min_exp, max_exp);
+            }
+        }
+        return out;
+    }
+
+    // Get a random invertible MxM matrix: a quarter have a last row that is a combination of the
+    // others plus a small perturbation (near-singular), and the rest are well scaled
+    template <size_t M>
+    Mat<Type, M> invertible_mat() {
+        Mat<Type, M> out;
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                out(i, j) = uniform(Type(-1), Type(1)) + ((i == j) ? Type(integer(0, 2)) : Type(0));
+            }
+        }
+        if (integer(0, 3) == 0) {
+            const auto e = static_cast<int>(integer(4, Limits::digits - 8));
+            const Type delta = std::ldexp(Type(1), -e);
+            for (size_t j = 0; j < M; j++) {
+                Type combination = 0;
+                for (size_t i = 0; i + 1 < M; i++) {
+                    combination += out(i, j) * static_cast<Type>(i + 1) / static_cast<Type>(M);
+                }
+                out(M - 1, j) = combination + delta * uniform(Type(-1), Type(1));
+            }
+        }
+        const auto scale = static_cast<int>(integer(-16, 16));
+        for (size_t i = 0; i < M; i++) {
+            for (size_t j = 0; j < M; j++) {
+                out(i, j) = std::ldexp(out(i, j), scale);
+            }
+        }
+        return out;
+    }
+
+    // Get a uniform random value in [lo, hi)
+    Type uniform(Type lo, Type hi) {
+        return std::uniform_real_distribution<Type>(lo, hi)(rng_);
+    }
+
+    // Get a uniform random integer in [lo, hi]
+    long long integer(long long lo, long long hi) {
+        return std::uniform_int_distribution<long long>(lo, hi)(rng_);
+    }
+
+private:
+    std::mt19937_64 rng_;
+};
+
+// Helper to run fn.template operator()<M>() for M = 2, 3, 4
+template <typename Fn>
+void for_each_size(Fn fn) {
+    fn.template operator()<2>();
+    fn.template operator()<3>();
+    fn.template operator()<4>();
+}
+
+// Helper to convert a vector to reference precision
+template <typename Type, size_t M>
+std::array<Real, M> to_real(const Vec<Type, M>& v) {
+    std::array<Real, M> out;
+    for (size_t i = 0; i < M; i++) {
+        out[i] = v[i];
+    }
+    return out;
+}
+
+// Reference determinant (Laplace expansion along the first row) and its error scale (the same
+// expansion of |m|, i.e. the permanent of |m|)
+template <size_t M>
+std::pair<Real, Real> reference_determinant(const std::array<std::array<Real, M>, M>& m) {
+    if constexpr (M == 1) {
+        return {m[0][0], std::fabs(m[0][0])};
+    } else {
+        Real det = 0;
+        Real scale = 0;
+        for (size_t j = 0; j < M; j++) {
+            std::array<std::array<Real, M - 1>, M - 1> minor;
+            for (size_t i = 1; i < M; i++) {
+                for (size_t k = 0, c = 0; k < M; k++) {
+                    if (k != j) {
+                        minor[i - 1][c++] = m[i][k];
+                    }
+                }
+            }
+            const auto [minor_det, minor_scale] = reference_determinant<M - 1>(minor);
+            det += ((j % 2 == 0) ? 1 : -1) * m[0][j] * minor_det;
+            scale += std::fabs(m[0][j]) * minor_scale;
+        }
+        return {det, scale};
+    }
+}
+
+// Reference inverse (Gauss-Jordan elimination with partial pivoting), or nullopt if singular
+template <size_t M>
+std::optional<std::array<std::array<Real, M>, M>> reference_inverse(
+        std::array<std::array<Real, M>, M> a) {
+    std::array<std::array<Real, M>, M> inv{};
+    for (size_t i = 0; i < M; i++) {
+        inv[i][i] = 1;
+    }
+    for (size_t col = 0; col < M; col++) {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < M; row++) {
+            if (std::fabs(a[row][col]) > std::fabs(a[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (a[pivot][col] == 0) {
+            return std::nullopt;
+        }
+        std::swap(a[col], a[pivot]);
+        std::swap(inv[col], inv[pivot]);
+        const Real scale = 1 / a[col][col];
+        for (size_t k = 0; k < M; k++) {
+            a[col][k] *= scale;
+            inv[col][k] *= scale;
+        }
+        for (size_t row = 0; row < M; row++) {
+            if (row != col) {
+                const Real factor = a[row][col];
+                for (size_t k = 0; k < M; k++) {
+                    a[row][k] -= factor * a[col][k];
+                    inv[row][k] -= factor * inv[col][k];
+                }
+            }
+        }
+    }
+    return inv;
+}
+
+// Get the infinity norm (maximum absolute row sum) of a matrix
+template <size_t M>
+Real norm_inf(const std::array<std::array<Real, M>, M>& m) {
+    Real out = 0;
+    for (const auto& row : m) {
+        Real sum = 0;
+        for (const Real x : row) {
+            sum += std::fabs(x);
+        }
+        out = std::max(out, sum);
+    }
+    return out;
+}
+
+// Helper to convert a matrix to reference precision
+template <typename Type, size_t M>
+std::array<std::array<Real, M>, M> to_real(const Mat<Type, M>& m) {
+    std::array<std::array<Real, M>, M> out;
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < M; j++) {
+            out[i][j] = m(i, j);
+        }
+    }
+    return out;
+}
+
+/******************************************************************************
+ * SCALAR MATH
+ ******************************************************************************/
+
+// Helper to compare a run-time unary function against its constexpr implementation
+template <typename Type, typename Fast, typename Reference, typename Input>
+void check_unary(const char* op, double max_ulp, Fast fast, Reference reference, Input input) {
+    ErrorStats stats(op_name<Type>(op), max_ulp);
+    Inputs<Type> inputs(std::hash<std::string>{}(op));
+    for (size_t n = 0; n < sample_count(); n++) {
+        const Type x = input(inputs);
+        const Type ref = reference(x);
+        stats.sample();
+        stats.add(fast(x), ref, ref);
+    }
+    stats.check();
+}
+
+TEST_CASE_TEMPLATE("Run-time scalar math against constexpr implementations", Type, DIFF_TYPES) {
+    using In = Inputs<Type>;
+    const auto full_range = [](In& in) { return in.value(In::kMinExp, In::kMaxExp, true); };
+    const auto positive = [](In& in) { return in.positive(In::kMinExp, In::kMaxExp, true); };
+
+    // Correctly rounded at run time; at compile time, up to double rounding through long double
+    check_unary<Type>("sqrt", 1, [](Type x) { return vec::utils::sqrt(x); },
+                      [](Type x) { return constexpr_impl::sqrt_floating_point(x); }, positive);
+
+    // One division and one square root at run time
+    check_unary<Type>("rsqrt", 1.5, [](Type x) { return vec::utils::rsqrt(x); },
+                      [](Type x) { return constexpr_impl::rsqrt_floating_point(x); }, positive);
+
+    // Documented as accurate to a few ulps at compile time for arguments below 2^24 * pi/2
+    const auto angle = [](In& in) {
+        return in.value(In::kMinExp, std::numeric_limits<Type>::digits < 30 ? 24 : 25, true);
+    };
+    check_unary<Type>("sin", 4, [](Type x) { return vec::utils::sin(x); },
+                      [](Type x) { return constexpr_impl::sincos_floating_point(x).first; },
+                      angle);
+    check_unary<Type>("cos", 4, [](Type x) { return vec::utils::cos(x); },
+                      [](Type x) { return constexpr_impl::sincos_floating_point(x).second; },
+                      angle);
+    check_unary<Type>("acos", 4, [](Type x) { return vec::utils::acos(x); },
+                      [](Type x) { return constexpr_impl::acos_floating_point(x); },
+                      [](In& in) { return in.uniform(Type(-1), Type(1)); });
+    check_unary<Type>("exp", 4, [](Type x) { return vec::utils::exp(x); },
+                      [](Type x) { return constexpr_impl::exp_floating_point(x); },
+                      [](In& in) { return in.value(In::kMinExp, 10, true); });
+    check_unary<Type>("log", 4, [](Type x) { return vec::utils::log(x); },
+                      [](Type x) { return constexpr_impl::log_floating_point(x); }, positive);
+
+    {
+        ErrorStats stats(op_name<Type>("atan2"), 4);
+        In inputs(2);
+        for (size_t n = 0; n < sample_count(); n++) {
+            const Type y = full_range(inputs);
+            const Type x = full_range(inputs);
+            const Type ref = constexpr_impl::atan2_floating_point(y, x);
+            stats.sample();
+            stats.add(vec::utils::atan2(y, x), ref, ref);
+        }
+        stats.check();
+    }
+
+    {
+        // Rounded once in both implementations (up to rare double-rounding ties at compile time),
+        // over the whole exponent range, so products may overflow or underflow
+        ErrorStats stats(op_name<Type>("fma"), 1);
+        In inputs(3);
+        for (size_t n = 0; n < sample_count(); n++) {
+            const Type a = full_range(inputs);
+            const Type b = full_range(inputs);
+            const Type c = full_range(inputs);
+            const Type ref = constexpr_impl::fma_floating_point(a, b, c);
+            stats.sample();
+            stats.add(vec::utils::fma(a, b, c), ref, ref);
+        }
+        stats.check();
+    }
+
+    {
+        // Documented relative error bound, over positive normal and subnormal inputs; zero and
+        // infinity give exact results
+        using Limits = std::numeric_limits<Type>;
+        ErrorStats stats(op_name<Type>("rsqrt_fast"), kUnbounded,
+                         vec::utils::kRsqrtFastMaxRelError<Type>);
+        In inputs(4);
+        for (size_t n = 0; n < sample_count(); n++) {
+            const Type x = (n == 0) ? Limits::denorm_min() : positive(inputs);
+            const Real ref = 1 / std::sqrt(Real(x));
+            stats.sample();
+            stats.add(vec::utils::rsqrt_fast(x), ref, ref);
+        }
+        stats.check();
+        CHECK(vec::utils::rsqrt_fast(Type(0)) == Limits::infinity());
+        CHECK(vec::utils::rsqrt_fast(-Type(0)) == -Limits::infinity());
+        CHECK(same_bits(vec::utils::rsqrt_fast(Limits::infinity()), Type(0)));
+    }
+}
+
+/******************************************************************************
+ * REFERENCE CHECKS
+ ******************************************************************************/
+
+// Add the error of a dot product: a sum of M products, bounded by M ulps of the sum of their
+// magnitudes
+template <typename Type, size_t M>
+void add_dot(ErrorStats& stats, const Vec<Type, M>& a, const Vec<Type, M>& b, Type fast) {
+    Real ref = 0;
+    Real scale = 0;
+    for (size_t i = 0; i < M; i++) {
+        ref += Real(a[i]) * b[i];
+        scale += std::fabs(Real(a[i]) * b[i]);
+    }
+    stats.sample();
+    stats.add(fast, ref, scale);
+}
+
+// Add the error of a cross product: a difference of two products per element, bounded by 2 ulps
+// of their magnitudes
+template <typename Type>
+void add_cross(ErrorStats& stats, const Vec<Type, 3>& a, const Vec<Type, 3>& b,
+               const Vec<Type, 3>& fast) {
+    stats.sample();
+    for (size_t i = 0; i < 3; i++) {
+        const size_t j = (i + 1) % 3;
+        const size_t k = (i + 2) % 3;
+        const Real lhs = Real(a[j]) * b[k];
+        const Real rhs = Real(a[k]) * b[j];
+        stats.add(fast[i], lhs - rhs, std::fabs(lhs) + std::fabs(rhs));
+    }
+}
+
+// Get the length of a, if its squared length is a normal number of Type (the domain of the
+// length and normalization kernels)
+template <typename Type, size_t M>
+std::optional<Real> normal_length(const Vec<Type, M>& a) {
+    Real norm2 = 0;
+    for (size_t i = 0; i < M; i++) {
+        norm2 += Real(a[i]) * a[i];
+    }
+    if ((norm2 < std::numeric_limits<Type>::min()) || (norm2 > std::numeric_limits<Type>::max())) {
+        return std::nullopt;
+    }
+    return std::sqrt(norm2);
+}
+
+// Add the error of a normalized vector, relative to its largest element
+template <typename Type, size_t M>
+void add_normalized(ErrorStats& stats, const Vec<Type, M>& a, Real length,
+                    const Vec<Type, M>& fast) {
+    Real scale = 0;
+    for (size_t i = 0; i < M; i++) {
+        scale = std::max(scale, std::fabs(a[i] / length));
+    }
+    stats.sample();
+    for (size_t i = 0; i < M; i++) {
+        stats.add(fast[i], a[i] / length, scale);
+    }
+}
+
+// Add the error of a determinant, relative to the permanent of |m| (the sum of the magnitudes of
+// all terms of its expansion)
+template <typename Type, size_t M>
+void add_determinant(ErrorStats& stats, const Mat<Type, M>& m, Type fast) {
+    const auto [det, scale] = reference_determinant<M>(to_real(m));
+    stats.sample();
+    stats.add(fast, det, scale);
+}
+
+// Add the error of an inverse, in ulps of its largest element and divided by the condition of
+// the problem: the larger of the condition number of m and that of its determinant (the permanent
+// of |m| over |det(m)|), since the inverse is evaluated as the adjugate over the determinant;
+// matrices that are singular at Type's precision (or whose inverse overflows) are skipped
+template <typename Type, size_t M>
+void add_inverse(ErrorStats& stats, const Mat<Type, M>& m, const Mat<Type, M>& fast) {
+    const auto real = to_real(m);
+    const auto inv = reference_inverse<M>(real);
+    const auto [det, det_scale] = reference_determinant<M>(real);
+    const Real det_cond = det_scale / std::fabs(det);
+    const Real cond = inv ? std::max(norm_inf<M>(real) * norm_inf<M>(*inv), det_cond) : 0;
+    if (!inv || !(cond * std::numeric_limits<Type>::epsilon() < Real(1) / 16)
+            || !in_range<Type>(1 / det)) {
+        stats.skip();
+        return;
+    }
+    Real largest = 0;
+    for (const auto& row : *inv) {
+        for (const Real x : row) {
+            largest = std::max(largest, std::fabs(x));
+        }
+    }
+    stats.sample();
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < M; j++) {
+            stats.add_error<Type>(std::fabs(Real(fast(i, j)) - (*inv)[i][j]) / cond, largest);
+        }
+    }
+}
+
+// Add the error of a transformed point x * L + t, bounded by M + 1 ulps of the sum of the
+// magnitudes of its terms
+template <typename Type, size_t M>
+void add_transformed(ErrorStats& stats, const AffineTransform<Type, M>& transform,
+                     const Vec<Type, M>& x, const Vec<Type, M>& fast) {
+    stats.sample();
+    for (size_t j = 0; j < M; j++) {
+        Real ref = transform(M, j);
+        Real scale = std::fabs(ref);
+        for (size_t k = 0; k < M; k++) {
+            ref += Real(x[k]) * transform(k, j);
+            scale += std::fabs(Real(x[k]) * transform(k, j));
+        }
+        stats.add(fast[j], ref, scale);
+    }
+}
+
+/******************************************************************************
+ * VECTOR OPERATIONS
+ ******************************************************************************/
+
+TEST_CASE_TEMPLATE("Run-time vector operations against long double reference", Type, DIFF_TYPES) {
+    using In = Inputs<Type>;
+    using Limits = std::numeric_limits<Type>;
+
+    // Exponent range in which products and sums of M = 4 products stay finite
+    constexpr int kProdMin = In::kMinExp / 2;
+    constexpr int kProdMax = In::kMaxExp / 2 - 2;
+
+    for_each_size([&]<size_t M>() {
+        In inputs(10 + M);
+
+        ErrorStats dot_stats(op_name<Type>("dot", M), M);
+        for (size_t n = 0; n < sample_count(); n++) {
+            const auto a = inputs.template vec<M>(kProdMin, kProdMax, true);
+            const auto b = inputs.template vec<M>(kProdMin, kProdMax, true);
+            add_dot(dot_stats, a, b, dot(a, b));
+        }
+        dot_stats.check();
+
+        // Length (one rounding more than the squared length, halved by the square root) and
+        // normalization (plus a division and a multiplication); normalize_fast() adds the error
+        // of rsqrt_fast(), which for float is also documented as a relative bound. A quarter of
+        // the inputs are scaled down so that their squared lengths are mostly subnormal (or zero):
+        // there, normalize_fast() is compared to normalize(), which rounds the squared length the
+        // same way
+        ErrorStats length_stats(op_name<Type>("euclidean", M), M / 2.0 + 1);
+        ErrorStats normalize_stats(op_name<Type>("normalize", M), M / 2.0 + 3);
+        ErrorStats fast_stats(op_name<Type>("normalize_fast", M),
+                              vec::utils::kRsqrtFastMaxRelError<Type> / (Limits::epsilon() / 2)
+                                      + M / 2.0 + 2,
+                              std::is_same_v<Type, float> ? 1e-6 : kUnbounded);
+        for (size_t n = 0; n < sample_count(); n++) {
+            auto a = inputs.template vec<M>(kProdMin + 2, kProdMax, true);
+            if (n % 4 == 0) {
+                a = inputs.template vec<M>(-4, 4, true);
+                const auto shift = In::kMinExp / 2 - inputs.integer(6, Limits::digits / 2 + 6);
+                for (size_t i = 0; i < M; i++) {
+                    a[i] = std::ldexp(a[i], static_cast<int>(shift));
+                }
+            }
+            const auto length = normal_length(a);
+            if (!length) {
+                const auto reference = a.normalize();
+                Real scale = 0;
+                for (size_t i = 0; i < M; i++) {
+                    scale = std::max(scale, std::fabs(Real(reference[i])));
+                }
+                const auto fast = a.normalize_fast();
+                length_stats.skip();
+                normalize_stats.skip();
+                fast_stats.sample();
+                for (size_t i = 0; i < M; i++) {
+                    fast_stats.add(fast[i], reference[i], scale);
+                }
+                continue;
+            }
+            length_stats.sample();
+            length_stats.add(a.euclidean(), *length, *length);
+            add_normalized(normalize_stats, a, *length, a.normalize());
+            add_normalized(fast_stats, a, *length, a.normalize_fast());
+        }
+        length_stats.check();
+        normalize_stats.check();
+        fast_stats.check();
+
+        // Elementwise fma() and madd() round once, like the scalar fma() (compared to its constexpr
+        // implementation); lerp() rounds twice and is bounded relative to the magnitudes of the
+        // terms
+        ErrorStats fma_stats(op_name<Type>("fma", M), 1);
+        ErrorStats madd_stats(op_name<Type>("madd", M), 1);
+        ErrorStats lerp_stats(op_name<Type>("lerp", M), 4);
+        for (size_t n = 0; n < sample_count(); n++) {
+            const auto a = inputs.template vec<M>(kProdMin, kProdMax, true);
+            const auto b = inputs.template vec<M>(kProdMin, kProdMax, true);
+            const auto c = inputs.template vec<M>(kProdMin, kProdMax, true);
+            const Type s = inputs.value(kProdMin, kProdMax, true);
+            const Type t = inputs.uniform(Type(0), Type(1));
+            const auto fused = fma(a, b, c);
+            const auto scaled = madd(a, s, b);
+            const auto mixed = lerp(a, b, t);
+            fma_stats.sample();
+            madd_stats.sample();
+            lerp_stats.sample();
+            for (size_t i = 0; i < M; i++) {
+                const Type fused_ref = constexpr_impl::fma_floating_point(a[i], b[i], c[i]);
+                const Type scaled_ref = constexpr_impl::fma_floating_point(a[i], s, b[i]);
+                fma_stats.add(fused[i], fused_ref, fused_ref);
+                madd_stats.add(scaled[i], scaled_ref, scaled_ref);
+                lerp_stats.add(mixed[i], Real(a[i]) + t * (Real(b[i]) - a[i]),
+                               std::fabs(Real(a[i])) + std::fabs(t * Real(b[i]))
+                                       + std::fabs(t * Real(a[i])));
+            }
+        }
+        fma_stats.check();
+        madd_stats.check();
+        lerp_stats.check();
+    });
+
+    {
+        ErrorStats stats(op_name<Type>("cross", 3), 2);
+        In inputs(20);
+        for (size_t n = 0; n < sample_count(); n++) {
+            const auto a = inputs.template vec<3>(kProdMin, kProdMax, true);
+            const auto b = inputs.template vec<3>(kProdMin, kProdMax, true);
+            add_cross(stats, a, b, cross(a, b));
+        }
+        stats.check();
+    }
+}
+
+/******************************************************************************
+ * MATRIX OPERATIONS
+ ******************************************************************************/
+
+TEST_CASE_TEMPLATE("Run-time matrix operations against long double reference", Type, DIFF_TYPES) {
+    using In = Inputs<Type>;
+    constexpr int kProdMin = In::kMinExp / 2;
+    constexpr int kProdMax = In::kMaxExp / 2 - 2;
+
+    for_each_size([&]<size_t M>() {
+        In inputs(30 + M);
+
+        // Each element is a sum of M products: bounded by M ulps of the sum of their magnitudes
+        ErrorStats mat_mat_stats(op_name<Type>("mat * mat", M), M);
+        ErrorStats mat_vec_stats(op_name<Type>("mat * vec", M), M);
+        ErrorStats vec_mat_stats(op_name<Type>("vec * mat", M), M);
+        for (size_t n = 0; n < sample_count(); n++) {
+            const auto a = inputs.template mat<M>(kProdMin, kProdMax);
+            const auto b = inputs.template mat<M>(kProdMin, kProdMax);
+            const auto v = inputs.template vec<M>(kProdMin, kProdMax, true);
+            const auto product = a * b;
+            const auto mv = a * v;
+            const auto vm = v * a;
+            for (size_t i = 0; i < M; i++) {
+                add_dot(mat_vec_stats, a.row(i), v, mv[i]);
+                add_dot(vec_mat_stats, v, a.col(i), vm[i]);
+                for (size_t j = 0; j < M; j++) {
+                    add_dot(mat_mat_stats, a.row(i), b.col(j), product(i, j));
+                }
+            }
+        }
+        mat_mat_stats.check();
+        mat_vec_stats.check();
+        vec_mat_stats.check();
+
+        // The cofactor expansions round each term and partial sum once per level
+        ErrorStats det_stats(op_name<Type>("determinant", M), 4 * M);
+        ErrorStats inverse_stats(op_name<Type>("inverse (per cond)", M), 2 * M);
+        for (size_t n = 0; n < sample_count(); n++) {
+            const auto m = inputs.template invertible_mat<M>();
+            add_determinant(det_stats, m, m.determinant());
+            add_inverse(inverse_stats, m, m.inverse());
+        }
+        det_stats.check();
+        inverse_stats.check();
+    });
+}
+
+/******************************************************************************
+ * BATCH KERNELS
+ ******************************************************************************/
+
+// Results of the dispatched batch kernels over one set of inputs
+template <typename Type>
+struct BatchResults {
+    std::vector<Type> dots;
+    std::vector<Type> lengths2;
+    VecArray<Type, 3> crosses;
+    VecArray<Type, 3> normalized;
+    VecArray<Type, 3> projected;
+    VecArray<Type, 3> transformed;
+    std::vector<Type> determinants;
+    std::vector<Mat<Type, 4>> inverses;
+};
+
+// Run every batch kernel with the active instruction set
+template <typename Type>
+BatchResults<Type> run_batch(const VecArray<Type, 3>& a, const VecArray<Type, 3>& b,
+                             const AffineTransform<Type, 3>& transform,
+                             const std::vector<Mat<Type, 4>>& mats, ThreadPool& pool) {
+    BatchResults<Type> out;
+    out.dots = dot(a, b);
+    out.lengths2 = euclidean2(a, b);
+    out.crosses = cross(a, b);
+    out.normalized = a.normalize();
+    out.projected = project_onto(a, b);
+    vec::transform_points(transform, a, out.transformed, pool);
+    out.determinants.resize(mats.size());
+    out.inverses.resize(mats.size());
+    vec::batch_inverse(mats, std::span<Mat<Type, 4>>(out.inverses),
+                       std::span<Type>(out.determinants), pool);
+    return out;
+}
+
+// Helper to add the difference of a result from the scalar instruction set's result: any
+// difference in bits (including the sign of a zero) counts as an unbounded error
+template <typename Type>
+void add_exact(ErrorStats& stats, std::span<const Type> fast, std::span<const Type> scalar) {
+    for (size_t i = 0; i < fast.size(); i++) {
+        const bool same = same_bits(fast[i], scalar[i]);
+        stats.add_error<Type>(same ? Real(0) : std::numeric_limits<Real>::infinity(), 1);
+    }
+}
+
+// Helper to check that batch results match the scalar instruction set's results exactly
+template <typename Type>
+void check_exact(const std::string& name, const BatchResults<Type>& fast,
+                 const BatchResults<Type>& scalar) {
+    ErrorStats stats(name, 0);
+    stats.sample();
+    add_exact<Type>(stats, fast.dots, scalar.dots);
+    add_exact<Type>(stats, fast.lengths2, scalar.lengths2);
+    for (size_t k = 0; k < 3; k++) {
+        add_exact<Type>(stats, fast.crosses.component(k), scalar.crosses.component(k));
+        add_exact<Type>(stats, fast.normalized.component(k), scalar.normalized.component(k));
+        add_exact<Type>(stats, fast.projected.component(k), scalar.projected.component(k));
+        add_exact<Type>(stats, fast.transformed.component(k), scalar.transformed.component(k));
+    }
+    add_exact<Type>(stats, fast.determinants, scalar.determinants);
+    for (size_t n = 0; n < fast.inverses.size(); n++) {
+        for (size_t r = 0; r < 4; r++) {
+            const auto& fast_row = fast.inverses[n][r];
+            const auto& scalar_row = scalar.inverses[n][r];
+            add_exact<Type>(stats, std::span(fast_row.cbegin(), fast_row.cend()),
+                            std::span(scalar_row.cbegin(), scalar_row.cend()));
+        }
+    }
+    stats.check();
+}
+
+TEST_CASE_TEMPLATE("Dispatched batch kernels against long double reference", Type, DIFF_TYPES) {
+    using dispatch::Isa;
+    using In = Inputs<Type>;
+    ThreadPool pool(2);
+    const size_t count = sample_count();
+    const Isa initial = dispatch::active_isa();
+
+    // Vectors over a range where squared lengths and products are finite, including subnormals
+    In inputs(40);
+    std::vector<Vec<Type, 3>> a(count), b(count);
+    for (size_t n = 0; n < count; n++) {
+        a[n] = inputs.template vec<3>(In::kMinExp / 2, In::kMaxExp / 2 - 2, true);
+        b[n] = inputs.template vec<3>(In::kMinExp / 2, In::kMaxExp / 2 - 2, true);
+    }
+    const VecArray<Type, 3> arr_a(a), arr_b(b);
+    const AffineTransform<Type, 3> transform(inputs.template mat<3>(-8, 8),
+                                             inputs.template vec<3>(-8, 8));
+    std::vector<Mat<Type, 4>> mats(count);
+    for (auto& m : mats) {
+        m = inputs.template invertible_mat<4>();
+    }
+
+    REQUIRE(dispatch::set_isa(Isa::Scalar));
+    const auto scalar = run_batch(arr_a, arr_b, transform, mats, pool);
+    for (size_t i = 0; i < dispatch::kNumIsas; i++) {
+        const auto isa = static_cast<Isa>(i);
+        if (!dispatch::set_isa(isa)) {
+            continue;
+        }
+        const auto fast = run_batch(arr_a, arr_b, transform, mats, pool);
+        const std::string suffix = " [" + std::string(dispatch::isa_name(isa)) + "]";
+        if (dispatch::kIdenticalResults && (isa != Isa::Scalar)) {
+            check_exact(op_name<Type>("batch kernels vs scalar") + suffix, fast, scalar);
+        }
+
+        // Same bounds as the per-vector operations
+        ErrorStats dot_stats(op_name<Type>("batch dot", 3) + suffix, 3);
+        ErrorStats length_stats(op_name<Type>("batch euclidean2", 3) + suffix, 3);
+        ErrorStats cross_stats(op_name<Type>("batch cross", 3) + suffix, 2);
+        ErrorStats normalize_stats(op_name<Type>("batch normalize", 3) + suffix, 3 / 2.0 + 3);
+        ErrorStats transform_stats(op_name<Type>("batch transform_points", 3) + suffix, 4);
+        ErrorStats det_stats(op_name<Type>("batch determinant", 4) + suffix, 16);
+        ErrorStats inverse_stats(op_name<Type>("batch inverse (per cond)", 4) + suffix, 8);
+        for (size_t n = 0; n < count; n++) {
+            add_dot(dot_stats, a[n], b[n], fast.dots[n]);
+            const auto diff = a[n] - b[n];
+            if (std::isfinite(diff.x()) && std::isfinite(diff.y()) && std::isfinite(diff.z())) {
+                add_dot(length_stats, diff, diff, fast.lengths2[n]);
+            } else {
+                length_stats.skip();
+            }
+            add_cross(cross_stats, a[n], b[n], fast.crosses.gather(n));
+            if (const auto length = normal_length(a[n])) {
+                add_normalized(normalize_stats, a[n], *length, fast.normalized.gather(n));
+            } else {
+                normalize_stats.skip();
+            }
+            add_transformed(transform_stats, transform, a[n], fast.transformed.gather(n));
+            add_determinant(det_stats, mats[n], fast.determinants[n]);
+            add_inverse(inverse_stats, mats[n], fast.inverses[n]);
+        }
+        dot_stats.check();
+        length_stats.check();
+        cross_stats.check();
+        normalize_stats.check();
+        transform_stats.check();
+        det_stats.check();
+        inverse_stats.check();
+    }
+    dispatch::set_isa(initial);
+}
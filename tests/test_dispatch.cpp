@@ -0,0 +1,258 @@
+// Unit tests for runtime instruction set dispatch of the batch kernels
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "batch_transform.hpp"
+#include "dispatch.hpp"
+#include "dual_quat.hpp"
+#include "mat_batch.hpp"
+#include "skinning.hpp"
+#include "vec_array.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace dispatch = vec::dispatch;
+using dispatch::Isa;
+using vec::DualQuat;
+using vec::SkinIndices;
+using vec::ThreadPool;
+using vec::VecArray;
+
+// Number of items per test batch (not a multiple of any register width, so every path has a tail)
+static constexpr size_t kCount = 67;
+
+// Helper to select an instruction set for the duration of a test
+class IsaScope {
+public:
+    explicit IsaScope(Isa isa) : previous_(dispatch::active_isa()) {
+        REQUIRE(dispatch::set_isa(isa));
+    }
+
+    ~IsaScope() {
+        dispatch::set_isa(previous_);
+    }
+
+private:
+    Isa previous_;
+};
+
+// Helper to run a batch computation with every supported instruction set, checking that each
+// gives exactly the scalar result (or the same up to rounding, in builds targeting FMA)
+template <typename Compute>
+void check_all_isas(Compute compute) {
+    const auto expected = [&]() {
+        IsaScope scope(Isa::Scalar);
+        return compute();
+    }();
+    for (size_t i = 0; i < dispatch::kNumIsas; i++) {
+        const auto isa = static_cast<Isa>(i);
+        if (!dispatch::is_supported(isa)) {
+            continue;
+        }
+        IsaScope scope(isa);
+        if constexpr (dispatch::kIdenticalResults) {
+            CHECK(same_bits(compute(), expected));
+        } else {
+            CHECK(compute() == expected);
+        }
+    }
+}
+
+// Helper to copy an array out as Vec values
+template <typename Type, size_t M>
+std::vector<Vec<Type, M>> to_vecs(const VecArray<Type, M>& arr) {
+    std::vector<Vec<Type, M>> out(arr.size());
+    arr.gather(out);
+    return out;
+}
+
+TEST_CASE("Instruction set names") {
+    static_assert(dispatch::isa_name(Isa::Avx2) == "avx2");
+    static_assert(dispatch::parse_isa("avx512") == Isa::Avx512);
+    static_assert(!dispatch::parse_isa("avx").has_value());
+    for (size_t i = 0; i < dispatch::kNumIsas; i++) {
+        const auto isa = static_cast<Isa>(i);
+        CHECK(dispatch::parse_isa(dispatch::isa_name(isa)) == isa);
+    }
+}
+
+TEST_CASE("Instruction set selection") {
+    const Isa initial = dispatch::active_isa();
+    CHECK(dispatch::is_supported(Isa::Scalar));
+    CHECK(dispatch::is_supported(dispatch::detect_isa()));
+    CHECK(dispatch::is_supported(initial));
+#if defined(VEC_DISPATCH_X86)
+    static_assert(dispatch::kEnabled<float> && dispatch::kEnabled<double>);
+    CHECK(dispatch::is_supported(Isa::Sse2));
+#endif
+    static_assert(!dispatch::kEnabled<long double>);
+
+    for (size_t i = 0; i < dispatch::kNumIsas; i++) {
+        const auto isa = static_cast<Isa>(i);
+        const Isa before = dispatch::active_isa();
+        CHECK(dispatch::set_isa(isa) == dispatch::is_supported(isa));
+        CHECK(dispatch::active_isa() == (dispatch::is_supported(isa) ? isa : before));
+    }
+    dispatch::set_isa(initial);
+}
+
+TEST_CASE("Forced instruction set") {
+    SUBCASE("Narrower than supported") {
+        setenv("VEC_FORCE_ISA", "scalar", 1);
+        CHECK(dispatch::detail::initial_isa() == Isa::Scalar);
+    }
+
+    SUBCASE("Wider than supported") {
+        setenv("VEC_FORCE_ISA", "avx512", 1);
+        CHECK(dispatch::detail::initial_isa() == dispatch::detect_isa());
+    }
+
+    SUBCASE("Unknown") {
+        setenv("VEC_FORCE_ISA", "neon", 1);
+        CHECK(dispatch::detail::initial_isa() == dispatch::detect_isa());
+    }
+    unsetenv("VEC_FORCE_ISA");
+}
+
+TEST_CASE_TEMPLATE("Dispatched VecArray kernels", Type, VALID_TYPES) {
+    const VecArray<Type, 3> a(get_vecs<Type, 3>(kCount, 1.5L));
+    const VecArray<Type, 3> b(get_vecs<Type, 3>(kCount, -0.75L));
+
+    SUBCASE("Arithmetic") {
+        check_all_isas([&]() { return to_vecs(a + b); });
+        check_all_isas([&]() { return to_vecs(a - b); });
+        check_all_isas([&]() { return to_vecs(a * static_cast<Type>(0.3L)); });
+    }
+
+    SUBCASE("Products and distances") {
+        check_all_isas([&]() { return dot(a, b); });
+        check_all_isas([&]() { return to_vecs(cross(a, b)); });
+        check_all_isas([&]() { return euclidean2(a, b); });
+        const VecArray<Type, 4> a4(get_vecs<Type, 4>(kCount, 2.5L));
+        check_all_isas([&]() { return dot(a4, a4); });
+    }
+
+    SUBCASE("Normalization and projection") {
+        check_all_isas([&]() { return to_vecs(a.normalize()); });
+        check_all_isas([&]() { return to_vecs(project_onto(a, b)); });
+        check_all_isas([&]() { return to_vecs(reject_from(a, b)); });
+        IsaScope scope(dispatch::detect_isa());
+        const auto normalized = a.normalize();
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(normalized.gather(i) == a.gather(i).normalize());
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Dispatched batch transforms", Type, VALID_TYPES) {
+    ThreadPool pool(2);
+    using TransformT = AffineTransform<Type, 3>;
+    const TransformT t(TransformT::rotate_z(static_cast<Type>(0.5)) * static_cast<Type>(1.5),
+                       get_vec<Type, 3>({1.0L, -2.0L, 3.0L}));
+    const VecArray<Type, 3> points(get_vecs<Type, 3>(kCount, 4.0L));
+
+    check_all_isas([&]() {
+        VecArray<Type, 3> out(kCount);
+        vec::transform_points(t, points, out, pool);
+        return to_vecs(out);
+    });
+    check_all_isas([&]() {
+        VecArray<Type, 3> out(kCount);
+        vec::transform_directions(t, points, out, pool);
+        return to_vecs(out);
+    });
+}
+
+TEST_CASE_TEMPLATE("Dispatched kernels keep negative zero", Type, VALID_TYPES) {
+    ThreadPool pool(2);
+    const VecArray<Type, 3> a(get_vecs<Type, 3>(kCount, 1.5L));
+    Mat<Type, 3> linear;
+    linear.fill(-Type{0});
+    Vec<Type, 3> translation;
+    translation.fill(-Type{0});
+    const AffineTransform<Type, 3> t(linear, translation);
+
+    // Every element of a is positive, so every result is -0
+    const auto scaled = [&]() { return to_vecs(a * -Type{0}); };
+    const auto transformed = [&]() {
+        VecArray<Type, 3> out(kCount);
+        vec::transform_points(t, a, out, pool);
+        return to_vecs(out);
+    };
+    const auto all_negative_zero = [](const std::vector<Vec<Type, 3>>& vecs) {
+        return std::all_of(vecs.cbegin(), vecs.cend(), [](const Vec<Type, 3>& v) {
+            return std::all_of(v.cbegin(), v.cend(), [](Type x) {
+                return (x == 0) && std::signbit(x);
+            });
+        });
+    };
+    check_all_isas(scaled);
+    check_all_isas(transformed);
+    for (size_t i = 0; i < dispatch::kNumIsas; i++) {
+        const auto isa = static_cast<Isa>(i);
+        if (!dispatch::is_supported(isa)) {
+            continue;
+        }
+        IsaScope scope(isa);
+        CHECK(all_negative_zero(scaled()));
+        CHECK(all_negative_zero(transformed()));
+    }
+}
+
+TEST_CASE_TEMPLATE("Dispatched batch matrix kernels", Type, VALID_TYPES) {
+    ThreadPool pool(2);
+    std::vector<Mat<Type, 4>> mats(kCount);
+    for (size_t n = 0; n < kCount; n++) {
+        for (size_t i = 0; i < 4; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                const auto offset = static_cast<long double>((n * 5 + i * 3 + j * 7) % 11);
+                mats[n](i, j) = static_cast<Type>((i == j ? 5.0L : 0.0L) + 0.3L * offset - 1.0L);
+            }
+        }
+    }
+
+    check_all_isas([&]() {
+        std::vector<Type> dets(kCount);
+        vec::batch_determinant(mats, std::span<Type>(dets), pool);
+        return dets;
+    });
+    check_all_isas([&]() {
+        std::vector<Mat<Type, 4>> inverses(kCount);
+        vec::batch_inverse(mats, std::span<Mat<Type, 4>>(inverses), pool);
+        return inverses;
+    });
+}
+
+TEST_CASE_TEMPLATE("Dispatched skinning", Type, VALID_TYPES) {
+    ThreadPool pool(2);
+    using TransformT = AffineTransform<Type, 3>;
+    const std::vector<DualQuat<Type>> bones{
+            DualQuat<Type>::identity(),
+            DualQuat<Type>::from_affine(TransformT(TransformT::rotate_z(static_cast<Type>(0.7)),
+                                                   get_vec<Type, 3>({1.0L, 2.0L, 3.0L}))),
+            DualQuat<Type>::from_affine(TransformT(TransformT::rotate_x(static_cast<Type>(-1.2)),
+                                                   get_vec<Type, 3>({-0.5L, 0.0L, 4.0L}))),
+    };
+    std::vector<SkinIndices> indices(kCount);
+    VecArray<Type, 4> weights(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        for (size_t k = 0; k < 4; k++) {
+            indices[i][k] = static_cast<std::uint32_t>((i + k) % bones.size());
+            weights.component(k)[i] = static_cast<Type>((k < 2) ? 0.5L : 0.0L);
+        }
+    }
+    const VecArray<Type, 3> positions(get_vecs<Type, 3>(kCount, 2.0L));
+
+    check_all_isas([&]() {
+        VecArray<Type, 3> out;
+        vec::skin_points<Type>(bones, indices, weights, positions, out, pool);
+        return to_vecs(out);
+    });
+}
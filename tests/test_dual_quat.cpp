@@ -0,0 +1,192 @@
+// Unit tests for the DualQuat class implementation and dual quaternion skinning
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "dual_quat.hpp"
+#include "skinning.hpp"
+
+#include <vector>
+
+using vec::DualQuat;
+using vec::Quat;
+using vec::SkinIndices;
+using vec::ThreadPool;
+using vec::VecArray;
+
+// Number of vertices per skinning test batch (spans several parallel chunks plus a partial register)
+static constexpr size_t kCount = 2 * vec::kSkinningGrain + 5;
+
+// Helper to create a unit dual quaternion rotating around the (normalized) axis, then translating
+template <typename Type>
+DualQuat<Type> get_dual_quat(const TestArray& axis, long double rad, const TestArray& translation) {
+    const auto rotation = Quat<Type>::from_axis_angle(get_vec<Type, 3>(axis).normalize(),
+                                                      static_cast<Type>(rad));
+    return DualQuat<Type>::from_rotation_translation(rotation, get_vec<Type, 3>(translation));
+}
+
+// Reference result: promote to homogeneous coordinates and multiply by the full matrix
+template <typename Type>
+Vec<Type, 3> reference(const AffineTransform<Type, 3>& transform, const Vec<Type, 3>& p) {
+    return Vec<Type, 3>(Vec<Type, 4>(p.x(), p.y(), p.z(), static_cast<Type>(1)) * transform);
+}
+
+// Helper to compare against the matrix reference path, which rounds differently in single precision
+template <typename Type>
+Approx<Vec<Type, 3>> get_approx_point(const Vec<Type, 3>& p) {
+    Approx approx(p);
+    approx.epsilon(1e-5L);
+    return approx;
+}
+
+TEST_CASE_TEMPLATE("Construct dual quaternion", Type, VALID_TYPES) {
+    constexpr DualQuat<Type> dq_identity;
+    CHECK(dq_identity == DualQuat<Type>::identity());
+    CHECK(dq_identity.real() == Quat<Type>::identity());
+    CHECK(dq_identity.dual() == Quat<Type>(0, 0, 0, 0));
+
+    const auto p = get_vec<Type, 3>({0.3, 4.0, -2.0});
+    const auto t = get_vec<Type, 3>({1.0, -2.0, 3.0});
+    const auto translate = DualQuat<Type>::from_translation(t);
+    CHECK(translate.translation() == Approx(t));
+    CHECK(translate.transform_point(p) == Approx(p + t));
+    CHECK(translate.transform_direction(p) == Approx(p));
+
+    const auto dq = get_dual_quat<Type>({1.0, -2.0, 0.5}, 1.3L, {1.0, -2.0, 3.0});
+    CHECK(dq.translation() == Approx(t));
+    CHECK(dq.transform_point(p) == Approx(dq.rotation().rotate(p) + t));
+    CHECK(dq.transform_direction(p) == Approx(dq.rotation().rotate(p)));
+    CHECK((dq * 2.0).normalize() == Approx(dq));
+}
+
+TEST_CASE_TEMPLATE("Dual quaternion composition and inverse", Type, VALID_TYPES) {
+    const auto a = get_dual_quat<Type>({1.0, -2.0, 0.5}, 1.3L, {1.0, -2.0, 3.0});
+    const auto b = get_dual_quat<Type>({0.0, 1.0, 1.0}, -0.4L, {-0.5, 0.25, 2.0});
+    const auto p = get_vec<Type, 3>({0.3, 4.0, -2.0});
+
+    SUBCASE("Composition") {
+        CHECK((a * b).transform_point(p) == Approx(a.transform_point(b.transform_point(p))));
+        CHECK((a * DualQuat<Type>::identity()) == Approx(a));
+    }
+
+    SUBCASE("Inverse") {
+        CHECK(a.inverse().transform_point(a.transform_point(p)) == Approx(p));
+        CHECK((a * a.inverse()) == Approx(DualQuat<Type>::identity()));
+    }
+}
+
+TEST_CASE_TEMPLATE("Dual quaternion affine conversion", Type, VALID_TYPES) {
+    const auto a = get_dual_quat<Type>({1.0, -2.0, 0.5}, 1.3L, {1.0, -2.0, 3.0});
+    const auto b = get_dual_quat<Type>({0.0, 1.0, 1.0}, -0.4L, {-0.5, 0.25, 2.0});
+    const auto p = get_vec<Type, 3>({0.3, 4.0, -2.0});
+
+    SUBCASE("To affine") {
+        const auto transform = a.to_affine();
+        CHECK(reference(transform, p) == Approx(a.transform_point(p)));
+        const auto col_transform = a.template to_affine<vec::Layout::ColMajor>();
+        CHECK(AffineTransform<Type, 3>(col_transform) == Approx(transform));
+    }
+
+    SUBCASE("From affine") {
+        using Transform = AffineTransform<Type, 3>;
+        const Transform transform(Transform::rotate_y(static_cast<Type>(0.6)),
+                                  get_vec<Type, 3>({2.0, 0.0, -1.0}));
+        const auto dq = DualQuat<Type>::from_affine(transform);
+        CHECK(dq.transform_point(p) == Approx(reference(transform, p)));
+        CHECK(dq.to_affine() == Approx(transform));
+    }
+
+    SUBCASE("Round trip and composition") {
+        CHECK(DualQuat<Type>::from_affine(a.to_affine()) == Approx(a));
+        // Note: p * (A * B) applies A first, while a * b applies b first
+        CHECK(DualQuat<Type>::from_affine(b.to_affine() * a.to_affine()) == Approx(a * b));
+    }
+}
+
+template <typename Type>
+void check_skinning(ThreadPool& pool) {
+    const std::vector<DualQuat<Type>> bones{
+            get_dual_quat<Type>({1.0, -2.0, 0.5}, 1.3L, {1.0, -2.0, 3.0}),
+            get_dual_quat<Type>({0.0, 1.0, 1.0}, -0.4L, {-0.5, 0.25, 2.0}),
+            // Antipodal representation of a rotation (negated real and dual parts)
+            get_dual_quat<Type>({1.0, 0.0, 0.0}, 0.9L, {0.0, 1.0, 0.0}) * static_cast<Type>(-1),
+            get_dual_quat<Type>({2.0, 1.0, -1.0}, 2.5L, {3.0, 0.0, -3.0}),
+            DualQuat<Type>::identity(),
+    };
+
+    std::vector<SkinIndices> indices(kCount);
+    VecArray<Type, 4> weights(kCount);
+    VecArray<Type, 3> positions(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        const size_t influences = 1 + (i % 4);
+        Type sum = 0;
+        for (size_t k = 0; k < 4; k++) {
+            indices[i][k] = static_cast<std::uint32_t>((i + 2 * k) % bones.size());
+            const Type weight = (k < influences) ? static_cast<Type>(1 + (i + k) % 3) : Type(0);
+            weights.component(k)[i] = weight;
+            sum += weight;
+        }
+        for (size_t k = 0; k < 4; k++) {
+            weights.component(k)[i] /= sum;
+        }
+        positions.scatter(i, get_vec<Type, 3>({static_cast<long double>(i % 97) * 0.25L,
+                                               -1.5, 0.5L * static_cast<long double>(i % 13)}));
+    }
+
+    VecArray<Type, 3> skinned;
+    VecArray<Type, 3> normals;
+    vec::skin_points(bones, indices, weights, positions, skinned, pool);
+    vec::skin_directions(bones, indices, weights, positions, normals, pool);
+    REQUIRE(skinned.size() == kCount);
+    REQUIRE(normals.size() == kCount);
+    const VecArray<Type, 3> blended = skinned;
+
+    for (size_t i = 0; i < kCount; i++) {
+        // Reference: blend with DualQuat arithmetic, flipping signs into the first bone's hemisphere
+        const auto& pivot = bones[indices[i][0]];
+        DualQuat<Type> blend(Quat<Type>(0, 0, 0, 0), Quat<Type>(0, 0, 0, 0));
+        for (size_t k = 0; k < 4; k++) {
+            const auto& bone = bones[indices[i][k]];
+            const Type sign = (dot(pivot.real(), bone.real()) < 0) ? Type(-1) : Type(1);
+            blend += bone * (sign * weights.component(k)[i]);
+        }
+        blend = blend.normalize();
+        const auto p = positions.gather(i);
+        CHECK(skinned.gather(i) == Approx(blend.transform_point(p)));
+        CHECK(normals.gather(i) == Approx(blend.transform_direction(p)));
+    }
+
+    // A single full-weight bone matches the equivalent affine transform
+    std::vector<SkinIndices> single(kCount, SkinIndices{3, 0, 0, 0});
+    VecArray<Type, 4> full(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        full.x()[i] = 1;
+    }
+    vec::skin_points(bones, single, full, positions, skinned, pool);
+    const auto transform = bones[3].to_affine();
+    for (size_t i = 0; i < kCount; i += 101) {
+        CHECK(skinned.gather(i) == get_approx_point(reference(transform, positions.gather(i))));
+    }
+
+    // In-place skinning
+    VecArray<Type, 3> in_place = positions;
+    vec::skin_points(bones, indices, weights, in_place, in_place, pool);
+    for (size_t i = 0; i < kCount; i += 101) {
+        CHECK(in_place.gather(i) == blended.gather(i));
+    }
+}
+
+TEST_CASE_TEMPLATE("Dual quaternion skinning", Type, VALID_TYPES) {
+    SUBCASE("Single thread") {
+        ThreadPool pool(0);
+        check_skinning<Type>(pool);
+    }
+
+    SUBCASE("Multiple threads") {
+        ThreadPool pool(3);
+        check_skinning<Type>(pool);
+    }
+}
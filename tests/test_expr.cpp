@@ -0,0 +1,117 @@
+// Unit tests for lazy expression templates
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "expr.hpp"
+
+using vec::expr::lazy;
+
+TEST_CASE_TEMPLATE("Lazy vector expression matches eager evaluation", Type, VALID_TYPES) {
+    constexpr TestArray kInput1{1.0L, 2.0L, 3.0L, 4.0L};
+    constexpr TestArray kInput2{-0.5L, 1.5L, 2.5L, -3.5L};
+    constexpr Type kScalar = static_cast<Type>(2.5L);
+
+    SUBCASE("2D") {
+        constexpr auto a = get_vec<Type, 2>(kInput1);
+        constexpr auto b = get_vec<Type, 2>(kInput2);
+        constexpr Vec<Type, 2> out = lazy(a) + kScalar * lazy(b);
+        CHECK(out == Approx(a + kScalar * b));
+    }
+
+    SUBCASE("3D") {
+        constexpr auto a = get_vec<Type, 3>(kInput1);
+        constexpr auto b = get_vec<Type, 3>(kInput2);
+        constexpr Vec<Type, 3> out = lazy(a) + kScalar * lazy(b);
+        CHECK(out == Approx(a + kScalar * b));
+    }
+
+    SUBCASE("4D") {
+        constexpr auto a = get_vec<Type, 4>(kInput1);
+        constexpr auto b = get_vec<Type, 4>(kInput2);
+        constexpr Vec<Type, 4> out = lazy(a) + kScalar * lazy(b);
+        CHECK(out == Approx(a + kScalar * b));
+    }
+}
+
+TEST_CASE_TEMPLATE("Lazy vector expression with all elementwise operators", Type, VALID_TYPES) {
+    constexpr TestArray kInput1{1.0L, 2.0L, 3.0L, 4.0L};
+    constexpr TestArray kInput2{-0.5L, 1.5L, 2.5L, -3.5L};
+    constexpr TestArray kInput3{4.0L, -8.0L, 0.25L, 1.0L};
+
+    SUBCASE("4D") {
+        constexpr auto a = get_vec<Type, 4>(kInput1);
+        constexpr auto b = get_vec<Type, 4>(kInput2);
+        constexpr auto c = get_vec<Type, 4>(kInput3);
+        constexpr Vec<Type, 4> expected = -(a - b) * static_cast<Type>(3) + c / static_cast<Type>(2);
+
+        // Compile-time evaluation
+        constexpr Vec<Type, 4> out = -(lazy(a) - b) * static_cast<Type>(3)
+                                     + lazy(c) / static_cast<Type>(2);
+        CHECK(out == Approx(expected));
+
+        // Run-time evaluation with mixed plain and temporary operands
+        Vec<Type, 4> runtime_out;
+        runtime_out = -(lazy(a) - b) * static_cast<Type>(3) + (c / static_cast<Type>(2));
+        CHECK(runtime_out == Approx(expected));
+    }
+}
+
+TEST_CASE_TEMPLATE("Lazy expression evaluation via eval()", Type, VALID_TYPES) {
+    constexpr TestArray kInput{1.0L, 2.0L, 3.0L, 4.0L};
+
+    SUBCASE("3D") {
+        const auto a = get_vec<Type, 3>(kInput);
+        const auto expr = lazy(a) + lazy(a);
+        const auto out = eval(expr);
+        CHECK(std::is_same_v<std::remove_cvref_t<decltype(out)>, Vec<Type, 3>>);
+        CHECK(out == Approx(a + a));
+        CHECK(expr.eval() == Approx(a + a));
+    }
+
+    SUBCASE("3D - Owned temporary") {
+        const auto a = get_vec<Type, 3>(kInput);
+        const auto expr = lazy(a + a) - lazy(a); // a + a is copied into the expression
+        CHECK(eval(expr) == Approx(a));
+    }
+}
+
+TEST_CASE_TEMPLATE("Lazy matrix expression matches eager evaluation", Type, VALID_TYPES) {
+    constexpr TestGrid kInput1{{
+            {1.0L, 2.0L, 3.0L, 4.0L},
+            {5.0L, 6.0L, 7.0L, 8.0L},
+            {-1.0L, -2.0L, -3.0L, -4.0L},
+            {-5.0L, -6.0L, -7.0L, -8.0L},
+    }};
+    constexpr TestGrid kInput2{{
+            {0.5L, 0.0L, 1.0L, 2.0L},
+            {1.0L, -1.0L, 0.0L, 3.0L},
+            {2.0L, 4.0L, -2.0L, 1.0L},
+            {0.0L, 1.0L, 1.0L, 0.0L},
+    }};
+    constexpr Type kScalar = static_cast<Type>(-1.5L);
+
+    SUBCASE("2D") {
+        constexpr auto a = get_mat<Type, 2>(kInput1);
+        constexpr auto b = get_mat<Type, 2>(kInput2);
+        constexpr Mat<Type, 2> out = lazy(a) - lazy(b) * kScalar;
+        CHECK(out == Approx(a - b * kScalar));
+    }
+
+    SUBCASE("3D") {
+        constexpr auto a = get_mat<Type, 3>(kInput1);
+        constexpr auto b = get_mat<Type, 3>(kInput2);
+        constexpr Mat<Type, 3> out = lazy(a) - lazy(b) * kScalar;
+        CHECK(out == Approx(a - b * kScalar));
+    }
+
+    SUBCASE("4D") {
+        constexpr auto a = get_mat<Type, 4>(kInput1);
+        constexpr auto b = get_mat<Type, 4>(kInput2);
+        constexpr Mat<Type, 4> out = -lazy(a) + b / kScalar;
+        CHECK(out == Approx(-a + b / kScalar));
+    }
+}
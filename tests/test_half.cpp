@@ -0,0 +1,221 @@
+// Unit tests for the half-precision and bfloat16 storage types
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "half.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using vec::BFloat16;
+using vec::Half;
+using vec::PackedVec;
+
+static_assert(sizeof(vec::Vec3h) == 6);
+static_assert(sizeof(vec::Vec4bf) == 8);
+
+// Number of vectors per batch test array (spans several staging blocks plus a partial block)
+static constexpr size_t kCount = 1000;
+
+// Helper to get the bits of a float
+std::uint32_t to_bits(float value) {
+    return std::bit_cast<std::uint32_t>(value);
+}
+
+// Helper to check that each element of a rounded vector is within Storage's precision (relative,
+// or absolute for half subnormals)
+template <typename Storage, size_t M>
+bool is_rounded(const Vec<float, M>& rounded, const Vec<float, M>& v) {
+    const float precision = std::is_same_v<Storage, Half> ? 0x1p-11F : 0x1p-8F;
+    for (size_t i = 0; i < M; i++) {
+        if (std::fabs(rounded[i] - v[i]) > std::max(std::fabs(v[i]) * precision, 0x1p-25F)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Half conversion") {
+    SUBCASE("Exact values") {
+        CHECK(Half(1.0F).bits() == 0x3C00);
+        CHECK(Half(-2.0F).bits() == 0xC000);
+        CHECK(Half(65504.0F).bits() == 0x7BFF);
+        CHECK(Half(0x1p-14F).bits() == 0x0400);
+        CHECK(Half(0x1p-24F).bits() == 0x0001);
+        CHECK(Half(-0.0F).bits() == 0x8000);
+        CHECK(Half(std::numeric_limits<float>::infinity()).bits() == 0x7C00);
+        CHECK(static_cast<float>(Half::from_bits(0x3555)) == 0x1.554p-2F);
+        CHECK(static_cast<float>(Half::from_bits(0x03FF)) == 0x3FFp-24F);
+    }
+
+    SUBCASE("Rounding to nearest even") {
+        CHECK(Half(1.0F + 0x1p-11F).bits() == 0x3C00);
+        CHECK(Half(1.0F + 0x3p-11F).bits() == 0x3C02);
+        CHECK(Half(1.0F + 0x1p-11F + 0x1p-20F).bits() == 0x3C01);
+        CHECK(Half(0x1p-25F).bits() == 0x0000);
+        CHECK(Half(0x3p-26F).bits() == 0x0001);
+        CHECK(Half(0x3p-25F).bits() == 0x0002);
+        CHECK(Half(0x1.FFFp-15F).bits() == 0x0400); // subnormal rounding up to the smallest normal
+        CHECK(Half(65519.0F).bits() == 0x7BFF);
+        CHECK(Half(65520.0F).bits() == 0x7C00);
+        CHECK(Half(-1e10F).bits() == 0xFC00);
+    }
+
+    SUBCASE("NaN") {
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        CHECK(std::isnan(static_cast<float>(Half(nan))));
+        CHECK(std::isnan(static_cast<float>(Half(-nan))));
+        CHECK(Half(std::bit_cast<float>(0x7F800001U)).bits() == 0x7E00); // signaling becomes quiet
+    }
+
+    SUBCASE("Constexpr") {
+        static_assert(Half(0.1F).bits() == 0x2E66);
+        static_assert(static_cast<float>(Half::from_bits(0xFBFF)) == -65504.0F);
+        static_assert(vec::detail::float_to_half_bits(1e-8F) == 0x0000);
+    }
+
+    SUBCASE("All half values round trip") {
+        for (std::uint32_t bits = 0; bits <= 0xFFFF; bits++) {
+            const auto h = Half::from_bits(static_cast<std::uint16_t>(bits));
+            const float value = h;
+            CHECK(to_bits(value) == to_bits(vec::detail::half_bits_to_float(h.bits())));
+            if (!std::isnan(value)) {
+                REQUIRE(Half(value).bits() == bits);
+            }
+        }
+    }
+
+    SUBCASE("Relative error") {
+        for (float value = 0x1p-14F; value < 65504.0F; value *= 1.0001F) {
+            const float rounded = Half(value);
+            REQUIRE(std::fabs(rounded - value) <= value * 0x1p-11F);
+        }
+    }
+}
+
+TEST_CASE("BFloat16 conversion") {
+    SUBCASE("Exact values") {
+        CHECK(BFloat16(1.0F).bits() == 0x3F80);
+        CHECK(BFloat16(-2.0F).bits() == 0xC000);
+        CHECK(BFloat16(std::numeric_limits<float>::max()).bits() == 0x7F80); // rounds to infinity
+        CHECK(BFloat16(std::numeric_limits<float>::min()).bits() == 0x0080);
+        CHECK(static_cast<float>(BFloat16::from_bits(0x4049)) == 3.140625F);
+    }
+
+    SUBCASE("Rounding to nearest even") {
+        CHECK(BFloat16(1.0F + 0x1p-8F).bits() == 0x3F80);
+        CHECK(BFloat16(1.0F + 0x3p-8F).bits() == 0x3F82);
+        CHECK(BFloat16(1.0F + 0x1p-8F + 0x1p-20F).bits() == 0x3F81);
+    }
+
+    SUBCASE("NaN") {
+        CHECK(std::isnan(static_cast<float>(BFloat16(std::bit_cast<float>(0x7F800001U)))));
+        CHECK(BFloat16(std::bit_cast<float>(0xFF800001U)).bits() == 0xFFC0);
+    }
+
+    SUBCASE("Constexpr") {
+        static_assert(BFloat16(0.1F).bits() == 0x3DCD);
+        static_assert(static_cast<float>(BFloat16::from_bits(0xC040)) == -3.0F);
+    }
+
+    SUBCASE("All bfloat16 values round trip") {
+        for (std::uint32_t bits = 0; bits <= 0xFFFF; bits++) {
+            const auto b = BFloat16::from_bits(static_cast<std::uint16_t>(bits));
+            const float value = b;
+            CHECK(to_bits(value) == (bits << 16));
+            if (!std::isnan(value)) {
+                REQUIRE(BFloat16(value).bits() == bits);
+            }
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch scalar conversion", Storage, Half, BFloat16) {
+    // Sweep float bit patterns of every class (zeros, subnormals, normals, infinities, NaNs)
+    std::vector<float> in;
+    for (std::uint64_t bits = 0; bits <= 0xFFFFFFFFU; bits += 4093) {
+        in.push_back(std::bit_cast<float>(static_cast<std::uint32_t>(bits)));
+    }
+    in.push_back(65520.0F);
+    in.push_back(-0x1p-25F);
+
+    std::vector<Storage> packed(in.size());
+    vec::pack<Storage>(in, packed);
+    std::vector<float> unpacked(in.size());
+    vec::unpack<Storage>(packed, unpacked);
+    for (size_t i = 0; i < in.size(); i++) {
+        const auto expected = std::is_same_v<Storage, Half>
+                ? vec::detail::float_to_half_bits(in[i])
+                : vec::detail::float_to_bfloat16_bits(in[i]);
+        REQUIRE(packed[i].bits() == expected);
+        REQUIRE(to_bits(unpacked[i]) == to_bits(static_cast<float>(packed[i])));
+    }
+}
+
+TEST_CASE_TEMPLATE("Packed vectors", Storage, Half, BFloat16) {
+    constexpr TestArray kInput{0.1L, -2.0L, 3.5L, 100.25L};
+
+    SUBCASE("2D") {
+        const auto v = get_vec<float, 2>(kInput);
+        const PackedVec<Storage, 2> p(v);
+        CHECK(p.size() == 2);
+        CHECK(p[0].bits() == Storage(0.1F).bits());
+        CHECK(p.load() == Vec<float, 2>(static_cast<float>(Storage(0.1F)), -2.0F));
+    }
+
+    SUBCASE("3D") {
+        const auto v = get_vec<float, 3>(kInput);
+        PackedVec<Storage, 3> p;
+        CHECK(p.load() == Vec<float, 3>());
+        p.store(v);
+        CHECK(static_cast<Vec<float, 3>>(p) == p.load());
+        CHECK(is_rounded<Storage>(p.load(), v));
+        CHECK(p.data()[2].bits() == Storage(3.5F).bits());
+    }
+
+    SUBCASE("4D - Constexpr") {
+        constexpr PackedVec<Storage, 4> kValue(get_vec<float, 4>({1.0L, -0.5L, 0.25L, 8.0L}));
+        static_assert(kValue.load() == Vec<float, 4>(1.0F, -0.5F, 0.25F, 8.0F));
+        CHECK(kValue[3].bits() == Storage(8.0F).bits());
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch vector conversion", Storage, Half, BFloat16) {
+    SUBCASE("3D") {
+        std::vector<Vec<float, 3>> vecs(kCount);
+        for (size_t i = 0; i < kCount; i++) {
+            const auto n = static_cast<float>(i);
+            vecs[i] = Vec<float, 3>(std::sin(n), std::cos(n), n * 0.01F).normalize();
+        }
+        std::vector<PackedVec<Storage, 3>> packed(kCount);
+        vec::pack<Storage, 3>(vecs, packed);
+        std::vector<Vec<float, 3>> unpacked(kCount);
+        vec::unpack<Storage, 3>(packed, unpacked);
+        for (size_t i = 0; i < kCount; i++) {
+            REQUIRE(unpacked[i] == PackedVec<Storage, 3>(vecs[i]).load());
+            CHECK(is_rounded<Storage>(unpacked[i], vecs[i]));
+        }
+    }
+
+    SUBCASE("4D") {
+        std::vector<Vec<float, 4>> vecs(kCount);
+        for (size_t i = 0; i < kCount; i++) {
+            const auto n = static_cast<float>(i);
+            vecs[i] = Vec<float, 4>(n, -n * 0.5F, 1.0F / (n + 1.0F), 0.75F);
+        }
+        std::vector<PackedVec<Storage, 4>> packed(kCount);
+        vec::pack<Storage, 4>(vecs, packed);
+        std::vector<Vec<float, 4>> unpacked(kCount);
+        vec::unpack<Storage, 4>(packed, unpacked);
+        for (size_t i = 0; i < kCount; i++) {
+            REQUIRE(unpacked[i] == PackedVec<Storage, 4>(vecs[i]).load());
+        }
+    }
+}
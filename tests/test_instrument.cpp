@@ -0,0 +1,163 @@
+// Unit tests for the operation counters and tracing hooks (compiled with VEC_ENABLE_INSTRUMENTATION
+// and VEC_INSTRUMENT_FLOPS)
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "instrument.hpp"
+#include "mat.hpp"
+#include "transform.hpp"
+#include "vec.hpp"
+
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace instrument = vec::instrument;
+using instrument::Op;
+
+static_assert(instrument::kEnabled);
+static_assert(instrument::kFlopsEnabled);
+
+// Events seen by the trace callback
+static std::vector<instrument::TraceEvent> g_events;
+
+// Trace callback recording every event
+void record_event(const instrument::TraceEvent& event) {
+    g_events.push_back(event);
+}
+
+// Helper to install the recording callback for the duration of a test
+struct TraceScope {
+    TraceScope() {
+        g_events.clear();
+        instrument::reset_counters();
+        instrument::set_trace_callback(record_event);
+    }
+
+    ~TraceScope() {
+        instrument::set_trace_callback(nullptr);
+    }
+};
+
+TEST_CASE_TEMPLATE("Vector operation counters", Type, VALID_TYPES) {
+    TraceScope scope;
+    const auto v = get_vec<Type, 3>({3.0L, 0.0L, 4.0L});
+
+    const auto n = v.normalize();
+    const int line = __LINE__ - 1;
+    CHECK(n == get_vec<Type, 3>({0.6L, 0.0L, 0.8L}));
+    (void)v.normalize_fast();
+    (void)v.normalize_fast();
+
+    const auto& counters = instrument::counters();
+    CHECK(counters.count(Op::Normalize) == 1);
+    CHECK(counters.count(Op::NormalizeFast) == 2);
+    CHECK(counters.count(Op::Inverse) == 0);
+    CHECK(counters.flops == 10 + 2 * 9);
+
+    REQUIRE(g_events.size() == 3);
+    CHECK(g_events[0].op == Op::Normalize);
+    CHECK(g_events[0].size == 3);
+    CHECK(g_events[0].flops == 10);
+    CHECK(g_events[0].location.line() == line);
+    CHECK(std::string_view(g_events[0].location.file_name()).ends_with("test_instrument.cpp"));
+    CHECK(g_events[1].op == Op::NormalizeFast);
+}
+
+TEST_CASE_TEMPLATE("Matrix operation counters", Type, VALID_TYPES) {
+    TraceScope scope;
+    const auto m = get_mat<Type, 4>({{{2.0L, 0.0L, 0.0L, 1.0L},
+                                      {0.0L, 3.0L, 0.0L, 0.0L},
+                                      {1.0L, 0.0L, 1.0L, 0.0L},
+                                      {0.0L, 0.0L, 0.0L, 1.0L}}});
+    const auto v = get_vec<Type, 4>({1.0L, 2.0L, 3.0L, 4.0L});
+
+    SUBCASE("Determinant and inverse") {
+        CHECK(m.determinant() == doctest::Approx(6.0));
+        const auto inv = m.inverse();
+        const auto with_det = m.inverse_with_determinant();
+        CHECK(m.try_inverse().has_value());
+        CHECK(approx_eq(inv, with_det.inverse));
+
+        const auto& counters = instrument::counters();
+        CHECK(counters.count(Op::Determinant) == 1);
+        CHECK(counters.count(Op::Inverse) == 3);
+        CHECK(counters.flops == 47 + 3 * 140);
+        REQUIRE(g_events.size() == 4);
+        CHECK(g_events[1].type == vec::instrument::detail::type_name<Type>());
+    }
+
+    SUBCASE("Products") {
+        (void)(m * m);
+        (void)(m * v);
+        (void)(v * m);
+        auto p = m;
+        p *= m;
+
+        const auto& counters = instrument::counters();
+        CHECK(counters.count(Op::MatMul) == 2);
+        CHECK(counters.count(Op::MatVecMul) == 1);
+        CHECK(counters.count(Op::VecMatMul) == 1);
+        CHECK(counters.flops == 2 * 112 + 2 * 28);
+        REQUIRE(g_events.size() == 4);
+        CHECK(g_events[0].location.line() == 0); // operators have no call site
+    }
+}
+
+TEST_CASE_TEMPLATE("Transform operation counters", Type, VALID_TYPES) {
+    TraceScope scope;
+    using TransformT = AffineTransform<Type, 3>;
+    const TransformT t(TransformT::rotate_z(static_cast<Type>(0.5)),
+                       get_vec<Type, 3>({1.0L, 2.0L, 3.0L}));
+    const std::uint64_t setup_mat_muls = instrument::counters().count(Op::MatMul);
+
+    const auto inv = t.inverse();
+    const auto rigid = t.rigid_inverse();
+    const auto composed = t * inv;
+    CHECK(approx_eq(inv, rigid));
+    CHECK(approx_eq(static_cast<Mat<Type, 4>>(composed), Mat<Type, 4>::identity()));
+
+    const auto& counters = instrument::counters();
+    CHECK(counters.count(Op::TransformInverse) == 1);
+    CHECK(counters.count(Op::TransformRigidInverse) == 1);
+    CHECK(counters.count(Op::TransformCompose) == 1);
+    CHECK(counters.count(Op::Inverse) == 1); // linear part of inverse()
+    CHECK(counters.count(Op::MatMul) == setup_mat_muls + 1); // linear part of compose
+    CHECK(g_events.front().op == Op::TransformInverse);
+    CHECK(g_events.front().size == 3);
+}
+
+TEST_CASE("Compile-time evaluation is not recorded") {
+    TraceScope scope;
+    constexpr auto kNormalized = Vec<double, 2>(3.0, 4.0).normalize();
+    constexpr auto kDeterminant = Mat<double, 2>(1.0, 2.0, 3.0, 4.0).determinant();
+    static_assert(kDeterminant == -2.0);
+    CHECK(kNormalized.x() == doctest::Approx(0.6));
+    CHECK(instrument::counters().count(Op::Normalize) == 0);
+    CHECK(instrument::counters().count(Op::Determinant) == 0);
+    CHECK(g_events.empty());
+}
+
+TEST_CASE("Counters are per thread") {
+    TraceScope scope;
+    instrument::set_trace_callback(nullptr);
+    const Vec<float, 3> v(1.0F, 2.0F, 2.0F);
+    (void)v.normalize();
+
+    std::uint64_t other_thread_count = 0;
+    std::thread worker([&]() {
+        (void)v.normalize();
+        (void)v.normalize();
+        other_thread_count = instrument::counters().count(Op::Normalize);
+    });
+    worker.join();
+
+    CHECK(other_thread_count == 2);
+    CHECK(instrument::counters().count(Op::Normalize) == 1);
+    instrument::reset_counters();
+    CHECK(instrument::counters().count(Op::Normalize) == 0);
+}
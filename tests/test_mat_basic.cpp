@@ -441,6 +441,60 @@ TEST_CASE_TEMPLATE("Inverse", Type, VALID_TYPES) {
     }
 }
 
+TEST_CASE_TEMPLATE("Try inverse", Type, VALID_TYPES) {
+    constexpr TestGrid kInput{{
+            {1.0, 2.0, -3.5, 0.0},
+            {5.0, 6.6, 7.0, -9.0},
+            {-1.0, -2.0, 3.0, -4.0},
+            {-5.0, -6.0, 7.0, -8.0},
+    }};
+    constexpr TestGrid kSingular{{
+            {1.0, 2.0, 3.0, 4.0},
+            {2.0, 4.0, 6.0, 8.0},
+            {-1.0, 0.5, 3.0, -4.0},
+            {-5.0, -6.0, 7.0, -8.0},
+    }};
+
+    SUBCASE("2D") {
+        constexpr auto m = get_mat<Type, 2>(kInput);
+        constexpr auto result = m.inverse_with_determinant();
+        constexpr auto m_inverse = m.try_inverse();
+        CHECK(result.determinant == doctest::Approx(m.determinant()));
+        CHECK(result.inverse == Approx(m.inverse()));
+        REQUIRE(m_inverse.has_value());
+        CHECK(*m_inverse == Approx(m.inverse()));
+        CHECK_FALSE(get_mat<Type, 2>(kSingular).try_inverse().has_value());
+        CHECK_FALSE(m.try_inverse(static_cast<Type>(3.5)).has_value());
+    }
+
+    SUBCASE("3D") {
+        constexpr auto m = get_mat<Type, 3>(kInput);
+        constexpr auto result = m.inverse_with_determinant();
+        constexpr auto m_inverse = m.try_inverse();
+        CHECK(result.determinant == doctest::Approx(m.determinant()));
+        CHECK(result.inverse == Approx(m.inverse()));
+        REQUIRE(m_inverse.has_value());
+        CHECK(*m_inverse == Approx(m.inverse()));
+        CHECK_FALSE(get_mat<Type, 3>(kSingular).try_inverse().has_value());
+        CHECK_FALSE(m.try_inverse(static_cast<Type>(2.0)).has_value());
+    }
+
+    SUBCASE("4D") {
+        constexpr auto m = get_mat<Type, 4>(kInput);
+        constexpr auto result = m.inverse_with_determinant();
+        constexpr auto m_inverse = m.try_inverse();
+        CHECK(result.determinant == doctest::Approx(m.determinant()));
+        CHECK(result.inverse == Approx(m.inverse()));
+        REQUIRE(m_inverse.has_value());
+        CHECK(*m_inverse == Approx(m.inverse()));
+        CHECK_FALSE(get_mat<Type, 4>(kSingular).try_inverse().has_value());
+        CHECK_FALSE(m.try_inverse(static_cast<Type>(300.0)).has_value());
+
+        const auto nan_mat = Mat<Type, 4>(std::numeric_limits<Type>::quiet_NaN());
+        CHECK_FALSE(nan_mat.try_inverse().has_value());
+    }
+}
+
 TEST_CASE_TEMPLATE("Fill", Type, VALID_TYPES) {
     constexpr Type kFillValue = 123.0;
     constexpr TestGrid kExpected{{
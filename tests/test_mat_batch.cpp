@@ -0,0 +1,73 @@
+// Unit tests for the batch 4x4 determinant and inverse kernels
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "mat_batch.hpp"
+
+#include <vector>
+
+using vec::ColMat;
+using vec::ThreadPool;
+
+// Number of matrices per test batch (spans several parallel chunks plus a partial SIMD register)
+static constexpr size_t kCount = 2 * vec::kMatBatchGrain + 3;
+
+// Helper to generate a deterministic list of (generally non-singular) 4x4 test matrices
+template <typename Type, vec::Layout L>
+std::vector<Mat<Type, 4, L>> get_mats() {
+    std::vector<Mat<Type, 4, L>> out(kCount);
+    for (size_t n = 0; n < kCount; n++) {
+        for (size_t i = 0; i < 4; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                const auto offset = static_cast<long double>((n * 7 + i * 3 + j * 5) % 11);
+                out[n](i, j) = static_cast<Type>((i == j ? 6.0L : 0.0L) + 0.25L * offset - 1.0L);
+            }
+        }
+    }
+    return out;
+}
+
+TEST_CASE_TEMPLATE("Factored 4x4 determinant", Type, VALID_TYPES) {
+    constexpr TestGrid kInput{{
+            {1.0, 2.0, -3.5, 0.0},
+            {5.0, 6.6, 7.0, -9.0},
+            {-1.0, -2.0, 3.0, -4.0},
+            {-5.0, -6.0, 7.0, -8.0},
+    }};
+    constexpr auto m = get_mat<Type, 4>(kInput);
+    constexpr Type det = m.determinant();
+    CHECK(det == doctest::Approx(-280.8));
+    CHECK(m.determinant() == doctest::Approx(m.inverse_with_determinant().determinant));
+    CHECK(Mat<Type, 4>::identity().determinant() == static_cast<Type>(1));
+}
+
+TEST_CASE_TEMPLATE("Batch determinant and inverse", Type, VALID_TYPES) {
+    ThreadPool pool(3);
+
+    SUBCASE("Row-major") {
+        const auto mats = get_mats<Type, vec::Layout::RowMajor>();
+        std::vector<Type> dets(kCount);
+        std::vector<Type> inv_dets(kCount);
+        std::vector<Mat<Type, 4>> inverses(kCount);
+        vec::batch_determinant(mats, dets, pool);
+        vec::batch_inverse(mats, inverses, inv_dets, pool);
+        for (size_t n = 0; n < kCount; n++) {
+            CHECK(dets[n] == doctest::Approx(mats[n].determinant()));
+            CHECK(inv_dets[n] == dets[n]);
+            CHECK(inverses[n] == Approx(mats[n].inverse()));
+        }
+    }
+
+    SUBCASE("Column-major in place") {
+        auto mats = get_mats<Type, vec::Layout::ColMajor>();
+        const auto original = mats;
+        vec::batch_inverse(mats, mats, pool);
+        for (size_t n = 0; n < kCount; n++) {
+            CHECK(mats[n] == Approx(original[n].inverse()));
+        }
+    }
+}
@@ -37,3 +37,144 @@ TEST_CASE_TEMPLATE("Approximate equality", Type, VALID_TYPES) {
         CHECK(custom_eps_eq);
     }
 }
+
+// Helper to copy a matrix into column-major storage
+template <typename Type, size_t M>
+constexpr vec::ColMat<Type, M> to_col_major(const Mat<Type, M>& m) {
+    vec::ColMat<Type, M> out;
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < M; j++) {
+            out(i, j) = m(i, j);
+        }
+    }
+    return out;
+}
+
+TEST_CASE_TEMPLATE("Fused multiply-add", Type, VALID_TYPES) {
+    constexpr TestGrid kInput1{{
+            {1.0L, 2.0L, -3.5L, 0.0L},
+            {5.0L, 6.5L, 7.0L, -9.0L},
+            {-1.0L, -2.0L, 3.0L, -4.0L},
+            {-5.0L, -6.0L, 7.0L, -8.0L},
+    }};
+    constexpr TestGrid kInput2{{
+            {0.5L, -1.0L, 2.0L, 3.0L},
+            {4.0L, 0.25L, -6.0L, 1.0L},
+            {-2.0L, 3.0L, 1.0L, 0.0L},
+            {1.0L, -1.5L, 0.5L, 2.0L},
+    }};
+    constexpr TestGrid kInput3{{
+            {1.0L, 0.0L, 0.0L, 10.0L},
+            {0.0L, 1.0L, -20.0L, 0.0L},
+            {0.0L, 30.0L, 1.0L, 0.0L},
+            {-40.0L, 0.0L, 0.0L, 1.0L},
+    }};
+    constexpr TestArray kVec{1.5L, -2.0L, 0.25L, 3.0L};
+
+    SUBCASE("2D") {
+        constexpr auto a = get_mat<Type, 2>(kInput1);
+        constexpr auto b = get_mat<Type, 2>(kInput2);
+        constexpr auto c = get_mat<Type, 2>(kInput3);
+        constexpr auto v = get_vec<Type, 2>(kVec);
+        constexpr Mat<Type, 2> m_fma = fma(a, b, c);
+        CHECK(m_fma == a * b + c);
+        CHECK(fma(a, b, c) == m_fma);
+        CHECK(fma(v, a, v) == v * a + v);
+        CHECK(fma(a, v, v) == a * v + v);
+    }
+
+    SUBCASE("3D") {
+        constexpr auto a = get_mat<Type, 3>(kInput1);
+        constexpr auto b = get_mat<Type, 3>(kInput2);
+        constexpr auto c = get_mat<Type, 3>(kInput3);
+        constexpr auto v = get_vec<Type, 3>(kVec);
+        constexpr Mat<Type, 3> m_fma = fma(a, b, c);
+        CHECK(m_fma == a * b + c);
+        CHECK(fma(a, b, c) == m_fma);
+        CHECK(fma(v, a, v) == v * a + v);
+        CHECK(fma(a, v, v) == a * v + v);
+    }
+
+    SUBCASE("4D") {
+        constexpr auto a = get_mat<Type, 4>(kInput1);
+        constexpr auto b = get_mat<Type, 4>(kInput2);
+        constexpr auto c = get_mat<Type, 4>(kInput3);
+        constexpr auto v = get_vec<Type, 4>(kVec);
+        constexpr Mat<Type, 4> m_fma = fma(a, b, c);
+        constexpr Vec<Type, 4> v_row_fma = fma(v, a, v);
+        constexpr Vec<Type, 4> v_col_fma = fma(a, v, v);
+        CHECK(m_fma == a * b + c);
+        CHECK(v_row_fma == v * a + v);
+        CHECK(v_col_fma == a * v + v);
+        CHECK(fma(a, b, c) == m_fma);
+        CHECK(fma(v, a, v) == v_row_fma);
+        CHECK(fma(a, v, v) == v_col_fma);
+    }
+
+    SUBCASE("4D - Column-major") {
+        constexpr auto a = get_mat<Type, 4>(kInput1);
+        constexpr auto b = get_mat<Type, 4>(kInput2);
+        constexpr auto c = get_mat<Type, 4>(kInput3);
+        constexpr auto v = get_vec<Type, 4>(kVec);
+        const auto a_col = to_col_major(a);
+        const auto b_col = to_col_major(b);
+        const auto c_col = to_col_major(c);
+        CHECK(fma(a_col, b_col, c_col) == to_col_major(fma(a, b, c)));
+        CHECK(fma(v, a_col, v) == fma(v, a, v));
+        CHECK(fma(a_col, v, v) == fma(a, v, v));
+    }
+
+    SUBCASE("4D - Single rounding at run time") {
+        // (1 + 2^-k)(1 - 2^-k) - 1 = -2^-2k is lost when the product is rounded to Type first
+        constexpr int kHalfDigits = (std::numeric_limits<Type>::digits + 1) / 2;
+        constexpr Type kSmall = vec::utils::constexpr_impl::pow2<Type>(-kHalfDigits);
+        constexpr auto a = Mat<Type, 4>::identity() * (1 + kSmall);
+        constexpr auto b = Mat<Type, 4>::identity() * (1 - kSmall);
+        constexpr auto c = Mat<Type, 4>::identity() * static_cast<Type>(-1);
+        constexpr Vec<Type, 4> v{1 - kSmall, 1 - kSmall, 1 - kSmall, 1 - kSmall};
+        constexpr Vec<Type, 4> w{-Type{1}, -Type{1}, -Type{1}, -Type{1}};
+        constexpr Mat<Type, 4> m_fma = fma(a, b, c);
+        const Mat<Type, 4> m_run = fma(a, b, c);
+        const Vec<Type, 4> row_run = fma(v, a, w);
+        const Vec<Type, 4> col_run = fma(a, v, w);
+        for (size_t i = 0; i < 4; i++) {
+            CHECK(m_fma(i, i) == -kSmall * kSmall);
+            CHECK(m_run(i, i) == m_fma(i, i));
+            CHECK(row_run[i] == -kSmall * kSmall);
+            CHECK(col_run[i] == -kSmall * kSmall);
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Elementwise multiply-add and interpolation", Type, VALID_TYPES) {
+    constexpr TestGrid kInput1{{
+            {1.0L, 2.0L, -3.5L, 0.0L},
+            {5.0L, 6.5L, 7.0L, -9.0L},
+            {-1.0L, -2.0L, 3.0L, -4.0L},
+            {-5.0L, -6.0L, 7.0L, -8.0L},
+    }};
+    constexpr TestGrid kInput2{{
+            {0.5L, -1.0L, 2.0L, 3.0L},
+            {4.0L, 0.25L, -6.0L, 1.0L},
+            {-2.0L, 3.0L, 1.0L, 0.0L},
+            {1.0L, -1.5L, 0.5L, 2.0L},
+    }};
+
+    SUBCASE("4D - Multiply-add") {
+        constexpr auto a = get_mat<Type, 4>(kInput1);
+        constexpr auto b = get_mat<Type, 4>(kInput2);
+        constexpr Mat<Type, 4> m_madd = madd(a, static_cast<Type>(0.5), b);
+        CHECK(m_madd == a * static_cast<Type>(0.5) + b);
+        CHECK(madd(a, static_cast<Type>(0.5), b) == m_madd);
+    }
+
+    SUBCASE("4D - Interpolation") {
+        constexpr auto a = get_mat<Type, 4>(kInput1);
+        constexpr auto b = get_mat<Type, 4>(kInput2);
+        constexpr Mat<Type, 4> m_lerp = lerp(a, b, static_cast<Type>(0.25));
+        CHECK(m_lerp == a + (b - a) * static_cast<Type>(0.25));
+        CHECK(lerp(a, b, static_cast<Type>(0.25)) == m_lerp);
+        CHECK(lerp(a, b, static_cast<Type>(0)) == a);
+        CHECK(lerp(a, b, static_cast<Type>(1)) == b);
+    }
+}
@@ -0,0 +1,170 @@
+// Unit tests for the Mat class implementation (column-major layout)
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "expr.hpp"
+#include "mat.hpp"
+#include "transform.hpp"
+
+using vec::ColMat;
+using vec::ColTransform;
+
+// Helper to create column-major matrix of specified type and size from provided test grid (rows)
+template <typename Type, size_t M>
+constexpr ColMat<Type, M> get_col_mat(const TestGrid& test_grid) {
+    return ColMat<Type, M>(get_mat<Type, M>(test_grid));
+}
+
+constexpr TestGrid kInput1{{
+        {1.0, 2.0, -3.5, 0.0},
+        {5.0, 6.6, 7.0, -9.0},
+        {-1.0, -2.0, 3.0, -4.0},
+        {-5.0, -6.0, 7.0, -8.0},
+}};
+
+constexpr TestGrid kInput2{{
+        {1.0, 1.0, -2.0, -2.0},
+        {3.6, 3.6, 4.0, 4.0},
+        {-1.0, -1.0, -4.0, -4.0},
+        {-5.5, -5.5, 7.0, 7.0},
+}};
+
+constexpr TestArray kInputVec{1.0, 2.0, 3.0, 4.0};
+
+TEST_CASE_TEMPLATE("Column-major element storage", Type, VALID_TYPES) {
+    SUBCASE("2D") {
+        constexpr ColMat<Type, 2> m{static_cast<Type>(1), static_cast<Type>(2),
+                                    static_cast<Type>(3), static_cast<Type>(4)};
+        CHECK(m(0, 1) == static_cast<Type>(2));
+        CHECK(m(1, 0) == static_cast<Type>(3));
+        CHECK(m[0] == Vec<Type, 2>{static_cast<Type>(1), static_cast<Type>(3)});
+        CHECK(m.col(1) == Vec<Type, 2>{static_cast<Type>(2), static_cast<Type>(4)});
+        CHECK(m.row(1) == Vec<Type, 2>{static_cast<Type>(3), static_cast<Type>(4)});
+        CHECK(m.at(1, 0) == static_cast<Type>(3));
+        CHECK_THROWS(m.at(2, 0));
+    }
+
+    SUBCASE("3D") {
+        constexpr auto m = get_col_mat<Type, 3>(kInput1);
+        constexpr auto r = get_mat<Type, 3>(kInput1);
+        for (size_t i = 0; i < 3; i++) {
+            CHECK(m.row(i) == r.row(i));
+            CHECK(m.col(i) == r.col(i));
+            CHECK(m[i] == r.col(i));
+        }
+        CHECK(Mat<Type, 3>(m) == r);
+    }
+
+    SUBCASE("4D") {
+        constexpr auto v0 = get_vec<Type, 4>(kInput1[0]);
+        constexpr auto v1 = get_vec<Type, 4>(kInput1[1]);
+        constexpr auto v2 = get_vec<Type, 4>(kInput1[2]);
+        constexpr auto v3 = get_vec<Type, 4>(kInput1[3]);
+        constexpr ColMat<Type, 4> m{v0, v1, v2, v3};
+        CHECK(m == get_col_mat<Type, 4>(kInput1));
+        CHECK(m.transpose() == get_col_mat<Type, 4>(kInput1).transpose());
+        CHECK(Mat<Type, 4>(m.transpose()) == get_mat<Type, 4>(kInput1).transpose());
+    }
+}
+
+TEST_CASE_TEMPLATE("Transposed relayouts copy storage as-is", Type, VALID_TYPES) {
+    SUBCASE("3D") {
+        constexpr auto r = get_mat<Type, 3>(kInput1);
+        constexpr ColMat<Type, 3> relaid = r.transpose_relayout();
+        CHECK(Mat<Type, 3>(relaid) == r.transpose());
+        CHECK(std::equal(relaid.cbegin(), relaid.cend(), r.cbegin()));
+        CHECK(relaid.transpose_relayout() == r);
+    }
+
+    SUBCASE("4D") {
+        constexpr auto c = get_col_mat<Type, 4>(kInput2);
+        constexpr Mat<Type, 4> relaid = c.transpose_relayout();
+        CHECK(relaid == Mat<Type, 4>(c).transpose());
+        CHECK(std::equal(relaid.cbegin(), relaid.cend(), c.cbegin()));
+    }
+}
+
+TEST_CASE_TEMPLATE("Column-major products match row-major", Type, VALID_TYPES) {
+    SUBCASE("2D") {
+        constexpr auto a = get_col_mat<Type, 2>(kInput1);
+        constexpr auto b = get_col_mat<Type, 2>(kInput2);
+        constexpr auto v = get_vec<Type, 2>(kInputVec);
+        constexpr auto ra = get_mat<Type, 2>(kInput1);
+        constexpr auto rb = get_mat<Type, 2>(kInput2);
+        CHECK(Mat<Type, 2>(a * b) == ra * rb);
+        CHECK(v * a == Approx(v * ra));
+        CHECK(a * v == Approx(ra * v));
+    }
+
+    SUBCASE("3D") {
+        constexpr auto a = get_col_mat<Type, 3>(kInput1);
+        constexpr auto b = get_col_mat<Type, 3>(kInput2);
+        constexpr auto v = get_vec<Type, 3>(kInputVec);
+        constexpr auto ra = get_mat<Type, 3>(kInput1);
+        constexpr auto rb = get_mat<Type, 3>(kInput2);
+        CHECK(Mat<Type, 3>(a * b) == ra * rb);
+        CHECK(v * a == Approx(v * ra));
+        CHECK(a * v == Approx(ra * v));
+    }
+
+    SUBCASE("4D") {
+        constexpr auto a = get_col_mat<Type, 4>(kInput1);
+        constexpr auto b = get_col_mat<Type, 4>(kInput2);
+        constexpr auto v = get_vec<Type, 4>(kInputVec);
+        constexpr auto ra = get_mat<Type, 4>(kInput1);
+        constexpr auto rb = get_mat<Type, 4>(kInput2);
+
+        // Compile-time (generic) path
+        constexpr auto prod = a * b;
+        constexpr auto row_prod = v * a;
+        constexpr auto col_prod = a * v;
+        CHECK(Mat<Type, 4>(prod) == ra * rb);
+        CHECK(row_prod == Approx(v * ra));
+        CHECK(col_prod == Approx(ra * v));
+
+        // Run-time path (SIMD kernels, if enabled)
+        auto c = a;
+        c *= b;
+        CHECK(c == prod);
+        CHECK(v * a == Approx(row_prod));
+        CHECK(a * v == Approx(col_prod));
+    }
+}
+
+TEST_CASE_TEMPLATE("Column-major inverse and lazy expressions", Type, VALID_TYPES) {
+    SUBCASE("3D") {
+        constexpr auto m = get_col_mat<Type, 3>(kInput1);
+        CHECK(Mat<Type, 3>(m.inverse()) == get_mat<Type, 3>(kInput1).inverse());
+    }
+
+    SUBCASE("4D") {
+        constexpr auto m = get_col_mat<Type, 4>(kInput1);
+        constexpr auto n = get_col_mat<Type, 4>(kInput2);
+        CHECK(Mat<Type, 4>(m.inverse()) == get_mat<Type, 4>(kInput1).inverse());
+
+        const ColMat<Type, 4> sum = vec::expr::lazy(m) + vec::expr::lazy(n) * static_cast<Type>(2);
+        CHECK(sum == m + n * static_cast<Type>(2));
+    }
+}
+
+TEST_CASE_TEMPLATE("Column-major affine transform", Type, VALID_TYPES) {
+    constexpr auto linear = get_mat<Type, 3>(kInput1);
+    constexpr auto translation = get_vec<Type, 3>(kInputVec);
+    constexpr AffineTransform<Type, 3> row_transform(linear, translation);
+    constexpr ColTransform<Type, 3> col_transform(row_transform);
+
+    CHECK(col_transform.get_linear_transform() == ColMat<Type, 3>(linear));
+    CHECK(col_transform.get_translation() == translation);
+    CHECK(Mat<Type, 4>(col_transform) == row_transform);
+    CHECK(AffineTransform<Type, 3>(col_transform) == row_transform);
+
+    // The column-vector form consumed by column-major APIs is a transposed relayout of the same storage
+    constexpr ColMat<Type, 4> column_vector_form = row_transform.transpose_relayout();
+    constexpr auto p = get_vec<Type, 4>({1.0, 2.0, 3.0, 1.0});
+    CHECK(column_vector_form * p == Approx(p * row_transform));
+    CHECK(p * col_transform == Approx(p * row_transform));
+}
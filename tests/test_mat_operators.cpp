@@ -553,6 +553,41 @@ TEST_CASE_TEMPLATE("Vector * matrix", Type, VALID_TYPES) {
     }
 }
 
+TEST_CASE_TEMPLATE("Matrix * vector", Type, VALID_TYPES) {
+    constexpr TestGrid kInput1{{
+            {1.0, 2.0, -3.5, 0.0},
+            {5.0, 6.6, 7.0, -9.0},
+            {-1.0, -2.0, 3.0, -4.0},
+            {-5.0, -6.0, 7.0, -8.0},
+    }};
+    constexpr TestArray kInput2{1.0, 2.0, 3.0, 4.0};
+
+    SUBCASE("2D") {
+        constexpr TestArray kExpected{5.0, 18.2};
+        constexpr auto m = get_mat<Type, 2>(kInput1);
+        constexpr auto v = get_vec<Type, 2>(kInput2);
+        constexpr Vec<Type, 2> v_out = m * v;
+        CHECK(v_out == get_approx_vec<Type, 2>(kExpected));
+    }
+
+    SUBCASE("3D") {
+        constexpr TestArray kExpected{-5.5, 39.2, 4.0};
+        constexpr auto m = get_mat<Type, 3>(kInput1);
+        constexpr auto v = get_vec<Type, 3>(kInput2);
+        constexpr Vec<Type, 3> v_out = m * v;
+        CHECK(v_out == get_approx_vec<Type, 3>(kExpected));
+    }
+
+    SUBCASE("4D") {
+        constexpr TestArray kExpected{-5.5, 3.2, -12.0, -28.0};
+        constexpr auto m = get_mat<Type, 4>(kInput1);
+        constexpr auto v = get_vec<Type, 4>(kInput2);
+        constexpr Vec<Type, 4> v_out = m * v;
+        CHECK(v_out == get_approx_vec<Type, 4>(kExpected));
+        CHECK(m * v == v * m.transpose());
+    }
+}
+
 TEST_CASE_TEMPLATE("Matrix * matrix", Type, VALID_TYPES) {
     constexpr TestGrid kInput1{{
             {1.0, 2.0, -3.5, 0.0},
@@ -0,0 +1,191 @@
+// Unit tests for the octahedral unit vector and smallest-three quaternion encodings
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "quantize.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using vec::OctVec;
+using vec::Quat;
+using vec::QuantizedQuat;
+
+static_assert(sizeof(OctVec) == 4);
+static_assert(sizeof(QuantizedQuat) == 8);
+
+// Number of sample directions and rotations (not a multiple of the lane count, to cover the tail)
+static constexpr size_t kCount = 20003;
+
+// Helper to get evenly spread unit vectors (Fibonacci sphere), plus the axes and diagonals
+template <typename Type>
+std::vector<Vec<Type, 3>> get_directions() {
+    std::vector<Vec<Type, 3>> out;
+    const double golden = std::numbers::pi * (3.0 - std::sqrt(5.0));
+    for (size_t i = 0; i < kCount; i++) {
+        const double z = 1.0 - 2.0 * (static_cast<double>(i) + 0.5) / kCount;
+        const double r = std::sqrt(1.0 - z * z);
+        const double phi = golden * static_cast<double>(i);
+        out.push_back(get_vec<Type, 3>({r * std::cos(phi), r * std::sin(phi), z, 0.0}));
+    }
+    for (const double z : {-1.0, 0.0, 1.0}) {
+        for (const double y : {-1.0, 0.0, 1.0}) {
+            for (const double x : {-1.0, 0.0, 1.0}) {
+                if ((x != 0) || (y != 0) || (z != 0)) {
+                    out.push_back(get_vec<Type, 3>({x, y, z, 0.0}).normalize());
+                }
+            }
+        }
+    }
+    return out;
+}
+
+// Helper to get unit quaternions with every component taking the largest magnitude and sign
+template <typename Type>
+std::vector<Quat<Type>> get_rotations() {
+    std::vector<Quat<Type>> out;
+    const auto axes = get_directions<double>();
+    for (size_t i = 0; i < axes.size(); i++) {
+        const double angle = 2.0 * std::numbers::pi * static_cast<double>(i % 97) / 97.0 - 3.0;
+        const auto q = Quat<double>::from_axis_angle(axes[i], angle);
+        out.emplace_back(static_cast<Type>(q.x()), static_cast<Type>(q.y()),
+                         static_cast<Type>(q.z()), static_cast<Type>(q.w()));
+    }
+    out.emplace_back(Type{1}, Type{0}, Type{0}, Type{0});
+    out.emplace_back(Type{0}, Type{0}, Type{0}, Type{-1});
+    out.emplace_back(Type{0.5}, Type{-0.5}, Type{0.5}, Type{-0.5});
+    return out;
+}
+
+// Helper to get the angle between two unit vectors
+template <typename Type>
+double angle_between(const Vec<Type, 3>& a, const Vec<Type, 3>& b) {
+    const auto d = [](Type x) { return static_cast<double>(x); };
+    const Vec<double, 3> da(d(a.x()), d(a.y()), d(a.z()));
+    const Vec<double, 3> db(d(b.x()), d(b.y()), d(b.z()));
+    return std::atan2(cross(da, db).euclidean(), dot(da, db));
+}
+
+// Helper to get the angle of the rotation taking unit quaternion a to unit quaternion b
+// Note: computed from the chord between the (renormalized) quaternions, which stays accurate for
+// tiny angles where 2 * acos(dot(a, b)) does not
+template <typename Type>
+double angle_between(const Quat<Type>& a, const Quat<Type>& b) {
+    const auto d = [](Type x) { return static_cast<double>(x); };
+    const auto da = Vec<double, 4>(d(a.x()), d(a.y()), d(a.z()), d(a.w())).normalize();
+    auto db = Vec<double, 4>(d(b.x()), d(b.y()), d(b.z()), d(b.w())).normalize();
+    if (dot(da, db) < 0) {
+        db = -db;
+    }
+    return 4.0 * std::atan2((da - db).euclidean(), (da + db).euclidean());
+}
+
+TEST_CASE_TEMPLATE("Octahedral encoding", Type, VALID_TYPES) {
+    SUBCASE("Axes") {
+        constexpr std::int16_t kMax = vec::kOctMax;
+        CHECK(vec::encode_oct(Vec<Type, 3>::k()) == OctVec{0, 0});
+        CHECK(vec::encode_oct(Vec<Type, 3>::i()) == OctVec{kMax, 0});
+        CHECK(vec::encode_oct(-Vec<Type, 3>::j()) == OctVec{0, -kMax});
+        CHECK(vec::encode_oct(-Vec<Type, 3>::k()) == OctVec{kMax, kMax});
+        CHECK(vec::decode_oct<Type>({0, 0}) == Vec<Type, 3>::k());
+        CHECK(vec::decode_oct<Type>({-kMax, 0}) == -Vec<Type, 3>::i());
+        CHECK(vec::decode_oct<Type>({kMax, kMax}) == -Vec<Type, 3>::k());
+    }
+
+    SUBCASE("Angular error") {
+        double max_error = 0;
+        for (const auto& n : get_directions<Type>()) {
+            const auto decoded = vec::decode_oct<Type>(vec::encode_oct(n));
+            CHECK(decoded.euclidean() == doctest::Approx(1.0).epsilon(1e-6));
+            max_error = std::max(max_error, angle_between(n, decoded));
+        }
+        CHECK(max_error < vec::kOctMaxAngularError);
+        MESSAGE("Octahedral max angular error (degrees): ", max_error * 180 / std::numbers::pi);
+    }
+
+    SUBCASE("Constexpr") {
+        constexpr auto kInput = get_vec<Type, 3>({0.6L, -0.8L, 0.0L});
+        constexpr auto kEncoded = vec::encode_oct(kInput);
+        constexpr auto kU = static_cast<std::int16_t>(0.6 / 1.4 * vec::kOctMax + 0.5);
+        constexpr auto kV = static_cast<std::int16_t>(-0.8 / 1.4 * vec::kOctMax - 0.5);
+        static_assert(kEncoded == OctVec{kU, kV});
+        constexpr auto kDecoded = vec::decode_oct<Type>(kEncoded);
+        CHECK(angle_between(kInput, kDecoded) < vec::kOctMaxAngularError);
+    }
+}
+
+TEST_CASE_TEMPLATE("Smallest-three quaternion encoding", Type, VALID_TYPES) {
+    SUBCASE("Layout") {
+        const Quat<Type> q(0, 0, 1, 0);
+        const auto e = vec::encode_quat(q);
+        CHECK((e.bits & 3) == 2);
+        const auto zero = static_cast<std::uint64_t>(vec::kQuatZero);
+        CHECK(e.bits == (2 | (zero << 2) | (zero << 22) | (zero << 42)));
+        CHECK(vec::decode_quat<Type>(e) == q);
+    }
+
+    SUBCASE("Sign of the dropped component") {
+        const Quat<Type> q(static_cast<Type>(0.1), static_cast<Type>(-0.2),
+                           static_cast<Type>(0.3), static_cast<Type>(-0.9)); // w largest, negative
+        const auto decoded = vec::decode_quat<Type>(vec::encode_quat(q.normalize()));
+        CHECK(decoded.w() > 0);
+        CHECK(approx_eq(decoded, -q.normalize(), static_cast<Type>(1e-5), static_cast<Type>(1e-5)));
+    }
+
+    SUBCASE("Angular error") {
+        double max_error = 0;
+        for (const auto& q : get_rotations<Type>()) {
+            const auto decoded = vec::decode_quat<Type>(vec::encode_quat(q));
+            max_error = std::max(max_error, angle_between(q, decoded));
+        }
+        CHECK(max_error < vec::kQuatMaxAngularError);
+        MESSAGE("Smallest-three max angular error (degrees): ", max_error * 180 / std::numbers::pi);
+    }
+
+    SUBCASE("Rotation matrices") {
+        const auto m = AffineTransform<Type, 3>::rotate_z(static_cast<Type>(1.2));
+        const auto q = Quat<Type>::from_mat3(m);
+        const auto decoded = vec::decode_quat<Type>(vec::encode_quat(q)).to_mat3();
+        const auto v = get_vec<Type, 3>({0.3L, -2.0L, 1.0L});
+        CHECK(angle_between(m * v, decoded * v) < vec::kQuatMaxAngularError);
+    }
+
+    SUBCASE("Constexpr") {
+        constexpr Quat<Type> kInput(0.5, 0.5, -0.5, 0.5);
+        constexpr auto kDecoded = vec::decode_quat<Type>(vec::encode_quat(kInput));
+        CHECK(angle_between(kInput, kDecoded) < vec::kQuatMaxAngularError);
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch encoding", Type, float, double) {
+    SUBCASE("Octahedral") {
+        const auto directions = get_directions<Type>();
+        std::vector<OctVec> encoded(directions.size());
+        vec::encode_oct<Type>(directions, encoded);
+        std::vector<Vec<Type, 3>> decoded(directions.size());
+        vec::decode_oct<Type>(encoded, decoded);
+        for (size_t i = 0; i < directions.size(); i++) {
+            const auto expected = vec::encode_oct(directions[i]);
+            REQUIRE(std::abs(encoded[i].u - expected.u) <= 1);
+            REQUIRE(std::abs(encoded[i].v - expected.v) <= 1);
+            REQUIRE(angle_between(directions[i], decoded[i]) < vec::kOctMaxAngularError);
+        }
+    }
+
+    SUBCASE("Smallest three") {
+        const auto rotations = get_rotations<Type>();
+        std::vector<QuantizedQuat> encoded(rotations.size());
+        vec::encode_quat<Type>(rotations, encoded);
+        std::vector<Quat<Type>> decoded(rotations.size());
+        vec::decode_quat<Type>(encoded, decoded);
+        for (size_t i = 0; i < rotations.size(); i++) {
+            REQUIRE((encoded[i].bits & 3) == (vec::encode_quat(rotations[i]).bits & 3));
+            REQUIRE(angle_between(rotations[i], decoded[i]) < vec::kQuatMaxAngularError);
+        }
+    }
+}
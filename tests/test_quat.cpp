@@ -0,0 +1,138 @@
+// Unit tests for the Quat class implementation
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "quat.hpp"
+
+#include <vector>
+
+using vec::Quat;
+
+// Helper to create a unit quaternion rotating by rad around the (normalized) axis
+template <typename Type>
+Quat<Type> get_quat(const TestArray& axis, long double rad) {
+    return Quat<Type>::from_axis_angle(get_vec<Type, 3>(axis).normalize(), static_cast<Type>(rad));
+}
+
+TEST_CASE_TEMPLATE("Construct quaternion", Type, VALID_TYPES) {
+    constexpr Quat<Type> q_identity;
+    CHECK(q_identity.x() == static_cast<Type>(0));
+    CHECK(q_identity.w() == static_cast<Type>(1));
+    CHECK(q_identity == Quat<Type>::identity());
+
+    constexpr Quat<Type> q(get_vec<Type, 3>({1.0, 2.0, 3.0}), static_cast<Type>(4));
+    CHECK(q.xyzw() == get_vec<Type, 4>({1.0, 2.0, 3.0, 4.0}));
+    CHECK(q.vector() == get_vec<Type, 3>({1.0, 2.0, 3.0}));
+    CHECK(q.conjugate() == Quat<Type>(-1, -2, -3, 4));
+    CHECK(q.norm2() == doctest::Approx(30.0));
+    CHECK(q * q.inverse() == Approx(Quat<Type>::identity()));
+    CHECK(q.normalize().norm() == doctest::Approx(1.0));
+
+    constexpr auto q_axis = Quat<Type>::from_axis_angle(Vec<Type, 3>::k(), static_cast<Type>(0.5));
+    CHECK(q_axis == Approx(Quat<Type>(0, 0, std::sin(static_cast<Type>(0.25)),
+                                      std::cos(static_cast<Type>(0.25)))));
+}
+
+TEST_CASE_TEMPLATE("Quaternion rotation matches rotation matrices", Type, VALID_TYPES) {
+    const Type kAngle = static_cast<Type>(0.7);
+
+    SUBCASE("Axis rotations") {
+        using Transform = AffineTransform<Type, 3>;
+        CHECK(Quat<Type>::from_axis_angle(Vec<Type, 3>::i(), kAngle).to_mat3()
+              == Approx(Transform::rotate_x(kAngle)));
+        CHECK(Quat<Type>::from_axis_angle(Vec<Type, 3>::j(), kAngle).to_mat3()
+              == Approx(Transform::rotate_y(kAngle)));
+        CHECK(Quat<Type>::from_axis_angle(Vec<Type, 3>::k(), kAngle).to_mat3()
+              == Approx(Transform::rotate_z(kAngle)));
+    }
+
+    SUBCASE("Rotate vector") {
+        const auto q = get_quat<Type>({1.0, -2.0, 0.5}, 1.3L);
+        const auto v = get_vec<Type, 3>({0.3, 4.0, -2.0});
+        CHECK(q.rotate(v) == Approx(q.to_mat3() * v));
+    }
+
+    SUBCASE("Composition") {
+        const auto a = get_quat<Type>({1.0, -2.0, 0.5}, 1.3L);
+        const auto b = get_quat<Type>({0.0, 1.0, 1.0}, -0.4L);
+        const auto v = get_vec<Type, 3>({0.3, 4.0, -2.0});
+        CHECK((a * b).to_mat3() == Approx(a.to_mat3() * b.to_mat3()));
+        CHECK((a * b).rotate(v) == Approx(a.rotate(b.rotate(v))));
+
+        auto c = a;
+        c *= b;
+        CHECK(c == a * b);
+    }
+}
+
+TEST_CASE_TEMPLATE("Convert between quaternion, matrix, and transform", Type, VALID_TYPES) {
+    // Angles chosen so each branch of from_mat3 (trace and each dominant diagonal) is exercised
+    const TestArray kAxes[] = {{1.0, 2.0, 3.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+    for (const auto& axis : kAxes) {
+        for (const long double rad : {0.5L, 3.0L}) {
+            const auto q = get_quat<Type>(axis, rad);
+            const auto q_mat = Quat<Type>::from_mat3(q.to_mat3());
+            const auto q_col_mat = Quat<Type>::from_mat3(q.template to_mat3<vec::Layout::ColMajor>());
+            const auto q_affine = Quat<Type>::from_affine(q.to_affine());
+            // Note: q and -q represent the same rotation
+            CHECK(std::abs(dot(q, q_mat)) == doctest::Approx(1.0));
+            CHECK(std::abs(dot(q, q_col_mat)) == doctest::Approx(1.0));
+            CHECK(std::abs(dot(q, q_affine)) == doctest::Approx(1.0));
+            CHECK(q_mat.to_mat3() == Approx(q.to_mat3()));
+        }
+    }
+
+    const auto q = get_quat<Type>({1.0, 2.0, 3.0}, 0.5L);
+    const auto affine = q.to_affine();
+    const auto p = get_vec<Type, 3>({0.3, 4.0, -2.0});
+    CHECK(affine.get_linear_transform() == Approx(q.to_mat3().transpose()));
+    CHECK(affine.get_translation() == Vec<Type, 3>());
+    CHECK(Vec<Type, 3>(Vec<Type, 4>(p[0], p[1], p[2], static_cast<Type>(1)) * affine)
+          == Approx(q.rotate(p)));
+}
+
+TEST_CASE_TEMPLATE("Interpolate quaternions", Type, VALID_TYPES) {
+    const auto a = get_quat<Type>({1.0, 2.0, 3.0}, 0.2L);
+    const auto b = get_quat<Type>({1.0, 2.0, 3.0}, 1.4L);
+    const auto mid = get_quat<Type>({1.0, 2.0, 3.0}, 0.8L);
+
+    SUBCASE("Slerp") {
+        CHECK(slerp(a, b, static_cast<Type>(0)) == Approx(a));
+        CHECK(slerp(a, b, static_cast<Type>(1)) == Approx(b));
+        CHECK(slerp(a, b, static_cast<Type>(0.5)) == Approx(mid));
+        CHECK(slerp(a, b, static_cast<Type>(0.25)).norm() == doctest::Approx(1.0));
+
+        // Shortest path: -b is the same rotation as b
+        CHECK(slerp(a, -b, static_cast<Type>(0.5)) == Approx(mid));
+
+        // Nearly identical inputs fall back to linear weights
+        const auto c = get_quat<Type>({1.0, 2.0, 3.0}, 0.2001L);
+        CHECK(slerp(a, c, static_cast<Type>(0.5)).norm() == doctest::Approx(1.0));
+    }
+
+    SUBCASE("Nlerp") {
+        CHECK(nlerp(a, b, static_cast<Type>(0.5)) == Approx(mid));
+        CHECK(nlerp(a, -b, static_cast<Type>(0.5)) == Approx(mid));
+        CHECK(nlerp(a, b, static_cast<Type>(0.3)).norm() == doctest::Approx(1.0));
+    }
+
+    SUBCASE("Batch slerp") {
+        const std::vector<Quat<Type>> as{a, b, a, -a};
+        const std::vector<Quat<Type>> bs{b, a, -b, a};
+        const std::vector<Type> ts{0.5, 0.25, 0.75, 0.5};
+        std::vector<Quat<Type>> out(as.size());
+        batch_slerp(as, bs, ts, out);
+        for (size_t i = 0; i < as.size(); i++) {
+            CHECK(out[i] == Approx(slerp(as[i], bs[i], ts[i])));
+        }
+
+        batch_slerp(as, bs, static_cast<Type>(0.5), out);
+        for (size_t i = 0; i < as.size(); i++) {
+            CHECK(out[i] == Approx(slerp(as[i], bs[i], static_cast<Type>(0.5))));
+        }
+    }
+}
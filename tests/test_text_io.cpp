@@ -0,0 +1,230 @@
+// Unit tests for the bulk text formatting and parsing functions
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "text_io.hpp"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace io = vec::io;
+using vec::ThreadPool;
+
+// Number of records per test array
+static constexpr size_t kCount = 2000;
+
+// Helper to generate vectors whose shortest forms vary in length (fractions, tiny and huge values)
+template <typename Type, size_t M>
+std::vector<Vec<Type, M>> get_vecs() {
+    std::vector<Vec<Type, M>> out(kCount);
+    for (size_t i = 0; i < kCount; i++) {
+        const auto n = static_cast<long double>(i);
+        out[i][0] = static_cast<Type>(n / 7.0L);
+        out[i][1] = static_cast<Type>(-n * 1e-30L);
+        if constexpr (M > 2) {
+            out[i][2] = static_cast<Type>(n * 1e20L + 0.1L);
+        }
+        if constexpr (M > 3) {
+            out[i][3] = static_cast<Type>(i % 5);
+        }
+    }
+    return out;
+}
+
+// Helper to check that two arrays hold bitwise-identical records
+template <typename Record>
+bool is_identical(const std::vector<Record>& a, const std::vector<Record>& b) {
+    return (a.size() == b.size())
+           && std::equal(a.begin(), a.end(), b.begin(), [](const Record& x, const Record& y) {
+                  return std::memcmp(&x, &y, sizeof(Record)) == 0;
+              });
+}
+
+// Helper to format a whole array into a string
+template <typename Record>
+std::string to_text(const std::vector<Record>& records, char delimiter) {
+    std::string out(records.size() * io::kMaxRecordChars<Record>, '\0');
+    const auto result = io::format<Record>(out, records, delimiter);
+    REQUIRE(result.count == records.size());
+    out.resize(static_cast<size_t>(result.ptr - out.data()));
+    return out;
+}
+
+TEST_CASE_TEMPLATE("Format record", Type, VALID_TYPES) {
+    const auto v = get_vec<Type, 4>({1.5L, -2.0L, 0.25L, 100.0L});
+    char buffer[io::kMaxRecordChars<Vec<Type, 4>>];
+
+    SUBCASE("Delimiters") {
+        auto result = io::format_record(std::begin(buffer), std::end(buffer), v);
+        REQUIRE(result.ec == std::errc{});
+        CHECK(std::string_view(buffer, result.ptr) == "1.5,-2,0.25,100\n");
+        result = io::format_record(std::begin(buffer), std::end(buffer), v, ' ');
+        REQUIRE(result.ec == std::errc{});
+        CHECK(std::string_view(buffer, result.ptr) == "1.5 -2 0.25 100\n");
+    }
+
+    SUBCASE("Buffer too small") {
+        const auto result = io::format_record(buffer, buffer + 15, v);
+        CHECK(result.ec == std::errc::value_too_large);
+    }
+
+    SUBCASE("Worst case length") {
+        const Type worst = -std::numeric_limits<Type>::denorm_min() * 3;
+        const Vec<Type, 4> w(worst, std::numeric_limits<Type>::lowest(),
+                             std::numeric_limits<Type>::min(), worst);
+        const auto result = io::format_record(std::begin(buffer), std::end(buffer), w);
+        CHECK(result.ec == std::errc{});
+    }
+}
+
+TEST_CASE_TEMPLATE("Text round trip", Type, VALID_TYPES) {
+    SUBCASE("3D vectors - CSV") {
+        const auto vecs = get_vecs<Type, 3>();
+        const auto text = to_text(vecs, ',');
+        std::vector<Vec<Type, 3>> parsed;
+        const auto result = io::parse(text, parsed);
+        CHECK(result.ec == std::errc{});
+        CHECK(result.count == kCount);
+        CHECK(result.ptr == text.data() + text.size());
+        CHECK(is_identical(parsed, vecs));
+    }
+
+    SUBCASE("2D vectors - whitespace") {
+        const auto vecs = get_vecs<Type, 2>();
+        const auto text = to_text(vecs, ' ');
+        std::vector<Vec<Type, 2>> parsed;
+        CHECK(io::parse(text, parsed).ec == std::errc{});
+        CHECK(is_identical(parsed, vecs));
+    }
+
+    SUBCASE("Matrices and transforms") {
+        constexpr TestGrid kInput{{
+                {1.0L, 2.0L, -3.5L, 0.1L},
+                {5.0L, 6.6L, 7.0L, -9.0L},
+                {-1.0L, -2.0L, 3.0L, -4.0L},
+                {-5.0L, -6.0L, 7.0L, -8.0L},
+        }};
+        const auto m = get_mat<Type, 4>(kInput);
+        const std::vector<Mat<Type, 4>> mats{m, m.transpose(), m * static_cast<Type>(1.0L / 3.0L)};
+        std::vector<Mat<Type, 4>> parsed_mats;
+        CHECK(io::parse(to_text(mats, ','), parsed_mats).ec == std::errc{});
+        REQUIRE(parsed_mats.size() == mats.size());
+        for (size_t i = 0; i < mats.size(); i++) {
+            for (size_t r = 0; r < 4; r++) {
+                for (size_t c = 0; c < 4; c++) {
+                    CHECK(parsed_mats[i](r, c) == mats[i](r, c));
+                }
+            }
+        }
+
+        using Transform = AffineTransform<Type, 3>;
+        const std::vector<Transform> transforms{
+                Transform(Transform::rotate_y(static_cast<Type>(0.6)),
+                          get_vec<Type, 3>({2.0, 0.1, -1.0})),
+        };
+        const auto text = to_text(transforms, ',');
+        CHECK(std::count(text.begin(), text.end(), ',') == 11);
+        std::vector<Transform> parsed_transforms;
+        CHECK(io::parse(text, parsed_transforms).ec == std::errc{});
+        REQUIRE(parsed_transforms.size() == 1);
+        CHECK(parsed_transforms[0] == transforms[0]);
+    }
+}
+
+TEST_CASE_TEMPLATE("Chunked formatting", Type, VALID_TYPES) {
+    const auto vecs = get_vecs<Type, 3>();
+    const auto expected = to_text(vecs, ',');
+
+    // Flush a small buffer repeatedly, resuming after the records that fit
+    std::string out;
+    std::vector<char> buffer(10 * io::kMaxRecordChars<Vec<Type, 3>> + 7);
+    std::span<const Vec<Type, 3>> remaining(vecs);
+    while (!remaining.empty()) {
+        const auto result = io::format<Vec<Type, 3>>(buffer, remaining);
+        REQUIRE(result.count > 0);
+        out.append(buffer.data(), result.ptr);
+        remaining = remaining.subspan(result.count);
+    }
+    CHECK(out == expected);
+}
+
+TEST_CASE_TEMPLATE("Text parse errors", Type, VALID_TYPES) {
+    std::vector<Vec<Type, 3>> parsed;
+
+    SUBCASE("Separators, CRLF and blank lines") {
+        const std::string_view text = "  1, 2\t3\r\n\r\n \n-4 ,5,  6";
+        const auto result = io::parse(text, parsed);
+        CHECK(result.ec == std::errc{});
+        REQUIRE(parsed.size() == 2);
+        CHECK(parsed[0] == get_vec<Type, 3>({1.0L, 2.0L, 3.0L}));
+        CHECK(parsed[1] == get_vec<Type, 3>({-4.0L, 5.0L, 6.0L}));
+    }
+
+    SUBCASE("Too few scalars") {
+        const std::string_view text = "1,2,3\n4,5\n7,8,9\n";
+        const auto result = io::parse(text, parsed);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.count == 1);
+        CHECK(result.ptr == text.data() + 9);
+        CHECK(parsed.size() == 1);
+    }
+
+    SUBCASE("Too many scalars") {
+        const std::string_view text = "1,2,3,4\n";
+        const auto result = io::parse(text, parsed);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.ptr == text.data() + 6);
+    }
+
+    SUBCASE("Malformed scalar") {
+        const std::string_view text = "1,2,3\n1,2x,3\n";
+        const auto result = io::parse(text, parsed);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.count == 1);
+        CHECK(result.ptr == text.data() + 9);
+    }
+
+    SUBCASE("Out of range") {
+        const std::string_view text = "1,2,1e99999\n";
+        CHECK(io::parse(text, parsed).ec == std::errc::result_out_of_range);
+    }
+}
+
+TEST_CASE_TEMPLATE("Parallel text parsing", Type, VALID_TYPES) {
+    ThreadPool pool(3);
+    const auto vecs = get_vecs<Type, 4>();
+    const auto text = to_text(vecs, ' ');
+
+    SUBCASE("Matches sequential parsing") {
+        for (const size_t grain : {size_t{1}, size_t{100}, size_t{4096}, io::kTextParseGrain}) {
+            std::vector<Vec<Type, 4>> parsed;
+            const auto result = io::parse(text, parsed, pool, grain);
+            CHECK(result.ec == std::errc{});
+            CHECK(result.count == kCount);
+            CHECK(is_identical(parsed, vecs));
+        }
+    }
+
+    SUBCASE("Reports the first error") {
+        auto corrupt = text;
+        const size_t line = 1234;
+        size_t offset = 0;
+        for (size_t i = 0; i < line; i++) {
+            offset = corrupt.find('\n', offset) + 1;
+        }
+        corrupt[offset] = '#';
+        std::vector<Vec<Type, 4>> parsed;
+        const auto result = io::parse(corrupt, parsed, pool, 512);
+        CHECK(result.ec == std::errc::invalid_argument);
+        CHECK(result.count == line);
+        CHECK(result.ptr == corrupt.data() + offset);
+        CHECK(parsed.size() == line);
+    }
+}
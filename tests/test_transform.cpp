@@ -121,62 +121,82 @@ TEST_CASE_TEMPLATE("Construct transform with vector only", Type, VALID_TYPES) {
 }
 
 TEST_CASE_TEMPLATE("Construct x-axis rotation matrix", Type, VALID_TYPES) {
-    const Type kAngle = M_PI/2.0;
+    constexpr Type kAngle = M_PI/2.0;
     constexpr TestGrid kExpected{{
             {1.0, 0.0, 0.0},
             {0.0, 0.0, -1.0},
             {0.0, 1.0, 0.0},
     }};
 
-    // TODO: Add constexpr test once support for constexpr sin/cos is added
     SUBCASE("3D") {
-        auto rotate_x = AffineTransform<Type, 3>::rotate_x(kAngle);
+        constexpr auto rotate_x = AffineTransform<Type, 3>::rotate_x(kAngle);
         CHECK(rotate_x == get_approx_mat<Type, 3>(kExpected));
     }
+
+    SUBCASE("3D run-time matches compile-time") {
+        const Type angle = static_cast<Type>(0.7);
+        constexpr auto expected = AffineTransform<Type, 3>::rotate_x(static_cast<Type>(0.7));
+        CHECK(AffineTransform<Type, 3>::rotate_x(angle) == Approx(expected));
+    }
 }
 
 TEST_CASE_TEMPLATE("Construct y-axis rotation matrix", Type, VALID_TYPES) {
-    const Type kAngle = M_PI/2.0;
+    constexpr Type kAngle = M_PI/2.0;
     constexpr TestGrid kExpected{{
             {0.0, 0.0, 1.0},
             {0.0, 1.0, 0.0},
             {-1.0, 0.0, 0.0},
     }};
 
-    // TODO: Add constexpr test once support for constexpr sin/cos is added
     SUBCASE("3D") {
-        auto rotate_y = AffineTransform<Type, 3>::rotate_y(kAngle);
+        constexpr auto rotate_y = AffineTransform<Type, 3>::rotate_y(kAngle);
         CHECK(rotate_y == get_approx_mat<Type, 3>(kExpected));
     }
+
+    SUBCASE("3D run-time matches compile-time") {
+        const Type angle = static_cast<Type>(0.7);
+        constexpr auto expected = AffineTransform<Type, 3>::rotate_y(static_cast<Type>(0.7));
+        CHECK(AffineTransform<Type, 3>::rotate_y(angle) == Approx(expected));
+    }
 }
 
 TEST_CASE_TEMPLATE("Construct z-axis rotation matrix", Type, VALID_TYPES) {
-    const Type kAngle = M_PI/2.0;
+    constexpr Type kAngle = M_PI/2.0;
     constexpr TestGrid kExpected{{
             {0.0, -1.0, 0.0},
             {1.0, 0.0, 0.0},
             {0.0, 0.0, 1.0},
     }};
 
-    // TODO: Add constexpr test once support for constexpr sin/cos is added
     SUBCASE("3D") {
-        auto rotate_z = AffineTransform<Type, 3>::rotate_z(kAngle);
+        constexpr auto rotate_z = AffineTransform<Type, 3>::rotate_z(kAngle);
         CHECK(rotate_z == get_approx_mat<Type, 3>(kExpected));
     }
+
+    SUBCASE("3D run-time matches compile-time") {
+        const Type angle = static_cast<Type>(0.7);
+        constexpr auto expected = AffineTransform<Type, 3>::rotate_z(static_cast<Type>(0.7));
+        CHECK(AffineTransform<Type, 3>::rotate_z(angle) == Approx(expected));
+    }
 }
 
 TEST_CASE_TEMPLATE("Construct 2D rotation matrix", Type, VALID_TYPES) {
-    const Type kAngle = M_PI/2.0;
+    constexpr Type kAngle = M_PI/2.0;
     constexpr TestGrid kExpected{{
             {0.0, -1.0},
             {1.0, 0.0},
     }};
 
-    // TODO: Add constexpr test once support for constexpr sin/cos is added
     SUBCASE("2D") {
-        auto rotate_z = AffineTransform<Type, 2>::rotate(kAngle);
+        constexpr auto rotate_z = AffineTransform<Type, 2>::rotate(kAngle);
         CHECK(rotate_z == get_approx_mat<Type, 2>(kExpected));
     }
+
+    SUBCASE("2D run-time matches compile-time") {
+        const Type angle = static_cast<Type>(0.7);
+        constexpr auto expected = AffineTransform<Type, 2>::rotate(static_cast<Type>(0.7));
+        CHECK(AffineTransform<Type, 2>::rotate(angle) == Approx(expected));
+    }
 }
 
 TEST_CASE_TEMPLATE("Test getting linear transform", Type, VALID_TYPES) {
@@ -274,3 +294,91 @@ TEST_CASE_TEMPLATE("Test setting translation", Type, VALID_TYPES) {
         CHECK(affine_transform == get_mat<Type, 4>(kExpected));
     }
 }
+
+TEST_CASE_TEMPLATE("Compose transforms", Type, VALID_TYPES) {
+    constexpr TestGrid kLinear1{{
+            {1.0, 2.0, -3.0},
+            {4.0, -5.0, 6.0},
+            {-7.0, 8.0, 9.0},
+    }};
+    constexpr TestGrid kLinear2{{
+            {0.5, -1.0, 2.0},
+            {1.5, 0.25, -3.0},
+            {2.0, 4.0, 1.0},
+    }};
+    constexpr TestArray kTranslation1{1.0, 2.0, 3.0};
+    constexpr TestArray kTranslation2{-4.0, 0.5, 2.0};
+
+    SUBCASE("2D") {
+        constexpr AffineTransform<Type, 2> a(get_mat<Type, 2>(kLinear1), get_vec<Type, 2>(kTranslation1));
+        constexpr AffineTransform<Type, 2> b(get_mat<Type, 2>(kLinear2), get_vec<Type, 2>(kTranslation2));
+        constexpr AffineTransform<Type, 2> ab = a * b;
+        CHECK(ab == Approx(Mat<Type, 3>(a) * Mat<Type, 3>(b)));
+
+        auto c = a;
+        c *= b;
+        CHECK(c == ab);
+    }
+
+    SUBCASE("3D") {
+        constexpr AffineTransform<Type, 3> a(get_mat<Type, 3>(kLinear1), get_vec<Type, 3>(kTranslation1));
+        constexpr AffineTransform<Type, 3> b(get_mat<Type, 3>(kLinear2), get_vec<Type, 3>(kTranslation2));
+        constexpr AffineTransform<Type, 3> ab = a * b;
+        CHECK(ab == Approx(Mat<Type, 4>(a) * Mat<Type, 4>(b)));
+
+        auto c = a;
+        c *= b;
+        CHECK(c == ab);
+    }
+}
+
+TEST_CASE_TEMPLATE("Invert transform", Type, VALID_TYPES) {
+    constexpr TestGrid kLinear{{
+            {1.0, 2.0, -3.0},
+            {4.0, -5.0, 6.0},
+            {-7.0, 8.0, 9.0},
+    }};
+    constexpr TestArray kTranslation{1.0, 2.0, 3.0};
+
+    SUBCASE("2D") {
+        constexpr AffineTransform<Type, 2> a(get_mat<Type, 2>(kLinear), get_vec<Type, 2>(kTranslation));
+        constexpr AffineTransform<Type, 2> a_inverse = a.inverse();
+        CHECK(a_inverse == Approx(Mat<Type, 3>(a).inverse()));
+        CHECK(a * a_inverse == Approx(AffineTransform<Type, 2>()));
+
+        const auto a_try_inverse = a.try_inverse();
+        REQUIRE(a_try_inverse.has_value());
+        CHECK(*a_try_inverse == Approx(a_inverse));
+        CHECK_FALSE(AffineTransform<Type, 2>(Mat<Type, 2>()).try_inverse().has_value());
+    }
+
+    SUBCASE("3D") {
+        constexpr AffineTransform<Type, 3> a(get_mat<Type, 3>(kLinear), get_vec<Type, 3>(kTranslation));
+        constexpr AffineTransform<Type, 3> a_inverse = a.inverse();
+        CHECK(a_inverse == Approx(Mat<Type, 4>(a).inverse()));
+        CHECK(a * a_inverse == Approx(AffineTransform<Type, 3>()));
+
+        const auto a_try_inverse = a.try_inverse();
+        REQUIRE(a_try_inverse.has_value());
+        CHECK(*a_try_inverse == Approx(a_inverse));
+        CHECK_FALSE(AffineTransform<Type, 3>(Mat<Type, 3>()).try_inverse().has_value());
+    }
+}
+
+TEST_CASE_TEMPLATE("Invert rigid transform", Type, VALID_TYPES) {
+    constexpr TestArray kTranslation{1.0, -2.0, 3.0};
+
+    SUBCASE("2D") {
+        const AffineTransform<Type, 2> a(AffineTransform<Type, 2>::rotate(static_cast<Type>(0.7)),
+                                         get_vec<Type, 2>(kTranslation));
+        CHECK(a.rigid_inverse() == Approx(a.inverse()));
+    }
+
+    SUBCASE("3D") {
+        const auto rotation = AffineTransform<Type, 3>::rotate_x(static_cast<Type>(0.3))
+                            * AffineTransform<Type, 3>::rotate_z(static_cast<Type>(-1.1));
+        const AffineTransform<Type, 3> a(rotation, get_vec<Type, 3>(kTranslation));
+        CHECK(a.rigid_inverse() == Approx(a.inverse()));
+        CHECK(a * a.rigid_inverse() == Approx(AffineTransform<Type, 3>()));
+    }
+}
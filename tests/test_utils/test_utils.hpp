@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <type_traits>
+#include <vector>
 
 #include "vec.hpp"
 #include "mat.hpp"
@@ -102,3 +104,30 @@ template <typename Type, size_t M>
 constexpr Approx<Mat<Type, M>> get_approx_mat(const TestGrid& test_grid) {
     return Approx(get_mat<Type, M>(test_grid));
 }
+
+// Helper to generate a deterministic list of count M-dimensional test vectors
+// Magnitudes repeat every 97 vectors, so long lists stay within a modest range
+template <typename Type, size_t M>
+std::vector<Vec<Type, M>> get_vecs(size_t count, long double seed) {
+    std::vector<Vec<Type, M>> out(count);
+    for (size_t i = 0; i < count; i++) {
+        for (size_t k = 0; k < M; k++) {
+            const auto value = seed * (1.0L + i % 97) - 0.75L * k * (i % 3) + 0.5L;
+            out[i][k] = static_cast<Type>(value);
+        }
+    }
+    return out;
+}
+
+// Helper to check that two values (or ranges of values) hold the same bit patterns, so -0 differs
+// from +0, where NaN matches any NaN
+template <typename Value>
+bool same_bits(const Value& a, const Value& b) {
+    if constexpr (std::is_floating_point_v<Value>) {
+        return (std::isnan(a) && std::isnan(b))
+                || ((a == b) && (std::signbit(a) == std::signbit(b)));
+    } else {
+        return std::equal(a.cbegin(), a.cend(), b.cbegin(), b.cend(),
+                          [](const auto& x, const auto& y) { return same_bits(x, y); });
+    }
+}
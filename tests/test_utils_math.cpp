@@ -0,0 +1,265 @@
+// Unit tests for the constexpr math functions in utils.hpp
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "utils.hpp"
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace utils = vec::utils;
+
+// Test inputs, shared by several functions
+static constexpr std::array<long double, 14> kAngles{
+        -10.0L, -3.5L, -1.0L, -0.3L, 0.0L, 1e-5L, 0.5L, 1.0L, 2.0L, 1.5707963L, 3.1415926L, 6.0L,
+        100.0L, 1000.0L};
+static constexpr std::array<long double, 7> kCosines{-1.0L, -0.99L, -0.5L, 0.0L, 0.3L, 0.999L, 1.0L};
+static constexpr std::array<long double, 10> kExponents{
+        -50.0L, -10.0L, -1.0L, -1e-3L, 0.0L, 0.5L, 1.0L, 10.0L, 50.0L, 80.0L};
+static constexpr std::array<long double, 11> kPositives{
+        1e-30L, 1e-5L, 0.1L, 0.5L, 0.99L, 1.0L, 1.01L, 2.0L, 10.0L, 12345.678L, 1e30L};
+static constexpr std::array<std::array<long double, 2>, 11> kPoints{{
+        {1.0L, 1.0L}, {1.0L, -1.0L}, {-1.0L, -1.0L}, {-1.0L, 1.0L}, {0.0L, 1.0L}, {0.0L, -1.0L},
+        {1.0L, 0.0L}, {-1.0L, 0.0L}, {3.0L, 0.5L}, {-0.25L, 4.0L}, {0.0L, 0.0L},
+}};
+
+// Helper to evaluate fn on each input at compile time (when used to initialize a constexpr value)
+template <typename Type, size_t N, typename Fn>
+constexpr std::array<Type, N> evaluate(const std::array<long double, N>& inputs, Fn fn) {
+    std::array<Type, N> out{};
+    for (size_t i = 0; i < N; i++) {
+        out[i] = fn(static_cast<Type>(inputs[i]));
+    }
+    return out;
+}
+
+// Helper to check a compile-time result against the standard library within a few ulps of
+// max(|expected|, scale)
+template <typename Type>
+bool is_close(Type actual, Type expected, Type scale = 0) {
+    constexpr Type kTolerance = 8 * std::numeric_limits<Type>::epsilon();
+    return std::abs(actual - expected) <= kTolerance * std::max(std::abs(expected), scale);
+}
+
+TEST_CASE_TEMPLATE("Constexpr square root", Type, VALID_TYPES) {
+    SUBCASE("Matches standard library") {
+        constexpr auto sqrts = evaluate<Type>(kPositives, [](Type x) { return utils::sqrt(x); });
+        constexpr auto rsqrts = evaluate<Type>(kPositives, [](Type x) { return utils::rsqrt(x); });
+        for (size_t i = 0; i < kPositives.size(); i++) {
+            const auto x = static_cast<Type>(kPositives[i]);
+            CHECK(is_close(sqrts[i], std::sqrt(x)));
+            CHECK(is_close(rsqrts[i], static_cast<Type>(1) / std::sqrt(x)));
+        }
+    }
+
+    SUBCASE("Exact and special values") {
+        constexpr Type kSqrt = utils::sqrt(static_cast<Type>(16));
+        constexpr Type kRsqrt = utils::rsqrt(static_cast<Type>(4));
+        constexpr Type kZero = utils::sqrt(static_cast<Type>(0));
+        constexpr Type kNegative = utils::sqrt(static_cast<Type>(-1));
+        constexpr Type kInfinity = utils::rsqrt(static_cast<Type>(0));
+        CHECK(kSqrt == static_cast<Type>(4));
+        CHECK(kRsqrt == static_cast<Type>(0.5));
+        CHECK(kZero == static_cast<Type>(0));
+        CHECK(std::isnan(kNegative));
+        CHECK(std::isinf(kInfinity));
+    }
+
+    SUBCASE("Extreme magnitudes") {
+        constexpr Type kMax = utils::sqrt(std::numeric_limits<Type>::max());
+        constexpr Type kSubnormal = utils::sqrt(std::numeric_limits<Type>::denorm_min());
+        CHECK(is_close(kMax, std::sqrt(std::numeric_limits<Type>::max())));
+        CHECK(is_close(kSubnormal, std::sqrt(std::numeric_limits<Type>::denorm_min())));
+    }
+}
+
+TEST_CASE_TEMPLATE("Constexpr trigonometry", Type, VALID_TYPES) {
+    SUBCASE("Sine, cosine and tangent") {
+        constexpr auto sines = evaluate<Type>(kAngles, [](Type x) { return utils::sin(x); });
+        constexpr auto cosines = evaluate<Type>(kAngles, [](Type x) { return utils::cos(x); });
+        constexpr auto tangents = evaluate<Type>(kAngles, [](Type x) { return utils::tan(x); });
+        for (size_t i = 0; i < kAngles.size(); i++) {
+            const auto x = static_cast<Type>(kAngles[i]);
+            CHECK(is_close(sines[i], std::sin(x), Type(1)));
+            CHECK(is_close(cosines[i], std::cos(x), Type(1)));
+            CHECK(is_close(tangents[i], std::tan(x), Type(1)));
+        }
+    }
+
+    SUBCASE("Sine and cosine together") {
+        constexpr auto kSinCos = utils::sincos(static_cast<Type>(0.7));
+        constexpr Type kSin = utils::sin(static_cast<Type>(0.7));
+        constexpr Type kCos = utils::cos(static_cast<Type>(0.7));
+        CHECK(kSinCos.first == kSin);
+        CHECK(kSinCos.second == kCos);
+        CHECK(is_close(kSinCos.first, std::sin(static_cast<Type>(0.7))));
+        CHECK(is_close(kSinCos.second, std::cos(static_cast<Type>(0.7))));
+    }
+
+    SUBCASE("Arc cosine") {
+        constexpr auto angles = evaluate<Type>(kCosines, [](Type x) { return utils::acos(x); });
+        for (size_t i = 0; i < kCosines.size(); i++) {
+            CHECK(is_close(angles[i], std::acos(static_cast<Type>(kCosines[i])), Type(1)));
+        }
+        constexpr Type kOutOfRange = utils::acos(static_cast<Type>(1.5));
+        CHECK(std::isnan(kOutOfRange));
+    }
+
+    SUBCASE("Two-argument arc tangent") {
+        constexpr auto angles = [] {
+            std::array<Type, kPoints.size()> out{};
+            for (size_t i = 0; i < kPoints.size(); i++) {
+                out[i] = utils::atan2(static_cast<Type>(kPoints[i][0]),
+                                      static_cast<Type>(kPoints[i][1]));
+            }
+            return out;
+        }();
+        for (size_t i = 0; i < kPoints.size(); i++) {
+            const auto y = static_cast<Type>(kPoints[i][0]);
+            const auto x = static_cast<Type>(kPoints[i][1]);
+            CHECK(is_close(angles[i], std::atan2(y, x), Type(1)));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Constexpr exponential and logarithm", Type, VALID_TYPES) {
+    SUBCASE("Exponential") {
+        constexpr auto values = evaluate<Type>(kExponents, [](Type x) { return utils::exp(x); });
+        for (size_t i = 0; i < kExponents.size(); i++) {
+            CHECK(is_close(values[i], std::exp(static_cast<Type>(kExponents[i]))));
+        }
+        constexpr Type kOverflow = utils::exp(static_cast<Type>(1e6));
+        constexpr Type kUnderflow = utils::exp(static_cast<Type>(-1e6));
+        CHECK(std::isinf(kOverflow));
+        CHECK(kUnderflow == static_cast<Type>(0));
+    }
+
+    SUBCASE("Logarithm") {
+        constexpr auto values = evaluate<Type>(kPositives, [](Type x) { return utils::log(x); });
+        for (size_t i = 0; i < kPositives.size(); i++) {
+            CHECK(is_close(values[i], std::log(static_cast<Type>(kPositives[i])), Type(1)));
+        }
+        constexpr Type kZero = utils::log(static_cast<Type>(0));
+        constexpr Type kNegative = utils::log(static_cast<Type>(-1));
+        CHECK(std::isinf(kZero));
+        CHECK(std::isnan(kNegative));
+    }
+}
+
+TEST_CASE_TEMPLATE("Fast reciprocal square root", Type, VALID_TYPES) {
+    // Sweep several decades with a non-power-of-two step to cover all mantissa patterns
+    constexpr Type kMaxRelError = utils::kRsqrtFastMaxRelError<Type>;
+    Type max_rel_error = 0;
+    for (Type x = static_cast<Type>(1e-30); x < static_cast<Type>(1e30); x *= static_cast<Type>(1.0137)) {
+        const Type expected = static_cast<Type>(1 / std::sqrt(static_cast<long double>(x)));
+        const Type rel_error = std::abs(utils::rsqrt_fast(x) - expected) / expected;
+        max_rel_error = std::max(max_rel_error, rel_error);
+    }
+    CHECK(max_rel_error <= kMaxRelError);
+
+    // Subnormal input (and the smallest normal value) keeps the same relative error bound
+    using Limits = std::numeric_limits<Type>;
+    constexpr Type kStep = static_cast<Type>(1.37);
+    Type max_subnormal_rel_error = 0;
+    for (Type x = Limits::denorm_min(); x <= Limits::min(); x = x * kStep + Limits::denorm_min()) {
+        const Type expected = static_cast<Type>(1 / std::sqrt(static_cast<long double>(x)));
+        const Type rel_error = std::abs(utils::rsqrt_fast(x) - expected) / expected;
+        max_subnormal_rel_error = std::max(max_subnormal_rel_error, rel_error);
+    }
+    CHECK(max_subnormal_rel_error <= kMaxRelError);
+    const Type kMin = Limits::min();
+    const Type min_expected = static_cast<Type>(1 / std::sqrt(static_cast<long double>(kMin)));
+    CHECK(std::abs(utils::rsqrt_fast(kMin) - min_expected) <= kMaxRelError * min_expected);
+
+    // Zero, infinity and invalid input follow 1 / sqrt(x)
+    const Type kZero = 0;
+    CHECK(utils::rsqrt_fast(kZero) == Limits::infinity());
+    CHECK(utils::rsqrt_fast(Limits::infinity()) == 0);
+    CHECK(std::isnan(utils::rsqrt_fast(static_cast<Type>(-1))));
+    CHECK(std::isnan(utils::rsqrt_fast(Limits::quiet_NaN())));
+
+    constexpr Type kExact = utils::rsqrt_fast(static_cast<Type>(4));
+    CHECK(kExact == static_cast<Type>(0.5));
+}
+
+TEST_CASE_TEMPLATE("Fused multiply-add", Type, VALID_TYPES) {
+    // (1 + 2^-k)^2 - (1 + 2^(1-k)) = 2^-2k is lost when the product is rounded to Type first
+    constexpr int kHalfDigits = (std::numeric_limits<Type>::digits + 1) / 2;
+    constexpr Type kSmall = utils::constexpr_impl::pow2<Type>(-kHalfDigits);
+    constexpr Type kA = 1 + kSmall;
+    constexpr Type kC = -(1 + 2 * kSmall);
+    constexpr Type kFused = utils::fma(kA, kA, kC);
+    CHECK(kFused == kSmall * kSmall);
+    CHECK(utils::fma(kA, kA, kC) == kFused);
+
+    constexpr Type kExact = utils::fma(static_cast<Type>(1.5), static_cast<Type>(-4), static_cast<Type>(0.25));
+    CHECK(kExact == static_cast<Type>(-5.75));
+    CHECK(utils::fma(static_cast<Type>(1.5), static_cast<Type>(-4), static_cast<Type>(0.25)) == kExact);
+
+    constexpr Type kInf = utils::fma(std::numeric_limits<Type>::infinity(), static_cast<Type>(2),
+                                     static_cast<Type>(1));
+    CHECK(std::isinf(kInf));
+}
+
+TEST_CASE_TEMPLATE("Fused multiply-add over the exponent range", Type, VALID_TYPES) {
+    // kA^2 * 2^g + kC * 2^g = 2^(g - 2h) exactly, for factors kA * 2^e and kA * 2^(g - e) spanning
+    // the normal range: huge factors must split without overflow, tiny products must keep their
+    // error terms, and the result itself may be subnormal
+    using Limits = std::numeric_limits<Type>;
+    using utils::constexpr_impl::pow2;
+    constexpr int kHalfDigits = (Limits::digits + 1) / 2;
+    constexpr Type kA = 1 + pow2<Type>(-kHalfDigits);
+    constexpr Type kC = -(1 + pow2<Type>(1 - kHalfDigits));
+    constexpr int kMinExp = Limits::min_exponent - 1;
+    constexpr int kMaxExp = Limits::max_exponent - 2;
+    constexpr int kStep = (kMaxExp - kMinExp) / 200;
+    constexpr int kDenormExp = Limits::min_exponent - Limits::digits;
+    constexpr std::array<int, 4> kProductExps{
+            kDenormExp + 2 * kHalfDigits, kMinExp + kHalfDigits, 0, kMaxExp};
+    constexpr int kFailures = [&]() {
+        int failures = 0;
+        for (int e = kMinExp; e <= kMaxExp; e += kStep) {
+            for (const int g : kProductExps) {
+                if ((g - e < kMinExp) || (g - e > kMaxExp)) {
+                    continue;
+                }
+                const Type a = kA * pow2<Type>(e);
+                const Type b = kA * pow2<Type>(g - e);
+                const Type c = kC * pow2<Type>(g);
+                const Type expected = pow2<Type>(g - 2 * kHalfDigits);
+                failures += (utils::fma(a, b, c) != expected);
+                failures += (utils::fma(b, -a, -c) != -expected);
+            }
+        }
+        return failures;
+    }();
+    CHECK(kFailures == 0);
+
+    // Products close to overflow, and results that overflow only without fusing
+    constexpr Type kMax = Limits::max();
+    constexpr Type kNearOverflow = utils::fma(kMax, static_cast<Type>(2), -kMax);
+    CHECK(kNearOverflow == kMax);
+    constexpr Type kOverflow = utils::fma(kMax, static_cast<Type>(2), static_cast<Type>(0));
+    CHECK(std::isinf(kOverflow));
+    constexpr Type kInfAddend = utils::fma(kMax, kMax, -Limits::infinity());
+    CHECK(kInfAddend == -Limits::infinity());
+
+    // Products that underflow keep the sign of a zero result
+    constexpr Type kNegativeZero = utils::fma(Limits::denorm_min(), -Limits::denorm_min(), Type{0});
+    CHECK(kNegativeZero == 0);
+    CHECK(std::signbit(kNegativeZero));
+}
+
+TEST_CASE("Fused multiply-add of extreme operands matches the run-time result") {
+    constexpr double kDouble = utils::fma(1e305, 1e-305, 1.0);
+    CHECK(kDouble == std::fma(1e305, 1e-305, 1.0));
+    constexpr float kFloat = utils::fma(3e37F, 1e-37F, 1.0F);
+    CHECK(kFloat == std::fma(3e37F, 1e-37F, 1.0F));
+    constexpr double kSubnormal = utils::fma(0x1.8p-540, -0x1.4p-535, 0x1.2p-1070);
+    CHECK(kSubnormal == std::fma(0x1.8p-540, -0x1.4p-535, 0x1.2p-1070));
+}
@@ -0,0 +1,215 @@
+// Unit tests for the VecArray class implementation
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "vec_array.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using vec::VecArray;
+
+// Number of vectors per test array (deliberately not a multiple of the SIMD width)
+static constexpr size_t kCount = 7;
+
+TEST_CASE_TEMPLATE("Gather and scatter vectors", Type, VALID_TYPES) {
+    SUBCASE("3D") {
+        const auto vecs = get_vecs<Type, 3>(kCount, 1.5L);
+        VecArray<Type, 3> arr(vecs);
+        REQUIRE(arr.size() == kCount);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(arr.gather(i) == vecs[i]);
+            CHECK(arr.x()[i] == vecs[i].x());
+            CHECK(arr.y()[i] == vecs[i].y());
+            CHECK(arr.z()[i] == vecs[i].z());
+        }
+
+        std::vector<Vec<Type, 3>> out(kCount);
+        arr.gather(out);
+        CHECK(std::equal(out.cbegin(), out.cend(), vecs.cbegin()));
+
+        const Vec<Type, 3> v{static_cast<Type>(9), static_cast<Type>(8), static_cast<Type>(7)};
+        arr.scatter(2, v);
+        CHECK(arr.gather(2) == v);
+
+        arr.push_back(v);
+        CHECK(arr.size() == kCount + 1);
+        CHECK(arr.gather(kCount) == v);
+    }
+
+    SUBCASE("4D") {
+        const auto vecs = get_vecs<Type, 4>(kCount, -2.0L);
+        VecArray<Type, 4> arr(kCount);
+        arr.scatter(vecs);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(arr.gather(i) == vecs[i]);
+            CHECK(arr.component(3)[i] == vecs[i].w());
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch elementwise arithmetic", Type, VALID_TYPES) {
+    const auto a = get_vecs<Type, 4>(kCount, 1.5L);
+    const auto b = get_vecs<Type, 4>(kCount, -0.25L);
+    const Type s = static_cast<Type>(3.5L);
+    const VecArray<Type, 4> arr_a(a);
+    const VecArray<Type, 4> arr_b(b);
+
+    SUBCASE("Addition") {
+        const auto out = arr_a + arr_b;
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out.gather(i) == a[i] + b[i]);
+        }
+    }
+
+    SUBCASE("Subtraction") {
+        auto out = arr_a;
+        out -= arr_b;
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out.gather(i) == a[i] - b[i]);
+        }
+    }
+
+    SUBCASE("Scalar multiplication") {
+        const auto out = s * arr_a;
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out.gather(i) == a[i] * s);
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch dot product", Type, VALID_TYPES) {
+    SUBCASE("2D") {
+        const auto a = get_vecs<Type, 2>(kCount, 1.5L);
+        const auto b = get_vecs<Type, 2>(kCount, -0.25L);
+        const auto out = dot(VecArray<Type, 2>(a), VecArray<Type, 2>(b));
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out[i] == dot(a[i], b[i]));
+        }
+    }
+
+    SUBCASE("3D") {
+        const auto a = get_vecs<Type, 3>(kCount, 1.5L);
+        const auto b = get_vecs<Type, 3>(kCount, -0.25L);
+        const auto out = dot(VecArray<Type, 3>(a), VecArray<Type, 3>(b));
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out[i] == dot(a[i], b[i]));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch cross product", Type, VALID_TYPES) {
+    SUBCASE("3D") {
+        const auto a = get_vecs<Type, 3>(kCount, 1.5L);
+        const auto b = get_vecs<Type, 3>(kCount, -0.25L);
+        const auto out = cross(VecArray<Type, 3>(a), VecArray<Type, 3>(b));
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out.gather(i) == cross(a[i], b[i]));
+        }
+    }
+
+    SUBCASE("3D - Output aliases input") {
+        const auto a = get_vecs<Type, 3>(kCount, 1.5L);
+        const auto b = get_vecs<Type, 3>(kCount, -0.25L);
+        VecArray<Type, 3> arr_a(a);
+        cross(arr_a, VecArray<Type, 3>(b), arr_a);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(arr_a.gather(i) == cross(a[i], b[i]));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch euclidean norm squared and distance squared", Type, VALID_TYPES) {
+    SUBCASE("3D") {
+        const auto a = get_vecs<Type, 3>(kCount, 1.5L);
+        const auto b = get_vecs<Type, 3>(kCount, -0.25L);
+        const VecArray<Type, 3> arr_a(a);
+        const VecArray<Type, 3> arr_b(b);
+        const auto norm2 = arr_a.euclidean2();
+        const auto dist2 = euclidean2(arr_a, arr_b);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(norm2[i] == a[i].euclidean2());
+            CHECK(dist2[i] == euclidean2(a[i], b[i]));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch normalize", Type, VALID_TYPES) {
+    SUBCASE("3D") {
+        const auto a = get_vecs<Type, 3>(kCount, 1.5L);
+        const auto out = VecArray<Type, 3>(a).normalize();
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out.gather(i) == a[i].normalize());
+        }
+    }
+
+    SUBCASE("4D") {
+        const auto a = get_vecs<Type, 4>(kCount, -3.0L);
+        VecArray<Type, 4> out(kCount);
+        normalize(VecArray<Type, 4>(a), out);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(out.gather(i) == a[i].normalize());
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch normalize fast", Type, VALID_TYPES) {
+    // Allow for the documented rsqrt_fast() error plus rounding of the norm and the product
+    const auto is_close = [](const Vec<Type, 3>& actual, const Vec<Type, 3>& expected) {
+        constexpr Type kTolerance = vec::utils::kRsqrtFastMaxRelError<Type>
+                + 4 * std::numeric_limits<Type>::epsilon();
+        return (actual - expected).manhattan() <= kTolerance * expected.manhattan();
+    };
+
+    SUBCASE("3D") {
+        const auto a = get_vecs<Type, 3>(kCount, 1.5L);
+        const auto out = VecArray<Type, 3>(a).normalize_fast();
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(is_close(out.gather(i), a[i].normalize()));
+            CHECK(out.gather(i) == a[i].normalize_fast());
+        }
+    }
+
+    SUBCASE("3D friend") {
+        const auto a = get_vecs<Type, 3>(kCount, -3.0L);
+        VecArray<Type, 3> out(kCount);
+        normalize_fast(VecArray<Type, 3>(a), out);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(is_close(out.gather(i), a[i].normalize()));
+        }
+    }
+
+    SUBCASE("Subnormal squared lengths") {
+        // Mix tiny vectors with ordinary ones, so that registers hold both kinds of lane
+        // The power-of-two scale keeps the (subnormal) squared lengths exact in any summation order
+        auto a = get_vecs<Type, 3>(kCount, 1.5L);
+        const Type kTiny = std::ldexp(Type{1}, std::numeric_limits<Type>::min_exponent / 2 - 8);
+        for (size_t i = 0; i < kCount; i += 2) {
+            a[i] *= kTiny;
+        }
+        const auto out = VecArray<Type, 3>(a).normalize_fast();
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(is_close(out.gather(i), a[i].normalize()));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Batch projection and rejection", Type, VALID_TYPES) {
+    SUBCASE("3D") {
+        const auto a = get_vecs<Type, 3>(kCount, 1.5L);
+        const auto b = get_vecs<Type, 3>(kCount, -0.25L);
+        const VecArray<Type, 3> arr_a(a);
+        const VecArray<Type, 3> arr_b(b);
+        const auto projected = project_onto(arr_a, arr_b);
+        const auto rejected = reject_from(arr_a, arr_b);
+        for (size_t i = 0; i < kCount; i++) {
+            CHECK(projected.gather(i) == project_onto(a[i], b[i]));
+            CHECK(rejected.gather(i) == reject_from(a[i], b[i]));
+        }
+    }
+}
@@ -8,6 +8,9 @@
 // UUT headers
 #include "vec.hpp"
 
+#include <cmath>
+#include <limits>
+
 TEST_CASE_TEMPLATE("Construct zero vector", Type, VALID_TYPES) {
     constexpr TestArray kExpected{0.0, 0.0, 0.0, 0.0};
 
@@ -389,6 +392,63 @@ TEST_CASE_TEMPLATE("Normalize", Type, VALID_TYPES) {
     }
 }
 
+TEST_CASE_TEMPLATE("Normalize fast", Type, VALID_TYPES) {
+    // Each element is within the rsqrt_fast() error bound (plus rounding) of normalize()
+    const auto is_close = []<size_t M>(const Vec<Type, M>& v) {
+        constexpr Type kTolerance = vec::utils::kRsqrtFastMaxRelError<Type>
+                + 2 * std::numeric_limits<Type>::epsilon();
+        const Vec<Type, M> fast = v.normalize_fast();
+        const Vec<Type, M> exact = v.normalize();
+        for (size_t i = 0; i < M; i++) {
+            if (!(std::abs(fast[i] - exact[i]) <= kTolerance * std::abs(exact[i]))) {
+                return false;
+            }
+        }
+        return true;
+    };
+    constexpr TestArray kInput{0.45, -2.1, 0.0, -3.0};
+
+    SUBCASE("2D") {
+        constexpr auto v = get_vec<Type, 2>(kInput);
+        constexpr Vec<Type, 2> v_normalized = v.normalize_fast();
+        CHECK(v_normalized == Approx(v.normalize()));
+        CHECK(is_close(v)); // non-constexpr use
+        CHECK(v.euclidean_inv() == doctest::Approx(1.0 / 2.1476731594));
+    }
+
+    SUBCASE("3D") {
+        constexpr auto v = get_vec<Type, 3>(kInput);
+        constexpr Vec<Type, 3> v_normalized = v.normalize_fast();
+        CHECK(v_normalized == Approx(v.normalize()));
+        CHECK(is_close(v)); // non-constexpr use
+        CHECK(v.euclidean_inv() == doctest::Approx(1.0 / 2.1476731594));
+    }
+
+    SUBCASE("4D") {
+        constexpr auto v = get_vec<Type, 4>(kInput);
+        constexpr Vec<Type, 4> v_normalized = v.normalize_fast();
+        CHECK(v_normalized == Approx(v.normalize()));
+        CHECK(is_close(v)); // non-constexpr use
+        CHECK(v.euclidean_inv() == doctest::Approx(1.0 / 3.6895799219));
+    }
+
+    SUBCASE("Non-normal squared lengths") {
+        // Squared lengths that are subnormal, or (for large elements) close to overflow
+        using Limits = std::numeric_limits<Type>;
+        const Type tiny = std::sqrt(Limits::min()) / 8;
+        const Type huge = std::sqrt(Limits::max()) / 2;
+        CHECK(is_close(Vec<Type, 3>(tiny, tiny, Type{0})));
+        CHECK(is_close(Vec<Type, 3>(tiny, -tiny / 3, tiny / 7)));
+        CHECK(is_close(Vec<Type, 4>(huge, -huge, huge / 3, Type{0})));
+        CHECK(is_close(Vec<Type, 2>(tiny / 64, Type{0})));
+
+        // A zero vector has no direction, and neither result is finite
+        const Vec<Type, 3> zero;
+        CHECK(zero.euclidean_inv() == Limits::infinity());
+        CHECK(std::isnan(zero.normalize_fast()[0]));
+    }
+}
+
 TEST_CASE_TEMPLATE("Fill", Type, VALID_TYPES) {
     constexpr Type kFillValue = 123.0;
     constexpr TestArray kExpected{123.0, 123.0, 123.0, 123.0};
@@ -315,3 +315,123 @@ TEST_CASE_TEMPLATE("Reject from unit", Type, VALID_TYPES) {
         CHECK(v1_rej_unit_v2 == get_approx_vec<Type, 4>(kExpected));
     }
 }
+
+TEST_CASE_TEMPLATE("Fused multiply-add", Type, VALID_TYPES) {
+    constexpr TestArray kInput1{1.0, -2.5, 3.5, 4.0};
+    constexpr TestArray kInput2{-5.0, 6.0, 0.5, 8.25};
+    constexpr TestArray kInput3{0.25, 1.0, -7.0, 2.0};
+
+    SUBCASE("2D") {
+        constexpr TestArray kExpectedFma{-4.75, -14.0};
+        constexpr TestArray kExpectedMadd{-1.75, 6.0};
+        constexpr auto v1 = get_vec<Type, 2>(kInput1);
+        constexpr auto v2 = get_vec<Type, 2>(kInput2);
+        constexpr auto v3 = get_vec<Type, 2>(kInput3);
+        constexpr Vec<Type, 2> v_fma = fma(v1, v2, v3);
+        constexpr Vec<Type, 2> v_madd = madd(v1, static_cast<Type>(-2), v3);
+        CHECK(v_fma == get_approx_vec<Type, 2>(kExpectedFma));
+        CHECK(v_madd == get_approx_vec<Type, 2>(kExpectedMadd));
+        CHECK(fma(v1, v2, v3) == v_fma);
+        CHECK(madd(v1, static_cast<Type>(-2), v3) == v_madd);
+    }
+
+    SUBCASE("3D") {
+        constexpr TestArray kExpectedFma{-4.75, -14.0, -5.25};
+        constexpr TestArray kExpectedMadd{-1.75, 6.0, -14.0};
+        constexpr auto v1 = get_vec<Type, 3>(kInput1);
+        constexpr auto v2 = get_vec<Type, 3>(kInput2);
+        constexpr auto v3 = get_vec<Type, 3>(kInput3);
+        constexpr Vec<Type, 3> v_fma = fma(v1, v2, v3);
+        constexpr Vec<Type, 3> v_madd = madd(v1, static_cast<Type>(-2), v3);
+        CHECK(v_fma == get_approx_vec<Type, 3>(kExpectedFma));
+        CHECK(v_madd == get_approx_vec<Type, 3>(kExpectedMadd));
+        CHECK(fma(v1, v2, v3) == v_fma);
+        CHECK(madd(v1, static_cast<Type>(-2), v3) == v_madd);
+    }
+
+    SUBCASE("4D") {
+        constexpr TestArray kExpectedFma{-4.75, -14.0, -5.25, 35.0};
+        constexpr TestArray kExpectedMadd{-1.75, 6.0, -14.0, -6.0};
+        constexpr auto v1 = get_vec<Type, 4>(kInput1);
+        constexpr auto v2 = get_vec<Type, 4>(kInput2);
+        constexpr auto v3 = get_vec<Type, 4>(kInput3);
+        constexpr Vec<Type, 4> v_fma = fma(v1, v2, v3);
+        constexpr Vec<Type, 4> v_madd = madd(v1, static_cast<Type>(-2), v3);
+        CHECK(v_fma == get_approx_vec<Type, 4>(kExpectedFma));
+        CHECK(v_madd == get_approx_vec<Type, 4>(kExpectedMadd));
+        CHECK(fma(v1, v2, v3) == v_fma);
+        CHECK(madd(v1, static_cast<Type>(-2), v3) == v_madd);
+    }
+
+    SUBCASE("Single rounding at run time") {
+        // (1 + 2^-k)(1 - 2^-k) - 1 = -2^-2k is lost when the product is rounded to Type first
+        constexpr int kHalfDigits = (std::numeric_limits<Type>::digits + 1) / 2;
+        constexpr Type kSmall = vec::utils::constexpr_impl::pow2<Type>(-kHalfDigits);
+        constexpr Vec<Type, 4> v1{1 + kSmall, 1 + kSmall, 1 - kSmall, 1 - kSmall};
+        constexpr Vec<Type, 4> v2{1 - kSmall, 1 - kSmall, 1 + kSmall, 1 + kSmall};
+        constexpr Vec<Type, 4> v3{-Type{1}, -Type{1}, -Type{1}, -Type{1}};
+        constexpr Vec<Type, 4> v_fma = fma(v1, v2, v3);
+        constexpr Vec<Type, 4> v_madd = madd(v1, 1 - kSmall, v3);
+        for (size_t i = 0; i < 4; i++) {
+            CHECK(v_fma[i] == -kSmall * kSmall);
+            CHECK(fma(v1, v2, v3)[i] == v_fma[i]);
+            CHECK(madd(v1, 1 - kSmall, v3)[i] == v_madd[i]);
+        }
+        CHECK(v_madd[0] == -kSmall * kSmall);
+    }
+}
+
+TEST_CASE_TEMPLATE("Linear interpolation", Type, VALID_TYPES) {
+    constexpr TestArray kInput1{0.1, -2.3, 3.7, 4.9};
+    constexpr TestArray kInput2{-5.3, 6.1, 0.7, 8.3};
+    constexpr TestArray kWeights{0.0, 1.0, 0.25, 0.5};
+
+    SUBCASE("2D") {
+        constexpr TestArray kExpected{-1.25, -0.2};
+        constexpr TestArray kExpectedMix{0.1, 6.1};
+        constexpr auto v1 = get_vec<Type, 2>(kInput1);
+        constexpr auto v2 = get_vec<Type, 2>(kInput2);
+        constexpr auto t = get_vec<Type, 2>(kWeights);
+        constexpr Vec<Type, 2> v_lerp = lerp(v1, v2, static_cast<Type>(0.25));
+        constexpr Vec<Type, 2> v_mix = mix(v1, v2, t);
+        CHECK(v_lerp == get_approx_vec<Type, 2>(kExpected));
+        CHECK(v_mix == get_approx_vec<Type, 2>(kExpectedMix));
+        CHECK(lerp(v1, v2, static_cast<Type>(0)) == v1);
+        CHECK(lerp(v1, v2, static_cast<Type>(1)) == v2);
+    }
+
+    SUBCASE("3D") {
+        constexpr TestArray kExpected{-1.25, -0.2, 2.95};
+        constexpr TestArray kExpectedMix{0.1, 6.1, 2.95};
+        constexpr auto v1 = get_vec<Type, 3>(kInput1);
+        constexpr auto v2 = get_vec<Type, 3>(kInput2);
+        constexpr auto t = get_vec<Type, 3>(kWeights);
+        constexpr Vec<Type, 3> v_lerp = lerp(v1, v2, static_cast<Type>(0.25));
+        constexpr Vec<Type, 3> v_mix = mix(v1, v2, t);
+        CHECK(v_lerp == get_approx_vec<Type, 3>(kExpected));
+        CHECK(v_mix == get_approx_vec<Type, 3>(kExpectedMix));
+        CHECK(lerp(v1, v2, static_cast<Type>(0)) == v1);
+        CHECK(lerp(v1, v2, static_cast<Type>(1)) == v2);
+    }
+
+    SUBCASE("4D") {
+        constexpr TestArray kExpected{-1.25, -0.2, 2.95, 5.75};
+        constexpr TestArray kExpectedMix{0.1, 6.1, 2.95, 6.6};
+        constexpr auto v1 = get_vec<Type, 4>(kInput1);
+        constexpr auto v2 = get_vec<Type, 4>(kInput2);
+        constexpr auto t = get_vec<Type, 4>(kWeights);
+        constexpr Vec<Type, 4> v_lerp = lerp(v1, v2, static_cast<Type>(0.25));
+        constexpr Vec<Type, 4> v_mix = mix(v1, v2, t);
+        CHECK(v_lerp == get_approx_vec<Type, 4>(kExpected));
+        CHECK(v_mix == get_approx_vec<Type, 4>(kExpectedMix));
+
+        // Endpoints are exact at run time too
+        for (const Type s : {static_cast<Type>(0), static_cast<Type>(1)}) {
+            const Vec<Type, 4> expected = (s == 0) ? v1 : v2;
+            const Vec<Type, 4> actual = lerp(v1, v2, s);
+            for (size_t i = 0; i < 4; i++) {
+                CHECK(actual[i] == expected[i]);
+            }
+        }
+    }
+}
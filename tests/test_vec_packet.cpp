@@ -0,0 +1,182 @@
+// Unit tests for the VecPacket class implementation
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "vec_packet.hpp"
+
+#include <cmath>
+#include <vector>
+
+using vec::Lanes;
+using vec::VecArray;
+using vec::VecPacket;
+
+// Types to template packet test cases over (packets don't support long double)
+#define PACKET_TYPES  float, double
+
+// Number of lanes per test packet
+static constexpr size_t kWidth = 8;
+
+// Ray/plane/disc hit test written once against the Vec interface (see examples/)
+template <typename V, typename S>
+auto hits_disc(const V& origin, const V& dir, const V& center, const V& normal, S radius) {
+    const auto t = dot(center - origin, normal) / dot(dir, normal);
+    const V intersect = origin + (dir * t);
+    return (t >= S(0)) & (euclidean2(intersect, center) < radius * radius);
+}
+
+// Scalar instantiation needs bool & bool to behave like packet mask &
+template <typename Type>
+bool hits_disc_scalar(const Vec<Type, 3>& origin, const Vec<Type, 3>& dir,
+                      const Vec<Type, 3>& center, const Vec<Type, 3>& normal, Type radius) {
+    return static_cast<bool>(hits_disc(origin, dir, center, normal, radius));
+}
+
+TEST_CASE_TEMPLATE("Load and store packets", Type, PACKET_TYPES) {
+    SUBCASE("3D - Contiguous Vec") {
+        const auto vecs = get_vecs<Type, 3>(kWidth, 1.5L);
+        const auto p = VecPacket<Type, 3, kWidth>::load(std::span(vecs));
+        std::vector<Vec<Type, 3>> out(kWidth);
+        p.store(std::span(out));
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(p.get(i) == vecs[i]);
+            CHECK(p.y()[i] == vecs[i].y());
+            CHECK(out[i] == vecs[i]);
+        }
+    }
+
+    SUBCASE("4D - VecArray") {
+        const auto vecs = get_vecs<Type, 4>(kWidth, -2.0L);
+        const VecArray<Type, 4> arr(vecs);
+        const auto p = VecPacket<Type, 4, kWidth>::load(arr, 0);
+        VecArray<Type, 4> out(kWidth);
+        p.store(out, 0);
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(p.get(i) == vecs[i]);
+            CHECK(out.gather(i) == vecs[i]);
+        }
+    }
+
+    SUBCASE("3D - Broadcast") {
+        const Vec<Type, 3> v{static_cast<Type>(1), static_cast<Type>(2), static_cast<Type>(3)};
+        const VecPacket<Type, 3, kWidth> p(v);
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(p.get(i) == v);
+        }
+    }
+
+    SUBCASE("Broadcast keeps negative zero") {
+        const Lanes<Type, kWidth> lanes(-Type{0});
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(lanes[i] == Type{0});
+            CHECK(std::signbit(lanes[i]));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Packet arithmetic matches Vec", Type, PACKET_TYPES) {
+    const auto a = get_vecs<Type, 3>(kWidth, 1.5L);
+    const auto b = get_vecs<Type, 3>(kWidth, -0.25L);
+    const auto pa = VecPacket<Type, 3, kWidth>::load(std::span(a));
+    const auto pb = VecPacket<Type, 3, kWidth>::load(std::span(b));
+    const Type s = static_cast<Type>(2.5L);
+
+    SUBCASE("Addition and subtraction") {
+        const auto sum = pa + pb;
+        const auto diff = pa - pb;
+        const auto neg = -pa;
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(sum.get(i) == a[i] + b[i]);
+            CHECK(diff.get(i) == a[i] - b[i]);
+            CHECK(neg.get(i) == -a[i]);
+        }
+    }
+
+    SUBCASE("Scalar multiplication and division") {
+        const auto prod = pa * s;
+        const auto rprod = s * pa;
+        const auto quot = pa / s;
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(prod.get(i) == a[i] * s);
+            CHECK(rprod.get(i) == a[i] * s);
+            CHECK(quot.get(i) == a[i] / s);
+        }
+    }
+
+    SUBCASE("Dot and cross product") {
+        const auto d = dot(pa, pb);
+        const auto c = cross(pa, pb);
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(d[i] == dot(a[i], b[i]));
+            CHECK(c.get(i) == cross(a[i], b[i]));
+        }
+    }
+
+    SUBCASE("Norms and distances") {
+        const auto norm2 = pa.euclidean2();
+        const auto norm = pa.euclidean();
+        const auto dist2 = euclidean2(pa, pb);
+        const auto unit = pa.normalize();
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(norm2[i] == a[i].euclidean2());
+            CHECK(norm[i] == a[i].euclidean());
+            CHECK(dist2[i] == euclidean2(a[i], b[i]));
+            CHECK(unit.get(i) == a[i].normalize());
+        }
+    }
+
+    SUBCASE("Projection and rejection") {
+        const auto projected = project_onto(pa, pb);
+        const auto rejected = reject_from(pa, pb);
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(projected.get(i) == project_onto(a[i], b[i]));
+            CHECK(rejected.get(i) == reject_from(a[i], b[i]));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Packet lane masks", Type, PACKET_TYPES) {
+    const auto a = get_vecs<Type, 3>(kWidth, 1.5L);
+    auto b = a;
+    b[3].x() += static_cast<Type>(1);
+    const auto pa = VecPacket<Type, 3, kWidth>::load(std::span(a));
+    const auto pb = VecPacket<Type, 3, kWidth>::load(std::span(b));
+
+    SUBCASE("Approximate equality") {
+        const auto eq = approx_eq(pa, pb);
+        CHECK(eq.any());
+        CHECK_FALSE(eq.all());
+        CHECK(eq.bits() == (0xFFu & ~(1u << 3)));
+        CHECK(approx_eq(pa, pa).all());
+    }
+
+    SUBCASE("Comparison and select") {
+        const Lanes<Type, kWidth> threshold(static_cast<Type>(20));
+        const auto norm2 = pa.euclidean2();
+        const auto mask = norm2 < threshold;
+        const auto chosen = select(mask, pa, -pa);
+        for (size_t i = 0; i < kWidth; i++) {
+            CHECK(mask[i] == (a[i].euclidean2() < static_cast<Type>(20)));
+            CHECK(chosen.get(i) == (mask[i] ? a[i] : -a[i]));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Generic Vec code instantiated for packets", Type, PACKET_TYPES) {
+    const auto origins = get_vecs<Type, 3>(kWidth, 0.5L);
+    const auto dirs = get_vecs<Type, 3>(kWidth, -0.25L);
+    const Vec<Type, 3> center{static_cast<Type>(5), static_cast<Type>(0), static_cast<Type>(0)};
+    const Vec<Type, 3> normal{static_cast<Type>(-1), static_cast<Type>(0), static_cast<Type>(0.5)};
+    const Type radius = static_cast<Type>(4);
+
+    using Packet = VecPacket<Type, 3, kWidth>;
+    const auto hits = hits_disc(Packet::load(std::span(origins)), Packet::load(std::span(dirs)),
+                                Packet(center), Packet(normal), Lanes<Type, kWidth>(radius));
+    for (size_t i = 0; i < kWidth; i++) {
+        CHECK(hits[i] == hits_disc_scalar(origins[i], dirs[i], center, normal, radius));
+    }
+}
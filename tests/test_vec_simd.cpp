@@ -0,0 +1,231 @@
+// Unit tests for the Vec/Mat SIMD backend (compiled with VEC_ENABLE_SIMD)
+//
+// Each test computes a result at compile time (always the scalar path) and at run time (the SIMD
+// path for float/double 3D/4D vectors and 4x4 matrices) and requires the two to be
+// bitwise-identical. 4x4 matrix products are only compared approximately when FMA is enabled.
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "mat.hpp"
+#include "vec.hpp"
+
+#include <cstring>
+
+// Check that two scalars hold exactly the same value bits
+// Note: long double is compared by value since its storage contains unused padding bytes
+template <typename Type>
+bool bitwise_eq(Type x, Type y) {
+    if constexpr (std::is_same_v<Type, long double>) {
+        return (x == y) && (std::signbit(x) == std::signbit(y));
+    } else {
+        return std::memcmp(&x, &y, sizeof(Type)) == 0;
+    }
+}
+
+// Check that two vectors hold exactly the same bit patterns in every (non-padding) element
+template <typename Type, size_t M>
+bool bitwise_eq(const Vec<Type, M>& a, const Vec<Type, M>& b) {
+    return std::equal(a.cbegin(), a.cend(), b.cbegin(), [](Type x, Type y) {
+        return bitwise_eq(x, y);
+    });
+}
+
+// Check that two matrices hold exactly the same bit patterns in every element
+template <typename Type, size_t M>
+bool bitwise_eq(const Mat<Type, M>& a, const Mat<Type, M>& b) {
+    return std::equal(a.cbegin(), a.cend(), b.cbegin(), [](const auto& x, const auto& y) {
+        return bitwise_eq(x, y);
+    });
+}
+
+// Check that a fused 4x4 product matches the scalar result (exactly, unless FMA contracts it)
+template <typename T>
+bool product_eq(const T& a, const T& b) {
+#if defined(VEC_SIMD_FMA)
+    return a == Approx(b);
+#else
+    return bitwise_eq(a, b);
+#endif
+}
+
+// Copy a value through a volatile so the compiler must compute with it at run time
+template <typename T>
+T runtime(const T& value) {
+    volatile bool flag = true;
+    return flag ? value : T{};
+}
+
+TEST_CASE_TEMPLATE("SIMD storage layout", Type, VALID_TYPES) {
+    SUBCASE("3D") {
+        Vec<Type, 3> v{static_cast<Type>(1), static_cast<Type>(2), static_cast<Type>(3)};
+        CHECK(v.size() == 3);
+        CHECK(std::distance(v.begin(), v.end()) == 3);
+        CHECK(std::distance(v.cbegin(), v.cend()) == 3);
+        CHECK_THROWS(v.at(3));
+        if constexpr (vec::simd::kEnabled<Type, 3>) {
+            CHECK(sizeof(v) == 4 * sizeof(Type));
+            CHECK(alignof(Vec<Type, 3>) == 4 * sizeof(Type));
+        }
+    }
+
+    SUBCASE("4D") {
+        Vec<Type, 4> v{};
+        CHECK(std::distance(v.begin(), v.end()) == 4);
+        CHECK_THROWS(v.at(4));
+    }
+}
+
+TEST_CASE_TEMPLATE("SIMD arithmetic matches scalar path", Type, VALID_TYPES) {
+    constexpr TestArray kInput1{1.1L, -2.7L, 3.3e7L, 4.9e-3L};
+    constexpr TestArray kInput2{-5.3L, 6.1L, 7.7e-5L, 8.0L};
+    constexpr Type kScalar = static_cast<Type>(0.3L);
+
+    SUBCASE("3D") {
+        constexpr auto a = get_vec<Type, 3>(kInput1);
+        constexpr auto b = get_vec<Type, 3>(kInput2);
+        const auto ra = runtime(a);
+        const auto rb = runtime(b);
+        const Type rs = runtime(kScalar);
+
+        constexpr auto sum = a + b;
+        constexpr auto diff = a - b;
+        constexpr auto prod = a * kScalar;
+        constexpr auto quot = a / kScalar;
+        constexpr auto neg = -a;
+        CHECK(bitwise_eq(ra + rb, sum));
+        CHECK(bitwise_eq(ra - rb, diff));
+        CHECK(bitwise_eq(ra * rs, prod));
+        CHECK(bitwise_eq(rs * ra, prod));
+        CHECK(bitwise_eq(ra / rs, quot));
+        CHECK(bitwise_eq(-ra, neg));
+
+        auto acc = ra;
+        acc += rb;
+        CHECK(bitwise_eq(acc, sum));
+        acc = ra;
+        acc -= rb;
+        CHECK(bitwise_eq(acc, diff));
+        acc = ra;
+        acc *= rs;
+        CHECK(bitwise_eq(acc, prod));
+        acc = ra;
+        acc /= rs;
+        CHECK(bitwise_eq(acc, quot));
+    }
+
+    SUBCASE("4D") {
+        constexpr auto a = get_vec<Type, 4>(kInput1);
+        constexpr auto b = get_vec<Type, 4>(kInput2);
+        const auto ra = runtime(a);
+        const auto rb = runtime(b);
+        const Type rs = runtime(kScalar);
+
+        constexpr auto sum = a + b;
+        constexpr auto diff = a - b;
+        constexpr auto prod = a * kScalar;
+        constexpr auto quot = a / kScalar;
+        constexpr auto neg = -a;
+        CHECK(bitwise_eq(ra + rb, sum));
+        CHECK(bitwise_eq(ra - rb, diff));
+        CHECK(bitwise_eq(ra * rs, prod));
+        CHECK(bitwise_eq(rs * ra, prod));
+        CHECK(bitwise_eq(ra / rs, quot));
+        CHECK(bitwise_eq(-ra, neg));
+    }
+}
+
+TEST_CASE_TEMPLATE("SIMD dot product matches scalar path", Type, VALID_TYPES) {
+    constexpr TestArray kInput1{1.1L, -2.7L, 3.3e7L, 4.9e-3L};
+    constexpr TestArray kInput2{-5.3L, 6.1L, 7.7e-5L, 8.0L};
+
+    SUBCASE("3D") {
+        constexpr auto a = get_vec<Type, 3>(kInput1);
+        constexpr auto b = get_vec<Type, 3>(kInput2);
+        constexpr Type expected = dot(a, b);
+        constexpr Type expected_norm2 = a.euclidean2();
+        const Type out = dot(runtime(a), runtime(b));
+        const Type out_norm2 = runtime(a).euclidean2();
+        CHECK(bitwise_eq(out, expected));
+        CHECK(bitwise_eq(out_norm2, expected_norm2));
+    }
+
+    SUBCASE("4D") {
+        constexpr auto a = get_vec<Type, 4>(kInput1);
+        constexpr auto b = get_vec<Type, 4>(kInput2);
+        constexpr Type expected = dot(a, b);
+        const Type out = dot(runtime(a), runtime(b));
+        CHECK(bitwise_eq(out, expected));
+    }
+}
+
+TEST_CASE_TEMPLATE("SIMD approximate equality matches scalar path", Type, VALID_TYPES) {
+    constexpr TestArray kInput1{1.0L, 2.1L, -3.0L, 4.5L};
+    constexpr TestArray kInput2{1.0001L, 2.1L, -3.0L, 4.5L};
+    constexpr TestArray kInput3{1.0L, 2.1L, -3.0L, 9.5L}; // differs only in w
+
+    SUBCASE("3D") {
+        constexpr auto v1 = get_vec<Type, 3>(kInput1);
+        constexpr auto v2 = get_vec<Type, 3>(kInput2);
+        constexpr auto v3 = get_vec<Type, 3>(kInput3);
+        constexpr bool default_eps_eq = approx_eq(v1, v2);
+        constexpr bool custom_eps_eq = approx_eq(v1, v2, static_cast<Type>(0.001));
+        CHECK(approx_eq(runtime(v1), runtime(v1)));
+        CHECK(approx_eq(runtime(v1), runtime(v2)) == default_eps_eq);
+        CHECK(approx_eq(runtime(v1), runtime(v2), static_cast<Type>(0.001)) == custom_eps_eq);
+        CHECK(approx_eq(runtime(v1), runtime(v3)));
+
+        // Fill constructor also writes the padding lane, which must not affect comparisons
+        const Vec<Type, 3> filled(static_cast<Type>(1));
+        const Vec<Type, 3> listed{static_cast<Type>(1), static_cast<Type>(1), static_cast<Type>(1)};
+        CHECK(approx_eq(runtime(filled), runtime(listed)));
+    }
+
+    SUBCASE("4D") {
+        constexpr auto v1 = get_vec<Type, 4>(kInput1);
+        constexpr auto v2 = get_vec<Type, 4>(kInput2);
+        constexpr auto v3 = get_vec<Type, 4>(kInput3);
+        constexpr bool default_eps_eq = approx_eq(v1, v2);
+        constexpr bool custom_eps_eq = approx_eq(v1, v2, static_cast<Type>(0.001));
+        CHECK(approx_eq(runtime(v1), runtime(v2)) == default_eps_eq);
+        CHECK(approx_eq(runtime(v1), runtime(v2), static_cast<Type>(0.001)) == custom_eps_eq);
+        CHECK_FALSE(approx_eq(runtime(v1), runtime(v3)));
+    }
+}
+
+TEST_CASE_TEMPLATE("SIMD 4x4 matrix products match scalar path", Type, VALID_TYPES) {
+    constexpr TestGrid kInput1{{
+            {1.1, 2.0, -3.5, 0.0},
+            {5.0, 6.6, 7.0, -9.3e4},
+            {-1.0, -2.0, 3.0e-3, -4.0},
+            {-5.0, -6.7, 7.0, -8.0},
+    }};
+    constexpr TestGrid kInput2{{
+            {1.0, 1.3, -2.0, -2.0},
+            {3.6, 3.6, 4.1, 4.0},
+            {-1.0, -1.0, -4.0, -4.7e-2},
+            {-5.5, -5.5, 7.0, 7.9},
+    }};
+    constexpr TestArray kInput3{0.3L, -2.7L, 3.3e5L, 4.9e-3L};
+
+    constexpr auto a = get_mat<Type, 4>(kInput1);
+    constexpr auto b = get_mat<Type, 4>(kInput2);
+    constexpr auto v = get_vec<Type, 4>(kInput3);
+    const auto ra = runtime(a);
+    const auto rb = runtime(b);
+    const auto rv = runtime(v);
+
+    constexpr auto prod = a * b;
+    constexpr auto row_prod = v * a;
+    constexpr auto col_prod = a * v;
+    CHECK(product_eq(ra * rb, prod));
+    CHECK(product_eq(rv * ra, row_prod));
+    CHECK(product_eq(ra * rv, col_prod));
+
+    auto r = ra;
+    r *= rb;
+    CHECK(product_eq(r, prod));
+}
@@ -0,0 +1,195 @@
+// Unit tests for the VecRef and VecView non-owning vector references
+
+// Testing headers
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+#include "test_utils.hpp"
+
+// UUT headers
+#include "mat.hpp"
+#include "vec_view.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <ranges>
+
+using vec::ConstVecRef;
+using vec::ConstVecView;
+using vec::VecRef;
+using vec::VecView;
+
+static_assert(std::random_access_iterator<VecView<vec::Vec3f>::Iterator>);
+static_assert(std::ranges::random_access_range<VecView<const vec::Vec3f>>);
+static_assert(std::ranges::sized_range<VecView<vec::Vec4d>>);
+
+// Interleaved test vertex (position, normal, uv), 8 elements per vertex
+static constexpr size_t kStride = 8;
+static constexpr size_t kVertices = 3;
+
+// Helper to fill an interleaved buffer with distinct elements
+template <typename Type>
+constexpr std::array<Type, kStride * kVertices> get_buffer() {
+    std::array<Type, kStride * kVertices> out{};
+    for (size_t i = 0; i < out.size(); i++) {
+        out[i] = static_cast<Type>(i) * static_cast<Type>(0.5);
+    }
+    return out;
+}
+
+TEST_CASE_TEMPLATE("Vector reference access", Type, VALID_TYPES) {
+    constexpr TestArray kInput{1.0L, -2.0L, 3.5L, 4.0L};
+
+    SUBCASE("2D") {
+        constexpr auto kValue = [=] {
+            auto buffer = get_vec<Type, 2>(kInput);
+            const VecRef<Vec<Type, 2>> ref(buffer);
+            ref.x() = 5;
+            return ref.load();
+        }();
+        CHECK(kValue == get_vec<Type, 2>({5.0L, -2.0L}));
+    }
+
+    SUBCASE("3D") {
+        std::array<Type, 4> buffer{0, 1, 2, 3};
+        const VecRef<Vec<Type, 3>> ref(&buffer[1]);
+        CHECK(ref.size() == 3);
+        CHECK(ref.data() == &buffer[1]);
+        CHECK(ref == get_vec<Type, 3>({1.0L, 2.0L, 3.0L}));
+        ref = get_vec<Type, 3>(kInput);
+        CHECK(buffer[0] == 0);
+        CHECK(buffer[3] == static_cast<Type>(3.5));
+        CHECK(std::ranges::equal(ref, std::array<Type, 3>{1, -2, static_cast<Type>(3.5)}));
+    }
+
+    SUBCASE("4D") {
+        auto v = get_vec<Type, 4>(kInput);
+        const VecRef<Vec<Type, 4>> ref(v);
+        const ConstVecRef<Vec<Type, 4>> cref = ref;
+        ref.w() = 8;
+        ref[0] = 2;
+        CHECK(cref.x() == 2);
+        CHECK(cref.w() == 8);
+        CHECK(v == get_vec<Type, 4>({2.0L, -2.0L, 3.5L, 8.0L}));
+        ref.clear();
+        CHECK(cref == Vec<Type, 4>());
+    }
+}
+
+TEST_CASE_TEMPLATE("Vector reference arithmetic", Type, VALID_TYPES) {
+    constexpr TestArray kInput1{1.0L, -2.0L, 3.5L, 4.0L};
+    constexpr TestArray kInput2{-5.0L, 6.0L, 0.5L, 2.0L};
+
+    SUBCASE("3D - Operators and friends") {
+        auto v1 = get_vec<Type, 3>(kInput1);
+        auto v2 = get_vec<Type, 3>(kInput2);
+        const ConstVecRef<Vec<Type, 3>> a(v1);
+        const ConstVecRef<Vec<Type, 3>> b(v2);
+        CHECK(a + b == v1 + v2);
+        CHECK(a - v2 == v1 - v2);
+        CHECK(-a == -v1);
+        CHECK(a * static_cast<Type>(2) == v1 * static_cast<Type>(2));
+        CHECK(static_cast<Type>(2) * a == v1 * static_cast<Type>(2));
+        CHECK(a / static_cast<Type>(2) == v1 / static_cast<Type>(2));
+        CHECK(dot(a, b) == dot(v1, v2));
+        CHECK(cross(a, b) == cross(v1, v2));
+        CHECK(euclidean(a, b) == euclidean(v1, v2));
+        CHECK(lerp(a, b, static_cast<Type>(0.25)) == lerp(v1, v2, static_cast<Type>(0.25)));
+        CHECK(a.euclidean() == v1.euclidean());
+        CHECK(a.normalize() == v1.normalize());
+        CHECK(a != b);
+    }
+
+    SUBCASE("3D - Matrix products") {
+        constexpr TestGrid kMat{{
+                {1.0L, 2.0L, -3.5L},
+                {5.0L, 6.5L, 7.0L},
+                {-1.0L, -2.0L, 3.0L},
+        }};
+        const auto m = get_mat<Type, 3>(kMat);
+        auto v = get_vec<Type, 3>(kInput1);
+        const auto expected = v * m;
+        const VecRef<Vec<Type, 3>> ref(v);
+        CHECK(m * ref == m * get_vec<Type, 3>(kInput1));
+        ref = ref * m;
+        CHECK(v == expected);
+    }
+
+    SUBCASE("4D - Compound assignment") {
+        auto v = get_vec<Type, 4>(kInput1);
+        const auto v2 = get_vec<Type, 4>(kInput2);
+        const VecRef<Vec<Type, 4>> ref(v);
+        ref += v2;
+        CHECK(v == get_vec<Type, 4>(kInput1) + v2);
+        ref -= v2;
+        CHECK(v == get_vec<Type, 4>(kInput1));
+        ref *= static_cast<Type>(4);
+        ref /= static_cast<Type>(2);
+        CHECK(v == get_vec<Type, 4>(kInput1) * static_cast<Type>(2));
+    }
+
+    SUBCASE("4D - Constexpr") {
+        constexpr auto kValue = [=] {
+            auto v1 = get_vec<Type, 4>(kInput1);
+            const VecRef<Vec<Type, 4>> ref(v1);
+            ref += get_vec<Type, 4>(kInput2);
+            ref = ref * static_cast<Type>(2);
+            return v1;
+        }();
+        const auto expected = get_vec<Type, 4>(kInput1) + get_vec<Type, 4>(kInput2);
+        CHECK(kValue == expected * static_cast<Type>(2));
+    }
+}
+
+TEST_CASE_TEMPLATE("Strided vector view", Type, VALID_TYPES) {
+    SUBCASE("Interleaved attributes") {
+        auto buffer = get_buffer<Type>();
+        const VecView<Vec<Type, 3>> positions(buffer.data(), kVertices, kStride);
+        const VecView<Vec<Type, 3>> normals(std::span<Type>(buffer), kStride, 3);
+        const VecView<Vec<Type, 2>> uvs(std::span<Type>(buffer), kStride, 6);
+        REQUIRE(positions.size() == kVertices);
+        REQUIRE(normals.size() == kVertices);
+        REQUIRE(uvs.size() == kVertices);
+        CHECK(normals[1] == get_vec<Type, 3>({5.5L, 6.0L, 6.5L}));
+        CHECK(uvs.back() == get_vec<Type, 2>({11.0L, 11.5L}));
+        CHECK(static_cast<size_t>(std::distance(normals.begin(), normals.end())) == kVertices);
+
+        // Write back in place without touching the other attributes
+        for (auto n : normals) {
+            n = n.normalize();
+        }
+        for (size_t i = 0; i < kVertices; i++) {
+            const auto expected = get_buffer<Type>();
+            const ConstVecRef<Vec<Type, 3>> original(&expected[i * kStride + 3]);
+            CHECK(normals[i] == original.normalize());
+            CHECK(positions[i] == ConstVecRef<Vec<Type, 3>>(&expected[i * kStride]));
+            CHECK(uvs[i] == ConstVecRef<Vec<Type, 2>>(&expected[i * kStride + 6]));
+        }
+    }
+
+    SUBCASE("Ranges and subviews") {
+        auto buffer = get_buffer<Type>();
+        const VecView<Vec<Type, 4>> view(std::span<Type>(buffer), kStride);
+        const ConstVecView<Vec<Type, 4>> const_view = view;
+        std::ranges::for_each(view.subview(1, 2), [](auto v) { v *= static_cast<Type>(2); });
+        CHECK(const_view.front() == get_vec<Type, 4>({0.0L, 0.5L, 1.0L, 1.5L}));
+        CHECK(const_view[1] == get_vec<Type, 4>({8.0L, 9.0L, 10.0L, 11.0L}));
+        CHECK(const_view[2] == get_vec<Type, 4>({16.0L, 17.0L, 18.0L, 19.0L}));
+        CHECK((view.end() - 1)[0] == const_view.back());
+        CHECK(VecView<Vec<Type, 4>>().empty());
+    }
+
+    SUBCASE("Constexpr") {
+        constexpr auto kBuffer = [] {
+            auto buffer = get_buffer<Type>();
+            const VecView<Vec<Type, 2>> uvs(std::span<Type>(buffer), kStride, 6);
+            for (auto uv : uvs) {
+                uv = Vec<Type, 2>(uv.y(), uv.x());
+            }
+            return buffer;
+        }();
+        CHECK(kBuffer[6] == static_cast<Type>(3.5));
+        CHECK(kBuffer[7] == static_cast<Type>(3));
+        CHECK(kBuffer[kStride + 6] == static_cast<Type>(7.5));
+    }
+}